@@ -1,5 +1,11 @@
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/random.h>
+#include "ase256.h"
 
 /* AES-256 규격 상수 정의 */
 #define AES256_ROUNDS 14
@@ -52,7 +58,321 @@ static const uint8_t Rcon[15] = {
 0x01,0x02,0x04,0x08,0x10,0x20,0x40,0x80,0x1b,0x36,0x6c,0xd8,0xab,0x4d,0x9a
 };
 
-/* AES 상태 행렬 타입 (4x4 행렬) */
+/* 암호화 T-table 0: S-box와 MixColumns 계수 (02,01,01,03)를 결합한 32비트 워드 */
+static const uint32_t Te0[256] = {
+0xc66363a5,0xf87c7c84,0xee777799,0xf67b7b8d,0xfff2f20d,0xd66b6bbd,0xde6f6fb1,0x91c5c554,
+0x60303050,0x02010103,0xce6767a9,0x562b2b7d,0xe7fefe19,0xb5d7d762,0x4dababe6,0xec76769a,
+0x8fcaca45,0x1f82829d,0x89c9c940,0xfa7d7d87,0xeffafa15,0xb25959eb,0x8e4747c9,0xfbf0f00b,
+0x41adadec,0xb3d4d467,0x5fa2a2fd,0x45afafea,0x239c9cbf,0x53a4a4f7,0xe4727296,0x9bc0c05b,
+0x75b7b7c2,0xe1fdfd1c,0x3d9393ae,0x4c26266a,0x6c36365a,0x7e3f3f41,0xf5f7f702,0x83cccc4f,
+0x6834345c,0x51a5a5f4,0xd1e5e534,0xf9f1f108,0xe2717193,0xabd8d873,0x62313153,0x2a15153f,
+0x0804040c,0x95c7c752,0x46232365,0x9dc3c35e,0x30181828,0x379696a1,0x0a05050f,0x2f9a9ab5,
+0x0e070709,0x24121236,0x1b80809b,0xdfe2e23d,0xcdebeb26,0x4e272769,0x7fb2b2cd,0xea75759f,
+0x1209091b,0x1d83839e,0x582c2c74,0x341a1a2e,0x361b1b2d,0xdc6e6eb2,0xb45a5aee,0x5ba0a0fb,
+0xa45252f6,0x763b3b4d,0xb7d6d661,0x7db3b3ce,0x5229297b,0xdde3e33e,0x5e2f2f71,0x13848497,
+0xa65353f5,0xb9d1d168,0x00000000,0xc1eded2c,0x40202060,0xe3fcfc1f,0x79b1b1c8,0xb65b5bed,
+0xd46a6abe,0x8dcbcb46,0x67bebed9,0x7239394b,0x944a4ade,0x984c4cd4,0xb05858e8,0x85cfcf4a,
+0xbbd0d06b,0xc5efef2a,0x4faaaae5,0xedfbfb16,0x864343c5,0x9a4d4dd7,0x66333355,0x11858594,
+0x8a4545cf,0xe9f9f910,0x04020206,0xfe7f7f81,0xa05050f0,0x783c3c44,0x259f9fba,0x4ba8a8e3,
+0xa25151f3,0x5da3a3fe,0x804040c0,0x058f8f8a,0x3f9292ad,0x219d9dbc,0x70383848,0xf1f5f504,
+0x63bcbcdf,0x77b6b6c1,0xafdada75,0x42212163,0x20101030,0xe5ffff1a,0xfdf3f30e,0xbfd2d26d,
+0x81cdcd4c,0x180c0c14,0x26131335,0xc3ecec2f,0xbe5f5fe1,0x359797a2,0x884444cc,0x2e171739,
+0x93c4c457,0x55a7a7f2,0xfc7e7e82,0x7a3d3d47,0xc86464ac,0xba5d5de7,0x3219192b,0xe6737395,
+0xc06060a0,0x19818198,0x9e4f4fd1,0xa3dcdc7f,0x44222266,0x542a2a7e,0x3b9090ab,0x0b888883,
+0x8c4646ca,0xc7eeee29,0x6bb8b8d3,0x2814143c,0xa7dede79,0xbc5e5ee2,0x160b0b1d,0xaddbdb76,
+0xdbe0e03b,0x64323256,0x743a3a4e,0x140a0a1e,0x924949db,0x0c06060a,0x4824246c,0xb85c5ce4,
+0x9fc2c25d,0xbdd3d36e,0x43acacef,0xc46262a6,0x399191a8,0x319595a4,0xd3e4e437,0xf279798b,
+0xd5e7e732,0x8bc8c843,0x6e373759,0xda6d6db7,0x018d8d8c,0xb1d5d564,0x9c4e4ed2,0x49a9a9e0,
+0xd86c6cb4,0xac5656fa,0xf3f4f407,0xcfeaea25,0xca6565af,0xf47a7a8e,0x47aeaee9,0x10080818,
+0x6fbabad5,0xf0787888,0x4a25256f,0x5c2e2e72,0x381c1c24,0x57a6a6f1,0x73b4b4c7,0x97c6c651,
+0xcbe8e823,0xa1dddd7c,0xe874749c,0x3e1f1f21,0x964b4bdd,0x61bdbddc,0x0d8b8b86,0x0f8a8a85,
+0xe0707090,0x7c3e3e42,0x71b5b5c4,0xcc6666aa,0x904848d8,0x06030305,0xf7f6f601,0x1c0e0e12,
+0xc26161a3,0x6a35355f,0xae5757f9,0x69b9b9d0,0x17868691,0x99c1c158,0x3a1d1d27,0x279e9eb9,
+0xd9e1e138,0xebf8f813,0x2b9898b3,0x22111133,0xd26969bb,0xa9d9d970,0x078e8e89,0x339494a7,
+0x2d9b9bb6,0x3c1e1e22,0x15878792,0xc9e9e920,0x87cece49,0xaa5555ff,0x50282878,0xa5dfdf7a,
+0x038c8c8f,0x59a1a1f8,0x09898980,0x1a0d0d17,0x65bfbfda,0xd7e6e631,0x844242c6,0xd06868b8,
+0x824141c3,0x299999b0,0x5a2d2d77,0x1e0f0f11,0x7bb0b0cb,0xa85454fc,0x6dbbbbd6,0x2c16163a
+};
+
+/* 암호화 T-table 1: S-box와 MixColumns 계수 (03,02,01,01)를 결합한 32비트 워드 */
+static const uint32_t Te1[256] = {
+0xa5c66363,0x84f87c7c,0x99ee7777,0x8df67b7b,0x0dfff2f2,0xbdd66b6b,0xb1de6f6f,0x5491c5c5,
+0x50603030,0x03020101,0xa9ce6767,0x7d562b2b,0x19e7fefe,0x62b5d7d7,0xe64dabab,0x9aec7676,
+0x458fcaca,0x9d1f8282,0x4089c9c9,0x87fa7d7d,0x15effafa,0xebb25959,0xc98e4747,0x0bfbf0f0,
+0xec41adad,0x67b3d4d4,0xfd5fa2a2,0xea45afaf,0xbf239c9c,0xf753a4a4,0x96e47272,0x5b9bc0c0,
+0xc275b7b7,0x1ce1fdfd,0xae3d9393,0x6a4c2626,0x5a6c3636,0x417e3f3f,0x02f5f7f7,0x4f83cccc,
+0x5c683434,0xf451a5a5,0x34d1e5e5,0x08f9f1f1,0x93e27171,0x73abd8d8,0x53623131,0x3f2a1515,
+0x0c080404,0x5295c7c7,0x65462323,0x5e9dc3c3,0x28301818,0xa1379696,0x0f0a0505,0xb52f9a9a,
+0x090e0707,0x36241212,0x9b1b8080,0x3ddfe2e2,0x26cdebeb,0x694e2727,0xcd7fb2b2,0x9fea7575,
+0x1b120909,0x9e1d8383,0x74582c2c,0x2e341a1a,0x2d361b1b,0xb2dc6e6e,0xeeb45a5a,0xfb5ba0a0,
+0xf6a45252,0x4d763b3b,0x61b7d6d6,0xce7db3b3,0x7b522929,0x3edde3e3,0x715e2f2f,0x97138484,
+0xf5a65353,0x68b9d1d1,0x00000000,0x2cc1eded,0x60402020,0x1fe3fcfc,0xc879b1b1,0xedb65b5b,
+0xbed46a6a,0x468dcbcb,0xd967bebe,0x4b723939,0xde944a4a,0xd4984c4c,0xe8b05858,0x4a85cfcf,
+0x6bbbd0d0,0x2ac5efef,0xe54faaaa,0x16edfbfb,0xc5864343,0xd79a4d4d,0x55663333,0x94118585,
+0xcf8a4545,0x10e9f9f9,0x06040202,0x81fe7f7f,0xf0a05050,0x44783c3c,0xba259f9f,0xe34ba8a8,
+0xf3a25151,0xfe5da3a3,0xc0804040,0x8a058f8f,0xad3f9292,0xbc219d9d,0x48703838,0x04f1f5f5,
+0xdf63bcbc,0xc177b6b6,0x75afdada,0x63422121,0x30201010,0x1ae5ffff,0x0efdf3f3,0x6dbfd2d2,
+0x4c81cdcd,0x14180c0c,0x35261313,0x2fc3ecec,0xe1be5f5f,0xa2359797,0xcc884444,0x392e1717,
+0x5793c4c4,0xf255a7a7,0x82fc7e7e,0x477a3d3d,0xacc86464,0xe7ba5d5d,0x2b321919,0x95e67373,
+0xa0c06060,0x98198181,0xd19e4f4f,0x7fa3dcdc,0x66442222,0x7e542a2a,0xab3b9090,0x830b8888,
+0xca8c4646,0x29c7eeee,0xd36bb8b8,0x3c281414,0x79a7dede,0xe2bc5e5e,0x1d160b0b,0x76addbdb,
+0x3bdbe0e0,0x56643232,0x4e743a3a,0x1e140a0a,0xdb924949,0x0a0c0606,0x6c482424,0xe4b85c5c,
+0x5d9fc2c2,0x6ebdd3d3,0xef43acac,0xa6c46262,0xa8399191,0xa4319595,0x37d3e4e4,0x8bf27979,
+0x32d5e7e7,0x438bc8c8,0x596e3737,0xb7da6d6d,0x8c018d8d,0x64b1d5d5,0xd29c4e4e,0xe049a9a9,
+0xb4d86c6c,0xfaac5656,0x07f3f4f4,0x25cfeaea,0xafca6565,0x8ef47a7a,0xe947aeae,0x18100808,
+0xd56fbaba,0x88f07878,0x6f4a2525,0x725c2e2e,0x24381c1c,0xf157a6a6,0xc773b4b4,0x5197c6c6,
+0x23cbe8e8,0x7ca1dddd,0x9ce87474,0x213e1f1f,0xdd964b4b,0xdc61bdbd,0x860d8b8b,0x850f8a8a,
+0x90e07070,0x427c3e3e,0xc471b5b5,0xaacc6666,0xd8904848,0x05060303,0x01f7f6f6,0x121c0e0e,
+0xa3c26161,0x5f6a3535,0xf9ae5757,0xd069b9b9,0x91178686,0x5899c1c1,0x273a1d1d,0xb9279e9e,
+0x38d9e1e1,0x13ebf8f8,0xb32b9898,0x33221111,0xbbd26969,0x70a9d9d9,0x89078e8e,0xa7339494,
+0xb62d9b9b,0x223c1e1e,0x92158787,0x20c9e9e9,0x4987cece,0xffaa5555,0x78502828,0x7aa5dfdf,
+0x8f038c8c,0xf859a1a1,0x80098989,0x171a0d0d,0xda65bfbf,0x31d7e6e6,0xc6844242,0xb8d06868,
+0xc3824141,0xb0299999,0x775a2d2d,0x111e0f0f,0xcb7bb0b0,0xfca85454,0xd66dbbbb,0x3a2c1616
+};
+
+/* 암호화 T-table 2: S-box와 MixColumns 계수 (01,03,02,01)를 결합한 32비트 워드 */
+static const uint32_t Te2[256] = {
+0x63a5c663,0x7c84f87c,0x7799ee77,0x7b8df67b,0xf20dfff2,0x6bbdd66b,0x6fb1de6f,0xc55491c5,
+0x30506030,0x01030201,0x67a9ce67,0x2b7d562b,0xfe19e7fe,0xd762b5d7,0xabe64dab,0x769aec76,
+0xca458fca,0x829d1f82,0xc94089c9,0x7d87fa7d,0xfa15effa,0x59ebb259,0x47c98e47,0xf00bfbf0,
+0xadec41ad,0xd467b3d4,0xa2fd5fa2,0xafea45af,0x9cbf239c,0xa4f753a4,0x7296e472,0xc05b9bc0,
+0xb7c275b7,0xfd1ce1fd,0x93ae3d93,0x266a4c26,0x365a6c36,0x3f417e3f,0xf702f5f7,0xcc4f83cc,
+0x345c6834,0xa5f451a5,0xe534d1e5,0xf108f9f1,0x7193e271,0xd873abd8,0x31536231,0x153f2a15,
+0x040c0804,0xc75295c7,0x23654623,0xc35e9dc3,0x18283018,0x96a13796,0x050f0a05,0x9ab52f9a,
+0x07090e07,0x12362412,0x809b1b80,0xe23ddfe2,0xeb26cdeb,0x27694e27,0xb2cd7fb2,0x759fea75,
+0x091b1209,0x839e1d83,0x2c74582c,0x1a2e341a,0x1b2d361b,0x6eb2dc6e,0x5aeeb45a,0xa0fb5ba0,
+0x52f6a452,0x3b4d763b,0xd661b7d6,0xb3ce7db3,0x297b5229,0xe33edde3,0x2f715e2f,0x84971384,
+0x53f5a653,0xd168b9d1,0x00000000,0xed2cc1ed,0x20604020,0xfc1fe3fc,0xb1c879b1,0x5bedb65b,
+0x6abed46a,0xcb468dcb,0xbed967be,0x394b7239,0x4ade944a,0x4cd4984c,0x58e8b058,0xcf4a85cf,
+0xd06bbbd0,0xef2ac5ef,0xaae54faa,0xfb16edfb,0x43c58643,0x4dd79a4d,0x33556633,0x85941185,
+0x45cf8a45,0xf910e9f9,0x02060402,0x7f81fe7f,0x50f0a050,0x3c44783c,0x9fba259f,0xa8e34ba8,
+0x51f3a251,0xa3fe5da3,0x40c08040,0x8f8a058f,0x92ad3f92,0x9dbc219d,0x38487038,0xf504f1f5,
+0xbcdf63bc,0xb6c177b6,0xda75afda,0x21634221,0x10302010,0xff1ae5ff,0xf30efdf3,0xd26dbfd2,
+0xcd4c81cd,0x0c14180c,0x13352613,0xec2fc3ec,0x5fe1be5f,0x97a23597,0x44cc8844,0x17392e17,
+0xc45793c4,0xa7f255a7,0x7e82fc7e,0x3d477a3d,0x64acc864,0x5de7ba5d,0x192b3219,0x7395e673,
+0x60a0c060,0x81981981,0x4fd19e4f,0xdc7fa3dc,0x22664422,0x2a7e542a,0x90ab3b90,0x88830b88,
+0x46ca8c46,0xee29c7ee,0xb8d36bb8,0x143c2814,0xde79a7de,0x5ee2bc5e,0x0b1d160b,0xdb76addb,
+0xe03bdbe0,0x32566432,0x3a4e743a,0x0a1e140a,0x49db9249,0x060a0c06,0x246c4824,0x5ce4b85c,
+0xc25d9fc2,0xd36ebdd3,0xacef43ac,0x62a6c462,0x91a83991,0x95a43195,0xe437d3e4,0x798bf279,
+0xe732d5e7,0xc8438bc8,0x37596e37,0x6db7da6d,0x8d8c018d,0xd564b1d5,0x4ed29c4e,0xa9e049a9,
+0x6cb4d86c,0x56faac56,0xf407f3f4,0xea25cfea,0x65afca65,0x7a8ef47a,0xaee947ae,0x08181008,
+0xbad56fba,0x7888f078,0x256f4a25,0x2e725c2e,0x1c24381c,0xa6f157a6,0xb4c773b4,0xc65197c6,
+0xe823cbe8,0xdd7ca1dd,0x749ce874,0x1f213e1f,0x4bdd964b,0xbddc61bd,0x8b860d8b,0x8a850f8a,
+0x7090e070,0x3e427c3e,0xb5c471b5,0x66aacc66,0x48d89048,0x03050603,0xf601f7f6,0x0e121c0e,
+0x61a3c261,0x355f6a35,0x57f9ae57,0xb9d069b9,0x86911786,0xc15899c1,0x1d273a1d,0x9eb9279e,
+0xe138d9e1,0xf813ebf8,0x98b32b98,0x11332211,0x69bbd269,0xd970a9d9,0x8e89078e,0x94a73394,
+0x9bb62d9b,0x1e223c1e,0x87921587,0xe920c9e9,0xce4987ce,0x55ffaa55,0x28785028,0xdf7aa5df,
+0x8c8f038c,0xa1f859a1,0x89800989,0x0d171a0d,0xbfda65bf,0xe631d7e6,0x42c68442,0x68b8d068,
+0x41c38241,0x99b02999,0x2d775a2d,0x0f111e0f,0xb0cb7bb0,0x54fca854,0xbbd66dbb,0x163a2c16
+};
+
+/* 암호화 T-table 3: S-box와 MixColumns 계수 (01,01,03,02)를 결합한 32비트 워드 */
+static const uint32_t Te3[256] = {
+0x6363a5c6,0x7c7c84f8,0x777799ee,0x7b7b8df6,0xf2f20dff,0x6b6bbdd6,0x6f6fb1de,0xc5c55491,
+0x30305060,0x01010302,0x6767a9ce,0x2b2b7d56,0xfefe19e7,0xd7d762b5,0xababe64d,0x76769aec,
+0xcaca458f,0x82829d1f,0xc9c94089,0x7d7d87fa,0xfafa15ef,0x5959ebb2,0x4747c98e,0xf0f00bfb,
+0xadadec41,0xd4d467b3,0xa2a2fd5f,0xafafea45,0x9c9cbf23,0xa4a4f753,0x727296e4,0xc0c05b9b,
+0xb7b7c275,0xfdfd1ce1,0x9393ae3d,0x26266a4c,0x36365a6c,0x3f3f417e,0xf7f702f5,0xcccc4f83,
+0x34345c68,0xa5a5f451,0xe5e534d1,0xf1f108f9,0x717193e2,0xd8d873ab,0x31315362,0x15153f2a,
+0x04040c08,0xc7c75295,0x23236546,0xc3c35e9d,0x18182830,0x9696a137,0x05050f0a,0x9a9ab52f,
+0x0707090e,0x12123624,0x80809b1b,0xe2e23ddf,0xebeb26cd,0x2727694e,0xb2b2cd7f,0x75759fea,
+0x09091b12,0x83839e1d,0x2c2c7458,0x1a1a2e34,0x1b1b2d36,0x6e6eb2dc,0x5a5aeeb4,0xa0a0fb5b,
+0x5252f6a4,0x3b3b4d76,0xd6d661b7,0xb3b3ce7d,0x29297b52,0xe3e33edd,0x2f2f715e,0x84849713,
+0x5353f5a6,0xd1d168b9,0x00000000,0xeded2cc1,0x20206040,0xfcfc1fe3,0xb1b1c879,0x5b5bedb6,
+0x6a6abed4,0xcbcb468d,0xbebed967,0x39394b72,0x4a4ade94,0x4c4cd498,0x5858e8b0,0xcfcf4a85,
+0xd0d06bbb,0xefef2ac5,0xaaaae54f,0xfbfb16ed,0x4343c586,0x4d4dd79a,0x33335566,0x85859411,
+0x4545cf8a,0xf9f910e9,0x02020604,0x7f7f81fe,0x5050f0a0,0x3c3c4478,0x9f9fba25,0xa8a8e34b,
+0x5151f3a2,0xa3a3fe5d,0x4040c080,0x8f8f8a05,0x9292ad3f,0x9d9dbc21,0x38384870,0xf5f504f1,
+0xbcbcdf63,0xb6b6c177,0xdada75af,0x21216342,0x10103020,0xffff1ae5,0xf3f30efd,0xd2d26dbf,
+0xcdcd4c81,0x0c0c1418,0x13133526,0xecec2fc3,0x5f5fe1be,0x9797a235,0x4444cc88,0x1717392e,
+0xc4c45793,0xa7a7f255,0x7e7e82fc,0x3d3d477a,0x6464acc8,0x5d5de7ba,0x19192b32,0x737395e6,
+0x6060a0c0,0x81819819,0x4f4fd19e,0xdcdc7fa3,0x22226644,0x2a2a7e54,0x9090ab3b,0x8888830b,
+0x4646ca8c,0xeeee29c7,0xb8b8d36b,0x14143c28,0xdede79a7,0x5e5ee2bc,0x0b0b1d16,0xdbdb76ad,
+0xe0e03bdb,0x32325664,0x3a3a4e74,0x0a0a1e14,0x4949db92,0x06060a0c,0x24246c48,0x5c5ce4b8,
+0xc2c25d9f,0xd3d36ebd,0xacacef43,0x6262a6c4,0x9191a839,0x9595a431,0xe4e437d3,0x79798bf2,
+0xe7e732d5,0xc8c8438b,0x3737596e,0x6d6db7da,0x8d8d8c01,0xd5d564b1,0x4e4ed29c,0xa9a9e049,
+0x6c6cb4d8,0x5656faac,0xf4f407f3,0xeaea25cf,0x6565afca,0x7a7a8ef4,0xaeaee947,0x08081810,
+0xbabad56f,0x787888f0,0x25256f4a,0x2e2e725c,0x1c1c2438,0xa6a6f157,0xb4b4c773,0xc6c65197,
+0xe8e823cb,0xdddd7ca1,0x74749ce8,0x1f1f213e,0x4b4bdd96,0xbdbddc61,0x8b8b860d,0x8a8a850f,
+0x707090e0,0x3e3e427c,0xb5b5c471,0x6666aacc,0x4848d890,0x03030506,0xf6f601f7,0x0e0e121c,
+0x6161a3c2,0x35355f6a,0x5757f9ae,0xb9b9d069,0x86869117,0xc1c15899,0x1d1d273a,0x9e9eb927,
+0xe1e138d9,0xf8f813eb,0x9898b32b,0x11113322,0x6969bbd2,0xd9d970a9,0x8e8e8907,0x9494a733,
+0x9b9bb62d,0x1e1e223c,0x87879215,0xe9e920c9,0xcece4987,0x5555ffaa,0x28287850,0xdfdf7aa5,
+0x8c8c8f03,0xa1a1f859,0x89898009,0x0d0d171a,0xbfbfda65,0xe6e631d7,0x4242c684,0x6868b8d0,
+0x4141c382,0x9999b029,0x2d2d775a,0x0f0f111e,0xb0b0cb7b,0x5454fca8,0xbbbbd66d,0x16163a2c
+};
+
+/* 복호화 T-table 0: 역 S-box와 InvMixColumns 계수 (0e,09,0d,0b)를 결합한 32비트 워드 */
+static const uint32_t Td0[256] = {
+0x51f4a750,0x7e416553,0x1a17a4c3,0x3a275e96,0x3bab6bcb,0x1f9d45f1,0xacfa58ab,0x4be30393,
+0x2030fa55,0xad766df6,0x88cc7691,0xf5024c25,0x4fe5d7fc,0xc52acbd7,0x26354480,0xb562a38f,
+0xdeb15a49,0x25ba1b67,0x45ea0e98,0x5dfec0e1,0xc32f7502,0x814cf012,0x8d4697a3,0x6bd3f9c6,
+0x038f5fe7,0x15929c95,0xbf6d7aeb,0x955259da,0xd4be832d,0x587421d3,0x49e06929,0x8ec9c844,
+0x75c2896a,0xf48e7978,0x99583e6b,0x27b971dd,0xbee14fb6,0xf088ad17,0xc920ac66,0x7dce3ab4,
+0x63df4a18,0xe51a3182,0x97513360,0x62537f45,0xb16477e0,0xbb6bae84,0xfe81a01c,0xf9082b94,
+0x70486858,0x8f45fd19,0x94de6c87,0x527bf8b7,0xab73d323,0x724b02e2,0xe31f8f57,0x6655ab2a,
+0xb2eb2807,0x2fb5c203,0x86c57b9a,0xd33708a5,0x302887f2,0x23bfa5b2,0x02036aba,0xed16825c,
+0x8acf1c2b,0xa779b492,0xf307f2f0,0x4e69e2a1,0x65daf4cd,0x0605bed5,0xd134621f,0xc4a6fe8a,
+0x342e539d,0xa2f355a0,0x058ae132,0xa4f6eb75,0x0b83ec39,0x4060efaa,0x5e719f06,0xbd6e1051,
+0x3e218af9,0x96dd063d,0xdd3e05ae,0x4de6bd46,0x91548db5,0x71c45d05,0x0406d46f,0x605015ff,
+0x1998fb24,0xd6bde997,0x894043cc,0x67d99e77,0xb0e842bd,0x07898b88,0xe7195b38,0x79c8eedb,
+0xa17c0a47,0x7c420fe9,0xf8841ec9,0x00000000,0x09808683,0x322bed48,0x1e1170ac,0x6c5a724e,
+0xfd0efffb,0x0f853856,0x3daed51e,0x362d3927,0x0a0fd964,0x685ca621,0x9b5b54d1,0x24362e3a,
+0x0c0a67b1,0x9357e70f,0xb4ee96d2,0x1b9b919e,0x80c0c54f,0x61dc20a2,0x5a774b69,0x1c121a16,
+0xe293ba0a,0xc0a02ae5,0x3c22e043,0x121b171d,0x0e090d0b,0xf28bc7ad,0x2db6a8b9,0x141ea9c8,
+0x57f11985,0xaf75074c,0xee99ddbb,0xa37f60fd,0xf701269f,0x5c72f5bc,0x44663bc5,0x5bfb7e34,
+0x8b432976,0xcb23c6dc,0xb6edfc68,0xb8e4f163,0xd731dcca,0x42638510,0x13972240,0x84c61120,
+0x854a247d,0xd2bb3df8,0xaef93211,0xc729a16d,0x1d9e2f4b,0xdcb230f3,0x0d8652ec,0x77c1e3d0,
+0x2bb3166c,0xa970b999,0x119448fa,0x47e96422,0xa8fc8cc4,0xa0f03f1a,0x567d2cd8,0x223390ef,
+0x87494ec7,0xd938d1c1,0x8ccaa2fe,0x98d40b36,0xa6f581cf,0xa57ade28,0xdab78e26,0x3fadbfa4,
+0x2c3a9de4,0x5078920d,0x6a5fcc9b,0x547e4662,0xf68d13c2,0x90d8b8e8,0x2e39f75e,0x82c3aff5,
+0x9f5d80be,0x69d0937c,0x6fd52da9,0xcf2512b3,0xc8ac993b,0x10187da7,0xe89c636e,0xdb3bbb7b,
+0xcd267809,0x6e5918f4,0xec9ab701,0x834f9aa8,0xe6956e65,0xaaffe67e,0x21bccf08,0xef15e8e6,
+0xbae79bd9,0x4a6f36ce,0xea9f09d4,0x29b07cd6,0x31a4b2af,0x2a3f2331,0xc6a59430,0x35a266c0,
+0x744ebc37,0xfc82caa6,0xe090d0b0,0x33a7d815,0xf104984a,0x41ecdaf7,0x7fcd500e,0x1791f62f,
+0x764dd68d,0x43efb04d,0xccaa4d54,0xe49604df,0x9ed1b5e3,0x4c6a881b,0xc12c1fb8,0x4665517f,
+0x9d5eea04,0x018c355d,0xfa877473,0xfb0b412e,0xb3671d5a,0x92dbd252,0xe9105633,0x6dd64713,
+0x9ad7618c,0x37a10c7a,0x59f8148e,0xeb133c89,0xcea927ee,0xb761c935,0xe11ce5ed,0x7a47b13c,
+0x9cd2df59,0x55f2733f,0x1814ce79,0x73c737bf,0x53f7cdea,0x5ffdaa5b,0xdf3d6f14,0x7844db86,
+0xcaaff381,0xb968c43e,0x3824342c,0xc2a3405f,0x161dc372,0xbce2250c,0x283c498b,0xff0d9541,
+0x39a80171,0x080cb3de,0xd8b4e49c,0x6456c190,0x7bcb8461,0xd532b670,0x486c5c74,0xd0b85742
+};
+
+/* 복호화 T-table 1: 역 S-box와 InvMixColumns 계수 (0b,0e,09,0d)를 결합한 32비트 워드 */
+static const uint32_t Td1[256] = {
+0x5051f4a7,0x537e4165,0xc31a17a4,0x963a275e,0xcb3bab6b,0xf11f9d45,0xabacfa58,0x934be303,
+0x552030fa,0xf6ad766d,0x9188cc76,0x25f5024c,0xfc4fe5d7,0xd7c52acb,0x80263544,0x8fb562a3,
+0x49deb15a,0x6725ba1b,0x9845ea0e,0xe15dfec0,0x02c32f75,0x12814cf0,0xa38d4697,0xc66bd3f9,
+0xe7038f5f,0x9515929c,0xebbf6d7a,0xda955259,0x2dd4be83,0xd3587421,0x2949e069,0x448ec9c8,
+0x6a75c289,0x78f48e79,0x6b99583e,0xdd27b971,0xb6bee14f,0x17f088ad,0x66c920ac,0xb47dce3a,
+0x1863df4a,0x82e51a31,0x60975133,0x4562537f,0xe0b16477,0x84bb6bae,0x1cfe81a0,0x94f9082b,
+0x58704868,0x198f45fd,0x8794de6c,0xb7527bf8,0x23ab73d3,0xe2724b02,0x57e31f8f,0x2a6655ab,
+0x07b2eb28,0x032fb5c2,0x9a86c57b,0xa5d33708,0xf2302887,0xb223bfa5,0xba02036a,0x5ced1682,
+0x2b8acf1c,0x92a779b4,0xf0f307f2,0xa14e69e2,0xcd65daf4,0xd50605be,0x1fd13462,0x8ac4a6fe,
+0x9d342e53,0xa0a2f355,0x32058ae1,0x75a4f6eb,0x390b83ec,0xaa4060ef,0x065e719f,0x51bd6e10,
+0xf93e218a,0x3d96dd06,0xaedd3e05,0x464de6bd,0xb591548d,0x0571c45d,0x6f0406d4,0xff605015,
+0x241998fb,0x97d6bde9,0xcc894043,0x7767d99e,0xbdb0e842,0x8807898b,0x38e7195b,0xdb79c8ee,
+0x47a17c0a,0xe97c420f,0xc9f8841e,0x00000000,0x83098086,0x48322bed,0xac1e1170,0x4e6c5a72,
+0xfbfd0eff,0x560f8538,0x1e3daed5,0x27362d39,0x640a0fd9,0x21685ca6,0xd19b5b54,0x3a24362e,
+0xb10c0a67,0x0f9357e7,0xd2b4ee96,0x9e1b9b91,0x4f80c0c5,0xa261dc20,0x695a774b,0x161c121a,
+0x0ae293ba,0xe5c0a02a,0x433c22e0,0x1d121b17,0x0b0e090d,0xadf28bc7,0xb92db6a8,0xc8141ea9,
+0x8557f119,0x4caf7507,0xbbee99dd,0xfda37f60,0x9ff70126,0xbc5c72f5,0xc544663b,0x345bfb7e,
+0x768b4329,0xdccb23c6,0x68b6edfc,0x63b8e4f1,0xcad731dc,0x10426385,0x40139722,0x2084c611,
+0x7d854a24,0xf8d2bb3d,0x11aef932,0x6dc729a1,0x4b1d9e2f,0xf3dcb230,0xec0d8652,0xd077c1e3,
+0x6c2bb316,0x99a970b9,0xfa119448,0x2247e964,0xc4a8fc8c,0x1aa0f03f,0xd8567d2c,0xef223390,
+0xc787494e,0xc1d938d1,0xfe8ccaa2,0x3698d40b,0xcfa6f581,0x28a57ade,0x26dab78e,0xa43fadbf,
+0xe42c3a9d,0x0d507892,0x9b6a5fcc,0x62547e46,0xc2f68d13,0xe890d8b8,0x5e2e39f7,0xf582c3af,
+0xbe9f5d80,0x7c69d093,0xa96fd52d,0xb3cf2512,0x3bc8ac99,0xa710187d,0x6ee89c63,0x7bdb3bbb,
+0x09cd2678,0xf46e5918,0x01ec9ab7,0xa8834f9a,0x65e6956e,0x7eaaffe6,0x0821bccf,0xe6ef15e8,
+0xd9bae79b,0xce4a6f36,0xd4ea9f09,0xd629b07c,0xaf31a4b2,0x312a3f23,0x30c6a594,0xc035a266,
+0x37744ebc,0xa6fc82ca,0xb0e090d0,0x1533a7d8,0x4af10498,0xf741ecda,0x0e7fcd50,0x2f1791f6,
+0x8d764dd6,0x4d43efb0,0x54ccaa4d,0xdfe49604,0xe39ed1b5,0x1b4c6a88,0xb8c12c1f,0x7f466551,
+0x049d5eea,0x5d018c35,0x73fa8774,0x2efb0b41,0x5ab3671d,0x5292dbd2,0x33e91056,0x136dd647,
+0x8c9ad761,0x7a37a10c,0x8e59f814,0x89eb133c,0xeecea927,0x35b761c9,0xede11ce5,0x3c7a47b1,
+0x599cd2df,0x3f55f273,0x791814ce,0xbf73c737,0xea53f7cd,0x5b5ffdaa,0x14df3d6f,0x867844db,
+0x81caaff3,0x3eb968c4,0x2c382434,0x5fc2a340,0x72161dc3,0x0cbce225,0x8b283c49,0x41ff0d95,
+0x7139a801,0xde080cb3,0x9cd8b4e4,0x906456c1,0x617bcb84,0x70d532b6,0x74486c5c,0x42d0b857
+};
+
+/* 복호화 T-table 2: 역 S-box와 InvMixColumns 계수 (0d,0b,0e,09)를 결합한 32비트 워드 */
+static const uint32_t Td2[256] = {
+0xa75051f4,0x65537e41,0xa4c31a17,0x5e963a27,0x6bcb3bab,0x45f11f9d,0x58abacfa,0x03934be3,
+0xfa552030,0x6df6ad76,0x769188cc,0x4c25f502,0xd7fc4fe5,0xcbd7c52a,0x44802635,0xa38fb562,
+0x5a49deb1,0x1b6725ba,0x0e9845ea,0xc0e15dfe,0x7502c32f,0xf012814c,0x97a38d46,0xf9c66bd3,
+0x5fe7038f,0x9c951592,0x7aebbf6d,0x59da9552,0x832dd4be,0x21d35874,0x692949e0,0xc8448ec9,
+0x896a75c2,0x7978f48e,0x3e6b9958,0x71dd27b9,0x4fb6bee1,0xad17f088,0xac66c920,0x3ab47dce,
+0x4a1863df,0x3182e51a,0x33609751,0x7f456253,0x77e0b164,0xae84bb6b,0xa01cfe81,0x2b94f908,
+0x68587048,0xfd198f45,0x6c8794de,0xf8b7527b,0xd323ab73,0x02e2724b,0x8f57e31f,0xab2a6655,
+0x2807b2eb,0xc2032fb5,0x7b9a86c5,0x08a5d337,0x87f23028,0xa5b223bf,0x6aba0203,0x825ced16,
+0x1c2b8acf,0xb492a779,0xf2f0f307,0xe2a14e69,0xf4cd65da,0xbed50605,0x621fd134,0xfe8ac4a6,
+0x539d342e,0x55a0a2f3,0xe132058a,0xeb75a4f6,0xec390b83,0xefaa4060,0x9f065e71,0x1051bd6e,
+0x8af93e21,0x063d96dd,0x05aedd3e,0xbd464de6,0x8db59154,0x5d0571c4,0xd46f0406,0x15ff6050,
+0xfb241998,0xe997d6bd,0x43cc8940,0x9e7767d9,0x42bdb0e8,0x8b880789,0x5b38e719,0xeedb79c8,
+0x0a47a17c,0x0fe97c42,0x1ec9f884,0x00000000,0x86830980,0xed48322b,0x70ac1e11,0x724e6c5a,
+0xfffbfd0e,0x38560f85,0xd51e3dae,0x3927362d,0xd9640a0f,0xa621685c,0x54d19b5b,0x2e3a2436,
+0x67b10c0a,0xe70f9357,0x96d2b4ee,0x919e1b9b,0xc54f80c0,0x20a261dc,0x4b695a77,0x1a161c12,
+0xba0ae293,0x2ae5c0a0,0xe0433c22,0x171d121b,0x0d0b0e09,0xc7adf28b,0xa8b92db6,0xa9c8141e,
+0x198557f1,0x074caf75,0xddbbee99,0x60fda37f,0x269ff701,0xf5bc5c72,0x3bc54466,0x7e345bfb,
+0x29768b43,0xc6dccb23,0xfc68b6ed,0xf163b8e4,0xdccad731,0x85104263,0x22401397,0x112084c6,
+0x247d854a,0x3df8d2bb,0x3211aef9,0xa16dc729,0x2f4b1d9e,0x30f3dcb2,0x52ec0d86,0xe3d077c1,
+0x166c2bb3,0xb999a970,0x48fa1194,0x642247e9,0x8cc4a8fc,0x3f1aa0f0,0x2cd8567d,0x90ef2233,
+0x4ec78749,0xd1c1d938,0xa2fe8cca,0x0b3698d4,0x81cfa6f5,0xde28a57a,0x8e26dab7,0xbfa43fad,
+0x9de42c3a,0x920d5078,0xcc9b6a5f,0x4662547e,0x13c2f68d,0xb8e890d8,0xf75e2e39,0xaff582c3,
+0x80be9f5d,0x937c69d0,0x2da96fd5,0x12b3cf25,0x993bc8ac,0x7da71018,0x636ee89c,0xbb7bdb3b,
+0x7809cd26,0x18f46e59,0xb701ec9a,0x9aa8834f,0x6e65e695,0xe67eaaff,0xcf0821bc,0xe8e6ef15,
+0x9bd9bae7,0x36ce4a6f,0x09d4ea9f,0x7cd629b0,0xb2af31a4,0x23312a3f,0x9430c6a5,0x66c035a2,
+0xbc37744e,0xcaa6fc82,0xd0b0e090,0xd81533a7,0x984af104,0xdaf741ec,0x500e7fcd,0xf62f1791,
+0xd68d764d,0xb04d43ef,0x4d54ccaa,0x04dfe496,0xb5e39ed1,0x881b4c6a,0x1fb8c12c,0x517f4665,
+0xea049d5e,0x355d018c,0x7473fa87,0x412efb0b,0x1d5ab367,0xd25292db,0x5633e910,0x47136dd6,
+0x618c9ad7,0x0c7a37a1,0x148e59f8,0x3c89eb13,0x27eecea9,0xc935b761,0xe5ede11c,0xb13c7a47,
+0xdf599cd2,0x733f55f2,0xce791814,0x37bf73c7,0xcdea53f7,0xaa5b5ffd,0x6f14df3d,0xdb867844,
+0xf381caaf,0xc43eb968,0x342c3824,0x405fc2a3,0xc372161d,0x250cbce2,0x498b283c,0x9541ff0d,
+0x017139a8,0xb3de080c,0xe49cd8b4,0xc1906456,0x84617bcb,0xb670d532,0x5c74486c,0x5742d0b8
+};
+
+/* 복호화 T-table 3: 역 S-box와 InvMixColumns 계수 (09,0d,0b,0e)를 결합한 32비트 워드 */
+static const uint32_t Td3[256] = {
+0xf4a75051,0x4165537e,0x17a4c31a,0x275e963a,0xab6bcb3b,0x9d45f11f,0xfa58abac,0xe303934b,
+0x30fa5520,0x766df6ad,0xcc769188,0x024c25f5,0xe5d7fc4f,0x2acbd7c5,0x35448026,0x62a38fb5,
+0xb15a49de,0xba1b6725,0xea0e9845,0xfec0e15d,0x2f7502c3,0x4cf01281,0x4697a38d,0xd3f9c66b,
+0x8f5fe703,0x929c9515,0x6d7aebbf,0x5259da95,0xbe832dd4,0x7421d358,0xe0692949,0xc9c8448e,
+0xc2896a75,0x8e7978f4,0x583e6b99,0xb971dd27,0xe14fb6be,0x88ad17f0,0x20ac66c9,0xce3ab47d,
+0xdf4a1863,0x1a3182e5,0x51336097,0x537f4562,0x6477e0b1,0x6bae84bb,0x81a01cfe,0x082b94f9,
+0x48685870,0x45fd198f,0xde6c8794,0x7bf8b752,0x73d323ab,0x4b02e272,0x1f8f57e3,0x55ab2a66,
+0xeb2807b2,0xb5c2032f,0xc57b9a86,0x3708a5d3,0x2887f230,0xbfa5b223,0x036aba02,0x16825ced,
+0xcf1c2b8a,0x79b492a7,0x07f2f0f3,0x69e2a14e,0xdaf4cd65,0x05bed506,0x34621fd1,0xa6fe8ac4,
+0x2e539d34,0xf355a0a2,0x8ae13205,0xf6eb75a4,0x83ec390b,0x60efaa40,0x719f065e,0x6e1051bd,
+0x218af93e,0xdd063d96,0x3e05aedd,0xe6bd464d,0x548db591,0xc45d0571,0x06d46f04,0x5015ff60,
+0x98fb2419,0xbde997d6,0x4043cc89,0xd99e7767,0xe842bdb0,0x898b8807,0x195b38e7,0xc8eedb79,
+0x7c0a47a1,0x420fe97c,0x841ec9f8,0x00000000,0x80868309,0x2bed4832,0x1170ac1e,0x5a724e6c,
+0x0efffbfd,0x8538560f,0xaed51e3d,0x2d392736,0x0fd9640a,0x5ca62168,0x5b54d19b,0x362e3a24,
+0x0a67b10c,0x57e70f93,0xee96d2b4,0x9b919e1b,0xc0c54f80,0xdc20a261,0x774b695a,0x121a161c,
+0x93ba0ae2,0xa02ae5c0,0x22e0433c,0x1b171d12,0x090d0b0e,0x8bc7adf2,0xb6a8b92d,0x1ea9c814,
+0xf1198557,0x75074caf,0x99ddbbee,0x7f60fda3,0x01269ff7,0x72f5bc5c,0x663bc544,0xfb7e345b,
+0x4329768b,0x23c6dccb,0xedfc68b6,0xe4f163b8,0x31dccad7,0x63851042,0x97224013,0xc6112084,
+0x4a247d85,0xbb3df8d2,0xf93211ae,0x29a16dc7,0x9e2f4b1d,0xb230f3dc,0x8652ec0d,0xc1e3d077,
+0xb3166c2b,0x70b999a9,0x9448fa11,0xe9642247,0xfc8cc4a8,0xf03f1aa0,0x7d2cd856,0x3390ef22,
+0x494ec787,0x38d1c1d9,0xcaa2fe8c,0xd40b3698,0xf581cfa6,0x7ade28a5,0xb78e26da,0xadbfa43f,
+0x3a9de42c,0x78920d50,0x5fcc9b6a,0x7e466254,0x8d13c2f6,0xd8b8e890,0x39f75e2e,0xc3aff582,
+0x5d80be9f,0xd0937c69,0xd52da96f,0x2512b3cf,0xac993bc8,0x187da710,0x9c636ee8,0x3bbb7bdb,
+0x267809cd,0x5918f46e,0x9ab701ec,0x4f9aa883,0x956e65e6,0xffe67eaa,0xbccf0821,0x15e8e6ef,
+0xe79bd9ba,0x6f36ce4a,0x9f09d4ea,0xb07cd629,0xa4b2af31,0x3f23312a,0xa59430c6,0xa266c035,
+0x4ebc3774,0x82caa6fc,0x90d0b0e0,0xa7d81533,0x04984af1,0xecdaf741,0xcd500e7f,0x91f62f17,
+0x4dd68d76,0xefb04d43,0xaa4d54cc,0x9604dfe4,0xd1b5e39e,0x6a881b4c,0x2c1fb8c1,0x65517f46,
+0x5eea049d,0x8c355d01,0x877473fa,0x0b412efb,0x671d5ab3,0xdbd25292,0x105633e9,0xd647136d,
+0xd7618c9a,0xa10c7a37,0xf8148e59,0x133c89eb,0xa927eece,0x61c935b7,0x1ce5ede1,0x47b13c7a,
+0xd2df599c,0xf2733f55,0x14ce7918,0xc737bf73,0xf7cdea53,0xfdaa5b5f,0x3d6f14df,0x44db8678,
+0xaff381ca,0x68c43eb9,0x24342c38,0xa3405fc2,0x1dc37216,0xe2250cbc,0x3c498b28,0x0d9541ff,
+0xa8017139,0x0cb3de08,0xb4e49cd8,0x56c19064,0xcb84617b,0x32b670d5,0x6c5c7448,0xb85742d0
+};
+
+/* 빅엔디언 32비트 워드 읽기/쓰기 (T-table 구현용) */
+static inline uint32_t load_be32(const uint8_t* p) {
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return __builtin_bswap32(v);
+#else
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+#endif
+}
+
+static inline void store_be32(uint8_t* p, uint32_t v) {
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    v = __builtin_bswap32(v);
+    memcpy(p, &v, 4);
+#else
+    p[0] = (uint8_t)(v >> 24); p[1] = (uint8_t)(v >> 16); p[2] = (uint8_t)(v >> 8); p[3] = (uint8_t)v;
+#endif
+}
+
+#define GETU32(p) load_be32(p)
+#define PUTU32(p, v) store_be32((p), (v))
+
+/*
+ * AES 상태 행렬 타입 (4x4 행렬)
+ * FIPS-197과 같이 열 우선(column-major)으로 저장됨: (*state)[c][r] = buf[c*4 + r]
+ */
 typedef uint8_t state_t[4][4];
 
 /**
@@ -69,17 +389,20 @@ static uint8_t xtime(uint8_t x) {
  */
 static void secure_memzero(void* p, size_t len) {
     if (p == NULL) return;
+#if defined(__GNUC__) || defined(__clang__)
+    /* memset 뒤의 메모리 배리어가 "쓴 값을 읽을 수 있음"을 알려 소거가 생략되지 않게 함 */
+    memset(p, 0, len);
+    __asm__ __volatile__("" : : "r"(p) : "memory");
+#else
     volatile uint8_t* vp = (volatile uint8_t*)p;
     while (len--) *vp++ = 0;
+#endif
 }
 
 /**
- * @brief 256비트 키를 사용하여 라운드 키를 생성함
- * @return 성공 시 0, 실패 시 -1
+ * @brief 256비트 키를 사용하여 라운드 키를 생성함 (소프트웨어 구현)
  */
-int KeyExpansion(uint8_t* RoundKey, const uint8_t* Key) {
-    if (RoundKey == NULL || Key == NULL) return -1;
-
+static void soft_key_expansion(uint8_t* RoundKey, const uint8_t* Key) {
     uint8_t tempa[4];
 
     /* 첫 번째 라운드 키는 원본 키와 동일함 */
@@ -133,10 +456,63 @@ int KeyExpansion(uint8_t* RoundKey, const uint8_t* Key) {
 
     /* 임시 버퍼 보안 소거 */
     secure_memzero(tempa, 4);
-    return 0;
 }
 
-/* ---------------- 암호화 연산 (Cipher Operations) ---------------- */
+
+/**
+ * @brief 등가 역암호(Equivalent Inverse Cipher)용 복호화 라운드 키를 생성함
+ * @details 라운드 순서를 뒤집고, 1~13라운드 키에는 InvMixColumns를 미리 적용함.
+ *          복호화 라운드가 암호화와 같은 구조(치환 -> 혼합 -> 키 XOR)가 되어
+ *          T-table 조회만으로 처리할 수 있음. (FIPS-197 5.3.5)
+ */
+static void soft_inv_key_expansion(uint8_t* DecKey, const uint8_t* RoundKey) {
+    for (int round = 0; round <= Nr; round++) {
+        const uint8_t* src = RoundKey + (Nr - round) * 16;
+        uint8_t* dst = DecKey + round * 16;
+
+        for (int i = 0; i < 16; i += 4) {
+            uint32_t w = GETU32(src + i);
+            if (round > 0 && round < Nr) {
+                /* Td[sbox[x]]는 x에 InvMixColumns 계수를 곱한 값과 같음 */
+                w = Td0[sbox[w >> 24]] ^ Td1[sbox[(w >> 16) & 0xff]] ^
+                    Td2[sbox[(w >> 8) & 0xff]] ^ Td3[sbox[w & 0xff]];
+            }
+            PUTU32(dst + i, w);
+        }
+    }
+}
+
+/* ---------------- 병렬 처리 설정 ---------------- */
+
+/* 블록 교차 루프를 완전히 펼쳐 블록 상태가 레지스터에 머물도록 함 */
+#if defined(__clang__)
+#define AES256_UNROLL _Pragma("clang loop unroll(full)")
+#else
+#define AES256_UNROLL _Pragma("GCC unroll 8")
+#endif
+
+/*
+ * 전역 설정 (백엔드, 교차 폭, 스레드 수, 분할 크기)
+ * - AES256_Set* / AES256_Autotune이 바꾸는 동안 비동기 작업, 파일 파이프라인, DRBG가
+ *   다른 스레드에서 읽을 수 있으므로 항상 원자적으로 읽고 씀 (쓰기는 release, 읽기는 acquire)
+ * - 호출 하나 안에서는 한 번 읽은 값(ops 등)을 계속 사용함
+ */
+#define AES256_CFG_LOAD(v)     __atomic_load_n(&(v), __ATOMIC_ACQUIRE)
+#define AES256_CFG_STORE(v, x) __atomic_store_n(&(v), (x), __ATOMIC_RELEASE)
+
+/* 한 번에 교차 처리할 블록 수 (1, 2, 4, 8) */
+static int aes256_interleave = 8;
+
+/* AES256_CBC_Decrypt가 사용할 스레드 수 (1이면 단일 스레드) */
+static int aes256_threads = 1;
+
+/* 스레드 하나가 맡는 최소 데이터 크기 (이보다 작으면 스레드 생성 비용이 더 큼) */
+#define AES256_SPLIT_DEFAULT (256 * 1024)
+#define AES256_SPLIT_MIN     (16 * 1024)
+#define AES256_SPLIT_MAX     (64 * 1024 * 1024)
+static size_t aes256_split_bytes = AES256_SPLIT_DEFAULT;
+
+/* ---------------- 참조 구현: 바이트 단위 라운드 함수 ---------------- */
 
 /**
  * @brief 라운드 키를 상태 행렬에 XOR함
@@ -144,25 +520,25 @@ int KeyExpansion(uint8_t* RoundKey, const uint8_t* Key) {
 static void AddRoundKey(uint8_t round, state_t* state, const uint8_t* RoundKey) {
     for (int c = 0; c < 4; c++)
         for (int r = 0; r < 4; r++)
-            (*state)[r][c] ^= RoundKey[round * Nb * 4 + c * 4 + r];
+            (*state)[c][r] ^= RoundKey[round * Nb * 4 + c * 4 + r];
 }
 
 /**
  * @brief S-box를 사용하여 상태 행렬의 바이트를 치환함
  */
 static void SubBytes(state_t* state) {
-    for (int r = 0; r < 4; r++)
-        for (int c = 0; c < 4; c++)
-            (*state)[r][c] = sbox[(*state)[r][c]];
+    for (int c = 0; c < 4; c++)
+        for (int r = 0; r < 4; r++)
+            (*state)[c][r] = sbox[(*state)[c][r]];
 }
 
 /**
  * @brief 역 S-box를 사용하여 상태 행렬의 바이트를 역치환함
  */
 static void InvSubBytes(state_t* state) {
-    for (int r = 0; r < 4; r++)
-        for (int c = 0; c < 4; c++)
-            (*state)[r][c] = rsbox[(*state)[r][c]];
+    for (int c = 0; c < 4; c++)
+        for (int r = 0; r < 4; r++)
+            (*state)[c][r] = rsbox[(*state)[c][r]];
 }
 
 /**
@@ -171,26 +547,26 @@ static void InvSubBytes(state_t* state) {
 static void ShiftRows(state_t* state) {
     uint8_t temp;
     /* row1: 1바이트 왼쪽 이동 */
-    temp = (*state)[1][0];
-    (*state)[1][0] = (*state)[1][1];
-    (*state)[1][1] = (*state)[1][2];
-    (*state)[1][2] = (*state)[1][3];
-    (*state)[1][3] = temp;
+    temp = (*state)[0][1];
+    (*state)[0][1] = (*state)[1][1];
+    (*state)[1][1] = (*state)[2][1];
+    (*state)[2][1] = (*state)[3][1];
+    (*state)[3][1] = temp;
 
     /* row2: 2바이트 왼쪽 이동 */
-    temp = (*state)[2][0];
-    (*state)[2][0] = (*state)[2][2];
+    temp = (*state)[0][2];
+    (*state)[0][2] = (*state)[2][2];
     (*state)[2][2] = temp;
-    temp = (*state)[2][1];
-    (*state)[2][1] = (*state)[2][3];
-    (*state)[2][3] = temp;
+    temp = (*state)[1][2];
+    (*state)[1][2] = (*state)[3][2];
+    (*state)[3][2] = temp;
 
     /* row3: 3바이트 왼쪽 이동 (=1바이트 오른쪽 이동) */
     temp = (*state)[3][3];
-    (*state)[3][3] = (*state)[3][2];
-    (*state)[3][2] = (*state)[3][1];
-    (*state)[3][1] = (*state)[3][0];
-    (*state)[3][0] = temp;
+    (*state)[3][3] = (*state)[2][3];
+    (*state)[2][3] = (*state)[1][3];
+    (*state)[1][3] = (*state)[0][3];
+    (*state)[0][3] = temp;
 }
 
 /**
@@ -199,25 +575,25 @@ static void ShiftRows(state_t* state) {
 static void InvShiftRows(state_t* state) {
     uint8_t temp;
     /* row1: 1바이트 오른쪽 이동 */
-    temp = (*state)[1][3];
-    (*state)[1][3] = (*state)[1][2];
-    (*state)[1][2] = (*state)[1][1];
-    (*state)[1][1] = (*state)[1][0];
-    (*state)[1][0] = temp;
+    temp = (*state)[3][1];
+    (*state)[3][1] = (*state)[2][1];
+    (*state)[2][1] = (*state)[1][1];
+    (*state)[1][1] = (*state)[0][1];
+    (*state)[0][1] = temp;
 
     /* row2: 2바이트 오른쪽 이동 */
-    temp = (*state)[2][0];
-    (*state)[2][0] = (*state)[2][2];
+    temp = (*state)[0][2];
+    (*state)[0][2] = (*state)[2][2];
     (*state)[2][2] = temp;
-    temp = (*state)[2][1];
-    (*state)[2][1] = (*state)[2][3];
-    (*state)[2][3] = temp;
+    temp = (*state)[1][2];
+    (*state)[1][2] = (*state)[3][2];
+    (*state)[3][2] = temp;
 
     /* row3: 3바이트 오른쪽 이동 (=1바이트 왼쪽 이동) */
-    temp = (*state)[3][0];
-    (*state)[3][0] = (*state)[3][1];
-    (*state)[3][1] = (*state)[3][2];
-    (*state)[3][2] = (*state)[3][3];
+    temp = (*state)[0][3];
+    (*state)[0][3] = (*state)[1][3];
+    (*state)[1][3] = (*state)[2][3];
+    (*state)[2][3] = (*state)[3][3];
     (*state)[3][3] = temp;
 }
 
@@ -226,15 +602,15 @@ static void InvShiftRows(state_t* state) {
  */
 static void MixColumns(state_t* state) {
     for (int c = 0; c < 4; c++) {
-        uint8_t a0 = (*state)[0][c];
-        uint8_t a1 = (*state)[1][c];
-        uint8_t a2 = (*state)[2][c];
-        uint8_t a3 = (*state)[3][c];
+        uint8_t a0 = (*state)[c][0];
+        uint8_t a1 = (*state)[c][1];
+        uint8_t a2 = (*state)[c][2];
+        uint8_t a3 = (*state)[c][3];
 
-        (*state)[0][c] = (uint8_t)(xtime(a0) ^ (xtime(a1) ^ a1) ^ a2 ^ a3);
-        (*state)[1][c] = (uint8_t)(a0 ^ xtime(a1) ^ (xtime(a2) ^ a2) ^ a3);
-        (*state)[2][c] = (uint8_t)(a0 ^ a1 ^ xtime(a2) ^ (xtime(a3) ^ a3));
-        (*state)[3][c] = (uint8_t)((xtime(a0) ^ a0) ^ a1 ^ a2 ^ xtime(a3));
+        (*state)[c][0] = (uint8_t)(xtime(a0) ^ (xtime(a1) ^ a1) ^ a2 ^ a3);
+        (*state)[c][1] = (uint8_t)(a0 ^ xtime(a1) ^ (xtime(a2) ^ a2) ^ a3);
+        (*state)[c][2] = (uint8_t)(a0 ^ a1 ^ xtime(a2) ^ (xtime(a3) ^ a3));
+        (*state)[c][3] = (uint8_t)((xtime(a0) ^ a0) ^ a1 ^ a2 ^ xtime(a3));
     }
 }
 
@@ -243,10 +619,10 @@ static void MixColumns(state_t* state) {
  */
 static void InvMixColumns(state_t* state) {
     for (int c = 0; c < 4; c++) {
-        uint8_t a0 = (*state)[0][c];
-        uint8_t a1 = (*state)[1][c];
-        uint8_t a2 = (*state)[2][c];
-        uint8_t a3 = (*state)[3][c];
+        uint8_t a0 = (*state)[c][0];
+        uint8_t a1 = (*state)[c][1];
+        uint8_t a2 = (*state)[c][2];
+        uint8_t a3 = (*state)[c][3];
 
         /* 유한체 곱셈 최적화 (0x0e, 0x0b, 0x0d, 0x09) */
         uint8_t x2_a0 = xtime(a0);
@@ -265,21 +641,17 @@ static void InvMixColumns(state_t* state) {
         uint8_t x4_a3 = xtime(x2_a3);
         uint8_t x8_a3 = xtime(x4_a3);
 
-        (*state)[0][c] = (x8_a0 ^ x4_a0 ^ x2_a0) ^ (x8_a1 ^ x2_a1 ^ a1) ^ (x8_a2 ^ x4_a2 ^ a2) ^ (x8_a3 ^ a3);
-        (*state)[1][c] = (x8_a0 ^ a0) ^ (x8_a1 ^ x4_a1 ^ x2_a1) ^ (x8_a2 ^ x2_a2 ^ a2) ^ (x8_a3 ^ x4_a3 ^ a3);
-        (*state)[2][c] = (x8_a0 ^ x4_a0 ^ a0) ^ (x8_a1 ^ a1) ^ (x8_a2 ^ x4_a2 ^ x2_a2) ^ (x8_a3 ^ x2_a3 ^ a3);
-        (*state)[3][c] = (x8_a0 ^ x2_a0 ^ a0) ^ (x8_a1 ^ x4_a1 ^ a1) ^ (x8_a2 ^ a2) ^ (x8_a3 ^ x4_a3 ^ x2_a3);
+        (*state)[c][0] = (x8_a0 ^ x4_a0 ^ x2_a0) ^ (x8_a1 ^ x2_a1 ^ a1) ^ (x8_a2 ^ x4_a2 ^ a2) ^ (x8_a3 ^ a3);
+        (*state)[c][1] = (x8_a0 ^ a0) ^ (x8_a1 ^ x4_a1 ^ x2_a1) ^ (x8_a2 ^ x2_a2 ^ a2) ^ (x8_a3 ^ x4_a3 ^ a3);
+        (*state)[c][2] = (x8_a0 ^ x4_a0 ^ a0) ^ (x8_a1 ^ a1) ^ (x8_a2 ^ x4_a2 ^ x2_a2) ^ (x8_a3 ^ x2_a3 ^ a3);
+        (*state)[c][3] = (x8_a0 ^ x2_a0 ^ a0) ^ (x8_a1 ^ x4_a1 ^ a1) ^ (x8_a2 ^ a2) ^ (x8_a3 ^ x4_a3 ^ x2_a3);
     }
 }
 
-/* ---------------- 블록 단위 암복호화 (16바이트) ---------------- */
-
 /**
- * @brief 16바이트 블록 하나를 암호화함
- * @return 성공 시 0, 실패 시 -1
+ * @brief 참조 구현: 16바이트 블록 하나를 암호화함
  */
-int AES256_EncryptBlock(uint8_t* buf, const uint8_t* RoundKey) {
-    if (buf == NULL || RoundKey == NULL) return -1;
+static void ref_encrypt_block(uint8_t* buf, const uint8_t* RoundKey) {
     state_t* state = (state_t*)buf;
 
     AddRoundKey(0, state, RoundKey);
@@ -294,104 +666,3658 @@ int AES256_EncryptBlock(uint8_t* buf, const uint8_t* RoundKey) {
     SubBytes(state);
     ShiftRows(state);
     AddRoundKey(Nr, state, RoundKey);
-    return 0;
 }
 
 /**
- * @brief 16바이트 블록 하나를 복호화함
- * @return 성공 시 0, 실패 시 -1
+ * @brief 참조 구현: 등가 역암호 순서로 16바이트 블록 하나를 복호화함
+ * @param DecKey 등가 역암호용 복호화 라운드 키 (inv_key_expansion 결과)
  */
-int AES256_DecryptBlock(uint8_t* buf, const uint8_t* RoundKey) {
-    if (buf == NULL || RoundKey == NULL) return -1;
+static void ref_decrypt_block(uint8_t* buf, const uint8_t* DecKey) {
     state_t* state = (state_t*)buf;
 
-    AddRoundKey(Nr, state, RoundKey);
-    InvShiftRows(state);
-    InvSubBytes(state);
+    AddRoundKey(0, state, DecKey);
 
-    for (int round = Nr - 1; round >= 1; round--) {
-        AddRoundKey(round, state, RoundKey);
-        InvMixColumns(state);
-        InvShiftRows(state);
+    for (int round = 1; round < Nr; round++) {
         InvSubBytes(state);
+        InvShiftRows(state);
+        InvMixColumns(state);
+        AddRoundKey(round, state, DecKey);
     }
 
-    AddRoundKey(0, state, RoundKey);
-    return 0;
+    InvSubBytes(state);
+    InvShiftRows(state);
+    AddRoundKey(Nr, state, DecKey);
 }
 
-/* ---------------- CBC 운영 모드 (Cipher Block Chaining) ---------------- */
+/* ---------------- T-table 구현: 32비트 워드 단위 라운드 함수 ---------------- */
 
 /**
- * @brief 블록 단위 XOR 연산
+ * @brief T-table 구현: 16바이트 블록 하나를 암호화함
+ * @details 한 라운드의 SubBytes, ShiftRows, MixColumns를 열(column)마다
+ *          테이블 조회 4회와 XOR 4회로 처리함.
  */
-static void xor_block(uint8_t* dst, const uint8_t* src) {
-    for (int i = 0; i < 16; i++) dst[i] ^= src[i];
+static void ttable_encrypt_block(uint8_t* buf, const uint8_t* RoundKey) {
+    const uint8_t* rk = RoundKey;
+    uint32_t s0 = GETU32(buf     ) ^ GETU32(rk     );
+    uint32_t s1 = GETU32(buf +  4) ^ GETU32(rk +  4);
+    uint32_t s2 = GETU32(buf +  8) ^ GETU32(rk +  8);
+    uint32_t s3 = GETU32(buf + 12) ^ GETU32(rk + 12);
+    uint32_t t0, t1, t2, t3;
+
+    for (int round = 1; round < Nr; round++) {
+        rk += 16;
+        t0 = Te0[s0 >> 24] ^ Te1[(s1 >> 16) & 0xff] ^ Te2[(s2 >> 8) & 0xff] ^ Te3[s3 & 0xff] ^ GETU32(rk     );
+        t1 = Te0[s1 >> 24] ^ Te1[(s2 >> 16) & 0xff] ^ Te2[(s3 >> 8) & 0xff] ^ Te3[s0 & 0xff] ^ GETU32(rk +  4);
+        t2 = Te0[s2 >> 24] ^ Te1[(s3 >> 16) & 0xff] ^ Te2[(s0 >> 8) & 0xff] ^ Te3[s1 & 0xff] ^ GETU32(rk +  8);
+        t3 = Te0[s3 >> 24] ^ Te1[(s0 >> 16) & 0xff] ^ Te2[(s1 >> 8) & 0xff] ^ Te3[s2 & 0xff] ^ GETU32(rk + 12);
+        s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+    }
+
+    /* 마지막 라운드: MixColumns 없이 SubBytes + ShiftRows만 적용 */
+    rk += 16;
+    t0 = ((uint32_t)sbox[s0 >> 24] << 24) ^ ((uint32_t)sbox[(s1 >> 16) & 0xff] << 16) ^
+         ((uint32_t)sbox[(s2 >> 8) & 0xff] << 8) ^ (uint32_t)sbox[s3 & 0xff];
+    t1 = ((uint32_t)sbox[s1 >> 24] << 24) ^ ((uint32_t)sbox[(s2 >> 16) & 0xff] << 16) ^
+         ((uint32_t)sbox[(s3 >> 8) & 0xff] << 8) ^ (uint32_t)sbox[s0 & 0xff];
+    t2 = ((uint32_t)sbox[s2 >> 24] << 24) ^ ((uint32_t)sbox[(s3 >> 16) & 0xff] << 16) ^
+         ((uint32_t)sbox[(s0 >> 8) & 0xff] << 8) ^ (uint32_t)sbox[s1 & 0xff];
+    t3 = ((uint32_t)sbox[s3 >> 24] << 24) ^ ((uint32_t)sbox[(s0 >> 16) & 0xff] << 16) ^
+         ((uint32_t)sbox[(s1 >> 8) & 0xff] << 8) ^ (uint32_t)sbox[s2 & 0xff];
+
+    t0 ^= GETU32(rk     );
+    t1 ^= GETU32(rk +  4);
+    t2 ^= GETU32(rk +  8);
+    t3 ^= GETU32(rk + 12);
+    PUTU32(buf     , t0);
+    PUTU32(buf +  4, t1);
+    PUTU32(buf +  8, t2);
+    PUTU32(buf + 12, t3);
 }
 
 /**
- * @brief 데이터를 CBC 모드로 암호화함 (데이터 길이는 16의 배수여야 함)
- * @return 성공 시 0, 실패 시 음수
+ * @brief T-table 구현: 등가 역암호 순서로 16바이트 블록 하나를 복호화함
+ * @param DecKey 등가 역암호용 복호화 라운드 키 (inv_key_expansion 결과)
  */
-int AES256_CBC_Encrypt(uint8_t* buf, size_t len, const uint8_t* RoundKey, const uint8_t* iv) {
-    if (buf == NULL || RoundKey == NULL || iv == NULL) return -1;
-    if (len == 0 || len % 16 != 0) return -2;
+static void ttable_decrypt_block(uint8_t* buf, const uint8_t* DecKey) {
+    const uint8_t* rk = DecKey;
+    uint32_t s0 = GETU32(buf     ) ^ GETU32(rk     );
+    uint32_t s1 = GETU32(buf +  4) ^ GETU32(rk +  4);
+    uint32_t s2 = GETU32(buf +  8) ^ GETU32(rk +  8);
+    uint32_t s3 = GETU32(buf + 12) ^ GETU32(rk + 12);
+    uint32_t t0, t1, t2, t3;
+
+    for (int round = 1; round < Nr; round++) {
+        rk += 16;
+        t0 = Td0[s0 >> 24] ^ Td1[(s3 >> 16) & 0xff] ^ Td2[(s2 >> 8) & 0xff] ^ Td3[s1 & 0xff] ^ GETU32(rk     );
+        t1 = Td0[s1 >> 24] ^ Td1[(s0 >> 16) & 0xff] ^ Td2[(s3 >> 8) & 0xff] ^ Td3[s2 & 0xff] ^ GETU32(rk +  4);
+        t2 = Td0[s2 >> 24] ^ Td1[(s1 >> 16) & 0xff] ^ Td2[(s0 >> 8) & 0xff] ^ Td3[s3 & 0xff] ^ GETU32(rk +  8);
+        t3 = Td0[s3 >> 24] ^ Td1[(s2 >> 16) & 0xff] ^ Td2[(s1 >> 8) & 0xff] ^ Td3[s0 & 0xff] ^ GETU32(rk + 12);
+        s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+    }
+
+    /* 마지막 라운드: InvMixColumns 없이 InvSubBytes + InvShiftRows만 적용 */
+    rk += 16;
+    t0 = ((uint32_t)rsbox[s0 >> 24] << 24) ^ ((uint32_t)rsbox[(s3 >> 16) & 0xff] << 16) ^
+         ((uint32_t)rsbox[(s2 >> 8) & 0xff] << 8) ^ (uint32_t)rsbox[s1 & 0xff];
+    t1 = ((uint32_t)rsbox[s1 >> 24] << 24) ^ ((uint32_t)rsbox[(s0 >> 16) & 0xff] << 16) ^
+         ((uint32_t)rsbox[(s3 >> 8) & 0xff] << 8) ^ (uint32_t)rsbox[s2 & 0xff];
+    t2 = ((uint32_t)rsbox[s2 >> 24] << 24) ^ ((uint32_t)rsbox[(s1 >> 16) & 0xff] << 16) ^
+         ((uint32_t)rsbox[(s0 >> 8) & 0xff] << 8) ^ (uint32_t)rsbox[s3 & 0xff];
+    t3 = ((uint32_t)rsbox[s3 >> 24] << 24) ^ ((uint32_t)rsbox[(s2 >> 16) & 0xff] << 16) ^
+         ((uint32_t)rsbox[(s1 >> 8) & 0xff] << 8) ^ (uint32_t)rsbox[s0 & 0xff];
+
+    t0 ^= GETU32(rk     );
+    t1 ^= GETU32(rk +  4);
+    t2 ^= GETU32(rk +  8);
+    t3 ^= GETU32(rk + 12);
+    PUTU32(buf     , t0);
+    PUTU32(buf +  4, t1);
+    PUTU32(buf +  8, t2);
+    PUTU32(buf + 12, t3);
+}
+
+/**
+ * @brief T-table 구현: 블록 4개를 라운드 단위로 교차(interleave) 처리하여 암호화함
+ * @details CTR처럼 서로 독립적인 블록을 암호화할 때 사용함
+ */
+static void ttable_encrypt_blocks(uint8_t* buf, size_t nblocks, const uint8_t* RoundKey) {
+    size_t i = 0;
+
+    for (; i + 4 <= nblocks; i += 4) {
+        uint8_t* b = buf + i * 16;
+        const uint8_t* rk = RoundKey;
+        uint32_t s[4][4], t[4][4];
+
+        AES256_UNROLL
+        for (int j = 0; j < 4; j++)
+            for (int w = 0; w < 4; w++)
+                s[j][w] = GETU32(b + j * 16 + w * 4) ^ GETU32(rk + w * 4);
 
-    uint8_t prev[16];
-    memcpy(prev, iv, 16);
+        for (int round = 1; round < Nr; round++) {
+            rk += 16;
+            AES256_UNROLL
+            for (int j = 0; j < 4; j++) {
+                t[j][0] = Te0[s[j][0] >> 24] ^ Te1[(s[j][1] >> 16) & 0xff] ^ Te2[(s[j][2] >> 8) & 0xff] ^ Te3[s[j][3] & 0xff] ^ GETU32(rk     );
+                t[j][1] = Te0[s[j][1] >> 24] ^ Te1[(s[j][2] >> 16) & 0xff] ^ Te2[(s[j][3] >> 8) & 0xff] ^ Te3[s[j][0] & 0xff] ^ GETU32(rk +  4);
+                t[j][2] = Te0[s[j][2] >> 24] ^ Te1[(s[j][3] >> 16) & 0xff] ^ Te2[(s[j][0] >> 8) & 0xff] ^ Te3[s[j][1] & 0xff] ^ GETU32(rk +  8);
+                t[j][3] = Te0[s[j][3] >> 24] ^ Te1[(s[j][0] >> 16) & 0xff] ^ Te2[(s[j][1] >> 8) & 0xff] ^ Te3[s[j][2] & 0xff] ^ GETU32(rk + 12);
+            }
+            memcpy(s, t, sizeof(s));
+        }
 
-    for (size_t off = 0; off < len; off += 16) {
-        xor_block(buf + off, prev);
-        AES256_EncryptBlock(buf + off, RoundKey);
-        memcpy(prev, buf + off, 16);
+        /* 마지막 라운드: SubBytes + ShiftRows + 키 XOR */
+        rk += 16;
+        for (int j = 0; j < 4; j++) {
+            for (int w = 0; w < 4; w++) {
+                uint32_t v = ((uint32_t)sbox[s[j][w] >> 24] << 24) ^
+                             ((uint32_t)sbox[(s[j][(w + 1) & 3] >> 16) & 0xff] << 16) ^
+                             ((uint32_t)sbox[(s[j][(w + 2) & 3] >> 8) & 0xff] << 8) ^
+                             (uint32_t)sbox[s[j][(w + 3) & 3] & 0xff];
+                v ^= GETU32(rk + w * 4);
+                PUTU32(b + j * 16 + w * 4, v);
+            }
+        }
     }
 
-    secure_memzero(prev, 16);
-    return 0;
+    for (; i < nblocks; i++) ttable_encrypt_block(buf + i * 16, RoundKey);
 }
 
 /**
- * @brief 데이터를 CBC 모드로 복호화함 (데이터 길이는 16의 배수여야 함)
- * @return 성공 시 0, 실패 시 음수
+ * @brief T-table 구현: 서로 다른 메시지의 CBC 블록 n개를 4개씩 교차하여 암호화함 (다중 버퍼 CBC용)
+ * @param blk  블록 포인터 배열 (제자리 처리)
+ * @param prev 블록별 체이닝 값 (직전 암호문 블록 또는 IV), 암호화 전에 XOR함
+ * @param rk   블록별 라운드 키 배열
  */
-int AES256_CBC_Decrypt(uint8_t* buf, size_t len, const uint8_t* RoundKey, const uint8_t* iv) {
-    if (buf == NULL || RoundKey == NULL || iv == NULL) return -1;
-    if (len == 0 || len % 16 != 0) return -2;
+static void ttable_cbc_encrypt_lanes(uint8_t* const* blk, const uint8_t* const* prev,
+                                     const uint8_t* const* rk, size_t n) {
+    size_t i = 0;
 
-    uint8_t prev[16], cur[16];
-    memcpy(prev, iv, 16);
+    for (; i + 4 <= n; i += 4) {
+        uint8_t* const* b = blk + i;
+        const uint8_t* const* p = prev + i;
+        const uint8_t* const* k = rk + i;
+        uint32_t s[4][4], t[4][4];
 
-    for (size_t off = 0; off < len; off += 16) {
-        memcpy(cur, buf + off, 16);
-        AES256_DecryptBlock(buf + off, RoundKey);
-        xor_block(buf + off, prev);
-        memcpy(prev, cur, 16);
+        AES256_UNROLL
+        for (int j = 0; j < 4; j++)
+            for (int w = 0; w < 4; w++)
+                s[j][w] = GETU32(b[j] + w * 4) ^ GETU32(p[j] + w * 4) ^ GETU32(k[j] + w * 4);
+
+        for (int round = 1; round < Nr; round++) {
+            size_t o = (size_t)round * 16;
+            AES256_UNROLL
+            for (int j = 0; j < 4; j++) {
+                t[j][0] = Te0[s[j][0] >> 24] ^ Te1[(s[j][1] >> 16) & 0xff] ^ Te2[(s[j][2] >> 8) & 0xff] ^ Te3[s[j][3] & 0xff] ^ GETU32(k[j] + o     );
+                t[j][1] = Te0[s[j][1] >> 24] ^ Te1[(s[j][2] >> 16) & 0xff] ^ Te2[(s[j][3] >> 8) & 0xff] ^ Te3[s[j][0] & 0xff] ^ GETU32(k[j] + o +  4);
+                t[j][2] = Te0[s[j][2] >> 24] ^ Te1[(s[j][3] >> 16) & 0xff] ^ Te2[(s[j][0] >> 8) & 0xff] ^ Te3[s[j][1] & 0xff] ^ GETU32(k[j] + o +  8);
+                t[j][3] = Te0[s[j][3] >> 24] ^ Te1[(s[j][0] >> 16) & 0xff] ^ Te2[(s[j][1] >> 8) & 0xff] ^ Te3[s[j][2] & 0xff] ^ GETU32(k[j] + o + 12);
+            }
+            memcpy(s, t, sizeof(s));
+        }
+
+        /* 마지막 라운드: SubBytes + ShiftRows + 키 XOR */
+        for (int j = 0; j < 4; j++) {
+            for (int w = 0; w < 4; w++) {
+                uint32_t v = ((uint32_t)sbox[s[j][w] >> 24] << 24) ^
+                             ((uint32_t)sbox[(s[j][(w + 1) & 3] >> 16) & 0xff] << 16) ^
+                             ((uint32_t)sbox[(s[j][(w + 2) & 3] >> 8) & 0xff] << 8) ^
+                             (uint32_t)sbox[s[j][(w + 3) & 3] & 0xff];
+                v ^= GETU32(k[j] + Nr * 16 + w * 4);
+                PUTU32(b[j] + w * 4, v);
+            }
+        }
     }
 
-    secure_memzero(prev, 16);
-    secure_memzero(cur, 16);
-    return 0;
+    for (; i < n; i++) {
+        for (int j = 0; j < 16; j++) blk[i][j] ^= prev[i][j];
+        ttable_encrypt_block(blk[i], rk[i]);
+    }
 }
 
-/* ---------------- 사용 예시 ----------------
-uint8_t key[32] = { ... };          // 256비트 키
-uint8_t iv[16]  = { ... };          // 초기화 벡터(IV)
-uint8_t RoundKey[240];              // 확장된 라운드 키 버퍼
+/**
+ * @brief T-table 구현: 블록 4개를 라운드 단위로 교차(interleave) 처리하여 복호화함
+ * @details 서로 독립적인 4개 블록의 테이블 조회를 한 라운드 안에 섞어 두면
+ *          한 블록의 메모리 지연 동안 다른 블록의 조회가 진행되어 처리량이 늘어남.
+ */
+static void ttable_decrypt_blocks(uint8_t* buf, size_t nblocks, const uint8_t* DecKey) {
+    size_t i = 0;
 
-// 키 확장 수행
-if (KeyExpansion(RoundKey, key) != 0) {
-    // 에러 처리
+    for (; i + 4 <= nblocks; i += 4) {
+        uint8_t* b = buf + i * 16;
+        const uint8_t* rk = DecKey;
+        uint32_t s[4][4], t[4][4];
+
+        AES256_UNROLL
+        for (int j = 0; j < 4; j++)
+            for (int w = 0; w < 4; w++)
+                s[j][w] = GETU32(b + j * 16 + w * 4) ^ GETU32(rk + w * 4);
+
+        for (int round = 1; round < Nr; round++) {
+            rk += 16;
+            AES256_UNROLL
+            for (int j = 0; j < 4; j++) {
+                t[j][0] = Td0[s[j][0] >> 24] ^ Td1[(s[j][3] >> 16) & 0xff] ^ Td2[(s[j][2] >> 8) & 0xff] ^ Td3[s[j][1] & 0xff] ^ GETU32(rk     );
+                t[j][1] = Td0[s[j][1] >> 24] ^ Td1[(s[j][0] >> 16) & 0xff] ^ Td2[(s[j][3] >> 8) & 0xff] ^ Td3[s[j][2] & 0xff] ^ GETU32(rk +  4);
+                t[j][2] = Td0[s[j][2] >> 24] ^ Td1[(s[j][1] >> 16) & 0xff] ^ Td2[(s[j][0] >> 8) & 0xff] ^ Td3[s[j][3] & 0xff] ^ GETU32(rk +  8);
+                t[j][3] = Td0[s[j][3] >> 24] ^ Td1[(s[j][2] >> 16) & 0xff] ^ Td2[(s[j][1] >> 8) & 0xff] ^ Td3[s[j][0] & 0xff] ^ GETU32(rk + 12);
+            }
+            memcpy(s, t, sizeof(s));
+        }
+
+        /* 마지막 라운드: InvSubBytes + InvShiftRows + 키 XOR */
+        rk += 16;
+        for (int j = 0; j < 4; j++) {
+            for (int w = 0; w < 4; w++) {
+                uint32_t v = ((uint32_t)rsbox[s[j][w] >> 24] << 24) ^
+                             ((uint32_t)rsbox[(s[j][(w + 3) & 3] >> 16) & 0xff] << 16) ^
+                             ((uint32_t)rsbox[(s[j][(w + 2) & 3] >> 8) & 0xff] << 8) ^
+                             (uint32_t)rsbox[s[j][(w + 1) & 3] & 0xff];
+                v ^= GETU32(rk + w * 4);
+                PUTU32(b + j * 16 + w * 4, v);
+            }
+        }
+    }
+
+    for (; i < nblocks; i++) ttable_decrypt_block(buf + i * 16, DecKey);
 }
 
-// CBC 암호화
-if (AES256_CBC_Encrypt(data, data_len, RoundKey, iv) != 0) {
-    // 에러 처리
+/* ---------------- AES-NI 구현: x86 하드웨어 명령어 ---------------- */
+
+/*
+ * AESENC/AESDEC 명령어는 한 라운드 전체를 1개 명령어로 처리함.
+ * 컴파일 옵션(-maes) 없이도 빌드되도록 함수 단위 target 속성을 사용하고,
+ * 실제 사용 여부는 실행 시 CPUID로 판단함.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define AES256_HAVE_AESNI 1
+#include <cpuid.h>
+#include <wmmintrin.h>
+
+#define AESNI_TARGET __attribute__((target("aes,sse2")))
+
+/**
+ * @brief CPUID로 AES-NI 지원 여부를 확인함
+ */
+static int aesni_available(void) {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return 0;
+    return (ecx & bit_AES) != 0 && (edx & bit_SSE2) != 0;
 }
 
-// CBC 복호화
-if (AES256_CBC_Decrypt(data, data_len, RoundKey, iv) != 0) {
-    // 에러 처리
+/**
+ * @brief CPUID로 PCLMULQDQ(캐리 없는 곱셈, GHASH용)와 SSSE3 지원 여부를 확인함
+ */
+static int clmul_available(void) {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return 0;
+    return (ecx & bit_PCLMUL) != 0 && (ecx & bit_SSSE3) != 0;
+}
+
+/**
+ * @brief 키 확장 보조: 이전 두 라운드 키로부터 다음 라운드 키를 계산함
+ * @param prev 두 라운드 전의 라운드 키
+ * @param assist AESKEYGENASSIST 결과에서 필요한 워드를 브로드캐스트한 값
+ */
+static inline AESNI_TARGET __m128i aesni_expand_step(__m128i prev, __m128i assist) {
+    prev = _mm_xor_si128(prev, _mm_slli_si128(prev, 4));
+    prev = _mm_xor_si128(prev, _mm_slli_si128(prev, 4));
+    prev = _mm_xor_si128(prev, _mm_slli_si128(prev, 4));
+    return _mm_xor_si128(prev, assist);
+}
+
+/* AESKEYGENASSIST는 Rcon을 즉시값으로 받으므로 매크로로 펼침 */
+#define AESNI_EXPAND_PAIR(i, rcon) do { \
+    k[i] = aesni_expand_step(k[(i) - 2], \
+        _mm_shuffle_epi32(_mm_aeskeygenassist_si128(k[(i) - 1], rcon), 0xff)); \
+    if ((i) + 1 <= Nr) \
+        k[(i) + 1] = aesni_expand_step(k[(i) - 1], \
+            _mm_shuffle_epi32(_mm_aeskeygenassist_si128(k[i], 0x00), 0xaa)); \
+} while (0)
+
+/**
+ * @brief AES-NI 구현: 256비트 키로 라운드 키를 생성함 (소프트웨어 구현과 같은 바이트 배치)
+ */
+static AESNI_TARGET void aesni_key_expansion(uint8_t* RoundKey, const uint8_t* Key) {
+    __m128i k[Nr + 1];
+
+    k[0] = _mm_loadu_si128((const __m128i*)Key);
+    k[1] = _mm_loadu_si128((const __m128i*)(Key + 16));
+    AESNI_EXPAND_PAIR(2, 0x01);
+    AESNI_EXPAND_PAIR(4, 0x02);
+    AESNI_EXPAND_PAIR(6, 0x04);
+    AESNI_EXPAND_PAIR(8, 0x08);
+    AESNI_EXPAND_PAIR(10, 0x10);
+    AESNI_EXPAND_PAIR(12, 0x20);
+    AESNI_EXPAND_PAIR(14, 0x40);
+
+    for (int i = 0; i <= Nr; i++) {
+        _mm_storeu_si128((__m128i*)(RoundKey + i * 16), k[i]);
+        k[i] = _mm_setzero_si128();
+    }
+}
+
+/**
+ * @brief AES-NI 구현: 등가 역암호용 복호화 라운드 키를 생성함 (AESIMC 사용)
+ */
+static AESNI_TARGET void aesni_inv_key_expansion(uint8_t* DecKey, const uint8_t* RoundKey) {
+    _mm_storeu_si128((__m128i*)DecKey, _mm_loadu_si128((const __m128i*)(RoundKey + Nr * 16)));
+    for (int round = 1; round < Nr; round++) {
+        __m128i k = _mm_loadu_si128((const __m128i*)(RoundKey + (Nr - round) * 16));
+        _mm_storeu_si128((__m128i*)(DecKey + round * 16), _mm_aesimc_si128(k));
+    }
+    _mm_storeu_si128((__m128i*)(DecKey + Nr * 16), _mm_loadu_si128((const __m128i*)RoundKey));
+}
+
+/**
+ * @brief 라운드 키 15개를 레지스터로 읽어 옴
+ */
+static inline AESNI_TARGET void aesni_load_keys(__m128i* k, const uint8_t* RoundKey) {
+    for (int i = 0; i <= Nr; i++) k[i] = _mm_loadu_si128((const __m128i*)(RoundKey + i * 16));
+}
+
+static inline AESNI_TARGET __m128i aesni_encrypt(__m128i b, const __m128i* k) {
+    b = _mm_xor_si128(b, k[0]);
+    for (int round = 1; round < Nr; round++) b = _mm_aesenc_si128(b, k[round]);
+    return _mm_aesenclast_si128(b, k[Nr]);
+}
+
+static inline AESNI_TARGET __m128i aesni_decrypt(__m128i b, const __m128i* dk) {
+    b = _mm_xor_si128(b, dk[0]);
+    for (int round = 1; round < Nr; round++) b = _mm_aesdec_si128(b, dk[round]);
+    return _mm_aesdeclast_si128(b, dk[Nr]);
+}
+
+/**
+ * @brief AES-NI 구현: 16바이트 블록 하나를 암호화함
+ */
+static AESNI_TARGET void aesni_encrypt_block(uint8_t* buf, const uint8_t* RoundKey) {
+    __m128i k[Nr + 1];
+    aesni_load_keys(k, RoundKey);
+    _mm_storeu_si128((__m128i*)buf, aesni_encrypt(_mm_loadu_si128((const __m128i*)buf), k));
+}
+
+/**
+ * @brief AES-NI 구현: 16바이트 블록 하나를 복호화함
+ */
+static AESNI_TARGET void aesni_decrypt_block(uint8_t* buf, const uint8_t* DecKey) {
+    __m128i dk[Nr + 1];
+    aesni_load_keys(dk, DecKey);
+    _mm_storeu_si128((__m128i*)buf, aesni_decrypt(_mm_loadu_si128((const __m128i*)buf), dk));
+}
+
+/**
+ * @brief AES-NI 구현: 블록 W개를 교차 처리하는 ECB 암호화 루프 (CTR 키스트림 생성용)
+ */
+static inline __attribute__((always_inline)) AESNI_TARGET void aesni_encrypt_w(uint8_t* buf, size_t nblocks,
+                                                                              const __m128i* k, const int W) {
+    size_t i = 0;
+
+    for (; i + (size_t)W <= nblocks; i += (size_t)W) {
+        __m128i b[8];
+        AES256_UNROLL
+        for (int j = 0; j < W; j++)
+            b[j] = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(buf + (i + j) * 16)), k[0]);
+        for (int round = 1; round < Nr; round++) {
+            AES256_UNROLL
+            for (int j = 0; j < W; j++) b[j] = _mm_aesenc_si128(b[j], k[round]);
+        }
+        AES256_UNROLL
+        for (int j = 0; j < W; j++)
+            _mm_storeu_si128((__m128i*)(buf + (i + j) * 16), _mm_aesenclast_si128(b[j], k[Nr]));
+    }
+
+    for (; i < nblocks; i++)
+        _mm_storeu_si128((__m128i*)(buf + i * 16), aesni_encrypt(_mm_loadu_si128((const __m128i*)(buf + i * 16)), k));
+}
+
+/**
+ * @brief AES-NI 구현: 독립적인 블록 여러 개를 암호화함 (aes256_interleave 블록씩 교차 처리)
+ */
+static AESNI_TARGET void aesni_encrypt_blocks(uint8_t* buf, size_t nblocks, const uint8_t* RoundKey) {
+    __m128i k[Nr + 1];
+    aesni_load_keys(k, RoundKey);
+
+    switch (AES256_CFG_LOAD(aes256_interleave)) {
+    case 8:  aesni_encrypt_w(buf, nblocks, k, 8); break;
+    case 4:  aesni_encrypt_w(buf, nblocks, k, 4); break;
+    case 2:  aesni_encrypt_w(buf, nblocks, k, 2); break;
+    default: aesni_encrypt_w(buf, nblocks, k, 1); break;
+    }
+}
+
+/**
+ * @brief AES-NI 구현: 서로 다른 메시지의 CBC 블록 W개를 라운드마다 나란히 암호화함
+ * @details 라운드 키는 레인별로 메모리에서 바로 읽어 AESENC의 피연산자로 사용함
+ */
+static inline __attribute__((always_inline)) AESNI_TARGET void aesni_cbc_encrypt_lanes_w(uint8_t* const* blk,
+                                                                                        const uint8_t* const* prev,
+                                                                                        const uint8_t* const* rk, const int W) {
+    __m128i b[8];
+    AES256_UNROLL
+    for (int j = 0; j < W; j++) {
+        b[j] = _mm_xor_si128(_mm_loadu_si128((const __m128i*)blk[j]), _mm_loadu_si128((const __m128i*)prev[j]));
+        b[j] = _mm_xor_si128(b[j], _mm_loadu_si128((const __m128i*)rk[j]));
+    }
+    for (int round = 1; round < Nr; round++) {
+        AES256_UNROLL
+        for (int j = 0; j < W; j++)
+            b[j] = _mm_aesenc_si128(b[j], _mm_loadu_si128((const __m128i*)(rk[j] + round * 16)));
+    }
+    AES256_UNROLL
+    for (int j = 0; j < W; j++)
+        _mm_storeu_si128((__m128i*)blk[j],
+                         _mm_aesenclast_si128(b[j], _mm_loadu_si128((const __m128i*)(rk[j] + Nr * 16))));
+}
+
+static AESNI_TARGET void aesni_cbc_encrypt_lanes(uint8_t* const* blk, const uint8_t* const* prev,
+                                                 const uint8_t* const* rk, size_t n) {
+    for (size_t i = 0; i < n; i += 8) {
+        switch ((n - i < 8) ? n - i : 8) {
+        case 8:  aesni_cbc_encrypt_lanes_w(blk + i, prev + i, rk + i, 8); break;
+        case 7:  aesni_cbc_encrypt_lanes_w(blk + i, prev + i, rk + i, 7); break;
+        case 6:  aesni_cbc_encrypt_lanes_w(blk + i, prev + i, rk + i, 6); break;
+        case 5:  aesni_cbc_encrypt_lanes_w(blk + i, prev + i, rk + i, 5); break;
+        case 4:  aesni_cbc_encrypt_lanes_w(blk + i, prev + i, rk + i, 4); break;
+        case 3:  aesni_cbc_encrypt_lanes_w(blk + i, prev + i, rk + i, 3); break;
+        case 2:  aesni_cbc_encrypt_lanes_w(blk + i, prev + i, rk + i, 2); break;
+        default: aesni_cbc_encrypt_lanes_w(blk + i, prev + i, rk + i, 1); break;
+        }
+    }
+}
+
+/**
+ * @brief AES-NI 구현: CBC 암호화 (라운드 키를 레지스터에 고정한 채 전체 버퍼 처리)
+ * @param iv [In/Out] 체이닝 값, 종료 시 마지막 암호문 블록으로 갱신됨
+ */
+static AESNI_TARGET void aesni_cbc_encrypt(uint8_t* buf, size_t nblocks, const uint8_t* RoundKey, uint8_t* iv) {
+    __m128i k[Nr + 1];
+    aesni_load_keys(k, RoundKey);
+
+    __m128i prev = _mm_loadu_si128((const __m128i*)iv);
+    for (size_t i = 0; i < nblocks; i++) {
+        __m128i b = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(buf + i * 16)), prev);
+        prev = aesni_encrypt(b, k);
+        _mm_storeu_si128((__m128i*)(buf + i * 16), prev);
+    }
+    _mm_storeu_si128((__m128i*)iv, prev);
+}
+
+/**
+ * @brief AES-NI 구현: 블록 W개를 교차 처리하는 CBC 복호화 루프
+ * @details AESDEC은 지연 시간이 처리 간격보다 길어서, 독립적인 블록 여러 개를
+ *          라운드마다 번갈아 넣어야 실행 유닛이 쉬지 않음. W는 상수로 인라인됨.
+ */
+static inline __attribute__((always_inline)) AESNI_TARGET __m128i aesni_cbc_decrypt_w(uint8_t* buf, size_t nblocks, const __m128i* dk,
+                                                                                    __m128i prev, const int W) {
+    size_t i = 0;
+
+    for (; i + (size_t)W <= nblocks; i += (size_t)W) {
+        __m128i c[8], b[8];
+        AES256_UNROLL
+        for (int j = 0; j < W; j++) {
+            c[j] = _mm_loadu_si128((const __m128i*)(buf + (i + j) * 16));
+            b[j] = _mm_xor_si128(c[j], dk[0]);
+        }
+        for (int round = 1; round < Nr; round++) {
+            AES256_UNROLL
+            for (int j = 0; j < W; j++) b[j] = _mm_aesdec_si128(b[j], dk[round]);
+        }
+        AES256_UNROLL
+        for (int j = 0; j < W; j++) b[j] = _mm_aesdeclast_si128(b[j], dk[Nr]);
+
+        _mm_storeu_si128((__m128i*)(buf + i * 16), _mm_xor_si128(b[0], prev));
+        AES256_UNROLL
+        for (int j = 1; j < W; j++)
+            _mm_storeu_si128((__m128i*)(buf + (i + j) * 16), _mm_xor_si128(b[j], c[j - 1]));
+        prev = c[W - 1];
+    }
+
+    for (; i < nblocks; i++) {
+        __m128i c = _mm_loadu_si128((const __m128i*)(buf + i * 16));
+        _mm_storeu_si128((__m128i*)(buf + i * 16), _mm_xor_si128(aesni_decrypt(c, dk), prev));
+        prev = c;
+    }
+    return prev;
+}
+
+/**
+ * @brief AES-NI 구현: CBC 복호화 (aes256_interleave 블록씩 교차 처리)
+ * @param iv [In/Out] 체이닝 값, 종료 시 마지막 암호문 블록으로 갱신됨
+ */
+static AESNI_TARGET void aesni_cbc_decrypt(uint8_t* buf, size_t nblocks, const uint8_t* DecKey, uint8_t* iv) {
+    __m128i dk[Nr + 1];
+    aesni_load_keys(dk, DecKey);
+
+    __m128i prev = _mm_loadu_si128((const __m128i*)iv);
+    switch (AES256_CFG_LOAD(aes256_interleave)) {
+    case 8:  prev = aesni_cbc_decrypt_w(buf, nblocks, dk, prev, 8); break;
+    case 4:  prev = aesni_cbc_decrypt_w(buf, nblocks, dk, prev, 4); break;
+    case 2:  prev = aesni_cbc_decrypt_w(buf, nblocks, dk, prev, 2); break;
+    default: prev = aesni_cbc_decrypt_w(buf, nblocks, dk, prev, 1); break;
+    }
+    _mm_storeu_si128((__m128i*)iv, prev);
+}
+
+/**
+ * @brief XTS tweak에 GF(2^128)의 원시원소 α를 곱함 (128비트 리틀엔디언 왼쪽 1비트 시프트)
+ * @details 32비트 단위로 2배한 뒤, 각 워드에서 넘친 비트를 다음 워드로 옮기고
+ *          최상위 비트가 넘치면 0x87로 환원함
+ */
+static inline AESNI_TARGET __m128i aesni_xts_mul_alpha(__m128i t) {
+    __m128i carry = _mm_shuffle_epi32(_mm_srai_epi32(t, 31), 0x93);
+    carry = _mm_and_si128(carry, _mm_set_epi32(1, 1, 1, 0x87));
+    return _mm_xor_si128(_mm_add_epi32(t, t), carry);
+}
+
+/**
+ * @brief AES-NI 구현: XTS 블록 W개를 교차 처리함 (tweak은 레지스터에서 바로 계산)
+ * @return 다음 블록의 tweak
+ */
+static inline __attribute__((always_inline)) AESNI_TARGET __m128i aesni_xts_w(uint8_t* buf, size_t nblocks,
+                                                                              const __m128i* k, __m128i t,
+                                                                              const int encrypt, const int W) {
+    size_t i = 0;
+
+    for (; i + (size_t)W <= nblocks; i += (size_t)W) {
+        __m128i tw[8], b[8];
+        AES256_UNROLL
+        for (int j = 0; j < W; j++) {
+            tw[j] = t;
+            t = aesni_xts_mul_alpha(t);
+            b[j] = _mm_xor_si128(_mm_xor_si128(_mm_loadu_si128((const __m128i*)(buf + (i + j) * 16)), tw[j]), k[0]);
+        }
+        for (int round = 1; round < Nr; round++) {
+            AES256_UNROLL
+            for (int j = 0; j < W; j++)
+                b[j] = encrypt ? _mm_aesenc_si128(b[j], k[round]) : _mm_aesdec_si128(b[j], k[round]);
+        }
+        AES256_UNROLL
+        for (int j = 0; j < W; j++) {
+            b[j] = encrypt ? _mm_aesenclast_si128(b[j], k[Nr]) : _mm_aesdeclast_si128(b[j], k[Nr]);
+            _mm_storeu_si128((__m128i*)(buf + (i + j) * 16), _mm_xor_si128(b[j], tw[j]));
+        }
+    }
+
+    for (; i < nblocks; i++) {
+        __m128i b = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(buf + i * 16)), t);
+        b = encrypt ? aesni_encrypt(b, k) : aesni_decrypt(b, k);
+        _mm_storeu_si128((__m128i*)(buf + i * 16), _mm_xor_si128(b, t));
+        t = aesni_xts_mul_alpha(t);
+    }
+    return t;
+}
+
+/**
+ * @brief AES-NI 구현: XTS 전체 블록 처리 (aes256_interleave 블록씩 교차 처리)
+ * @param key 암호화 시 라운드 키, 복호화 시 복호화 라운드 키
+ * @param tweak [In/Out] 첫 블록의 tweak, 종료 시 다음 블록의 tweak으로 갱신됨
+ */
+static AESNI_TARGET void aesni_xts_crypt(uint8_t* buf, size_t nblocks, const uint8_t* key, uint8_t* tweak, int encrypt) {
+    __m128i k[Nr + 1];
+    aesni_load_keys(k, key);
+
+    __m128i t = _mm_loadu_si128((const __m128i*)tweak);
+    if (encrypt) {
+        switch (AES256_CFG_LOAD(aes256_interleave)) {
+        case 8:  t = aesni_xts_w(buf, nblocks, k, t, 1, 8); break;
+        case 4:  t = aesni_xts_w(buf, nblocks, k, t, 1, 4); break;
+        case 2:  t = aesni_xts_w(buf, nblocks, k, t, 1, 2); break;
+        default: t = aesni_xts_w(buf, nblocks, k, t, 1, 1); break;
+        }
+    } else {
+        switch (AES256_CFG_LOAD(aes256_interleave)) {
+        case 8:  t = aesni_xts_w(buf, nblocks, k, t, 0, 8); break;
+        case 4:  t = aesni_xts_w(buf, nblocks, k, t, 0, 4); break;
+        case 2:  t = aesni_xts_w(buf, nblocks, k, t, 0, 2); break;
+        default: t = aesni_xts_w(buf, nblocks, k, t, 0, 1); break;
+        }
+    }
+    _mm_storeu_si128((__m128i*)tweak, t);
+}
+
+/**
+ * @brief AES-NI 구현: CTR 암복호화와 CMAC 체인을 블록마다 한 라운드 루프에서 함께 처리함
+ * @details CMAC 체인은 직렬이라 AESENC 지연 시간에 묶이므로, 같은 라운드 루프에 독립적인
+ *          CTR 블록 하나를 끼워 넣어 남는 실행 포트에서 키스트림을 공짜로 만듦.
+ *          암호화는 암호문이 나온 다음 블록에서 MAC에 넣고(1블록 지연), 복호화는 암호문을
+ *          바로 MAC에 넣음. 데이터는 한 번 읽고 한 번 씀.
+ *          모든 블록을 CMAC의 마지막이 아닌 블록으로 흡수함 (서브키 처리는 호출자가 함)
+ * @param hi,lo [In/Out] 128비트 빅엔디언 카운터, 종료 시 nblocks만큼 증가함
+ * @param mac   [In/Out] CMAC 체이닝 값
+ */
+static AESNI_TARGET void aesni_ctr_cmac(uint8_t* buf, size_t nblocks, const uint8_t* ctr_key,
+                                        const uint8_t* mac_key, uint64_t* hi, uint64_t* lo,
+                                        uint8_t* mac, int encrypt) {
+    __m128i k[Nr + 1], m[Nr + 1];
+    aesni_load_keys(k, ctr_key);
+    aesni_load_keys(m, mac_key);
+
+    __m128i x = _mm_loadu_si128((const __m128i*)mac);
+    __m128i c = _mm_setzero_si128();
+    uint64_t h = *hi, l = *lo;
+
+    for (size_t i = 0; i < nblocks; i++) {
+        __m128i s = _mm_set_epi64x((long long)__builtin_bswap64(l), (long long)__builtin_bswap64(h));
+        if (++l == 0) h++;
+        if (!encrypt) c = _mm_loadu_si128((const __m128i*)(buf + i * 16));
+
+        if (encrypt && i == 0) {
+            s = aesni_encrypt(s, k);
+        } else {
+            /* 암호화: 직전 블록 암호문을, 복호화: 이번 블록 암호문을 MAC에 흡수 */
+            __m128i t = _mm_xor_si128(_mm_xor_si128(x, c), m[0]);
+            s = _mm_xor_si128(s, k[0]);
+            for (int round = 1; round < Nr; round++) {
+                s = _mm_aesenc_si128(s, k[round]);
+                t = _mm_aesenc_si128(t, m[round]);
+            }
+            s = _mm_aesenclast_si128(s, k[Nr]);
+            x = _mm_aesenclast_si128(t, m[Nr]);
+        }
+
+        if (encrypt) {
+            c = _mm_xor_si128(s, _mm_loadu_si128((const __m128i*)(buf + i * 16)));
+            _mm_storeu_si128((__m128i*)(buf + i * 16), c);
+        } else {
+            _mm_storeu_si128((__m128i*)(buf + i * 16), _mm_xor_si128(s, c));
+        }
+    }
+    if (encrypt && nblocks > 0) x = aesni_encrypt(_mm_xor_si128(x, c), m);
+
+    _mm_storeu_si128((__m128i*)mac, x);
+    *hi = h;
+    *lo = l;
+}
+#endif /* AES-NI */
+
+/* ---------------- 비트슬라이스 구현: 상수 시간 8블록 병렬 ---------------- */
+
+/*
+ * 8개 블록(128바이트)을 8개의 128비트 벡터로 전치하여, 벡터 i에 모든 바이트의 i번째 비트를
+ * 모아 둔 뒤 S-box를 AND/XOR 논리 회로(Boyar-Peralta)로 계산함.
+ * 비밀 값으로 메모리 주소나 분기를 결정하지 않으므로 캐시 타이밍 공격에 안전함.
+ *
+ * - 레이아웃은 64비트 워드 하나에 4블록을 담는 방식이며, 벡터의 두 64비트 레인이
+ *   각각 블록 0~3, 4~7을 맡음. GCC 벡터 확장을 사용하므로 x86에서는 SSE2 명령어로 컴파일됨.
+ * - 한 블록만 처리해도 8블록 비용이 들므로 CBC 암호화처럼 직렬인 모드에는 적합하지 않음.
+ *   대신 CTR 키스트림과 CBC 복호화처럼 블록이 독립적인 경로에서 사용함.
+ * - 키 전치 비용이 있으므로 다중 블록 함수는 호출 한 번에 여러 묶음을 처리하도록 함 (batch)
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define AES256_HAVE_BITSLICE 1
+
+typedef uint64_t bs_vec __attribute__((vector_size(16)));
+
+/* 전치된 라운드 키: 라운드마다 벡터 8개 (15라운드 x 128바이트) */
+typedef struct {
+    bs_vec rk[(Nr + 1) * 8];
+} bs_key_t;
+
+static inline uint32_t load_le32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void store_le32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+/**
+ * @brief 블록 하나(리틀엔디언 워드 4개)를 바이트 단위로 벌려 64비트 워드 2개에 배치함
+ */
+static inline void bs_interleave_in(uint64_t* q0, uint64_t* q1, const uint8_t* block) {
+    uint64_t x0 = load_le32(block), x1 = load_le32(block + 4);
+    uint64_t x2 = load_le32(block + 8), x3 = load_le32(block + 12);
+
+    x0 |= (x0 << 16); x1 |= (x1 << 16); x2 |= (x2 << 16); x3 |= (x3 << 16);
+    x0 &= 0x0000FFFF0000FFFFULL; x1 &= 0x0000FFFF0000FFFFULL;
+    x2 &= 0x0000FFFF0000FFFFULL; x3 &= 0x0000FFFF0000FFFFULL;
+    x0 |= (x0 << 8); x1 |= (x1 << 8); x2 |= (x2 << 8); x3 |= (x3 << 8);
+    x0 &= 0x00FF00FF00FF00FFULL; x1 &= 0x00FF00FF00FF00FFULL;
+    x2 &= 0x00FF00FF00FF00FFULL; x3 &= 0x00FF00FF00FF00FFULL;
+    *q0 = x0 | (x2 << 8);
+    *q1 = x1 | (x3 << 8);
+}
+
+/**
+ * @brief bs_interleave_in의 역변환
+ */
+static inline void bs_interleave_out(uint8_t* block, uint64_t q0, uint64_t q1) {
+    uint64_t x0 = q0 & 0x00FF00FF00FF00FFULL;
+    uint64_t x1 = q1 & 0x00FF00FF00FF00FFULL;
+    uint64_t x2 = (q0 >> 8) & 0x00FF00FF00FF00FFULL;
+    uint64_t x3 = (q1 >> 8) & 0x00FF00FF00FF00FFULL;
+
+    x0 |= (x0 >> 8); x1 |= (x1 >> 8); x2 |= (x2 >> 8); x3 |= (x3 >> 8);
+    x0 &= 0x0000FFFF0000FFFFULL; x1 &= 0x0000FFFF0000FFFFULL;
+    x2 &= 0x0000FFFF0000FFFFULL; x3 &= 0x0000FFFF0000FFFFULL;
+    store_le32(block,      (uint32_t)x0 | (uint32_t)(x0 >> 16));
+    store_le32(block + 4,  (uint32_t)x1 | (uint32_t)(x1 >> 16));
+    store_le32(block + 8,  (uint32_t)x2 | (uint32_t)(x2 >> 16));
+    store_le32(block + 12, (uint32_t)x3 | (uint32_t)(x3 >> 16));
+}
+
+/**
+ * @brief 8x8 비트 전치 (자기 자신이 역함수): 바이트 묶음 <-> 비트 평면
+ */
+static inline void bs_ortho(bs_vec* q) {
+#define BS_SWAPN(cl, ch, s, x, y) do { \
+        bs_vec a_ = (x), b_ = (y); \
+        (x) = (a_ & (cl)) | ((b_ & (cl)) << (s)); \
+        (y) = ((a_ & (ch)) >> (s)) | (b_ & (ch)); \
+    } while (0)
+#define BS_SWAP2(x, y) BS_SWAPN(0x5555555555555555ULL, 0xAAAAAAAAAAAAAAAAULL, 1, x, y)
+#define BS_SWAP4(x, y) BS_SWAPN(0x3333333333333333ULL, 0xCCCCCCCCCCCCCCCCULL, 2, x, y)
+#define BS_SWAP8(x, y) BS_SWAPN(0x0F0F0F0F0F0F0F0FULL, 0xF0F0F0F0F0F0F0F0ULL, 4, x, y)
+
+    BS_SWAP2(q[0], q[1]); BS_SWAP2(q[2], q[3]); BS_SWAP2(q[4], q[5]); BS_SWAP2(q[6], q[7]);
+    BS_SWAP4(q[0], q[2]); BS_SWAP4(q[1], q[3]); BS_SWAP4(q[4], q[6]); BS_SWAP4(q[5], q[7]);
+    BS_SWAP8(q[0], q[4]); BS_SWAP8(q[1], q[5]); BS_SWAP8(q[2], q[6]); BS_SWAP8(q[3], q[7]);
+
+#undef BS_SWAP8
+#undef BS_SWAP4
+#undef BS_SWAP2
+#undef BS_SWAPN
+}
+
+/**
+ * @brief 최대 8개 블록을 비트 평면 8개로 전치함 (모자란 블록은 0으로 채움)
+ */
+static void bs_load(bs_vec* q, const uint8_t* buf, size_t nblocks) {
+    uint64_t w[2][8] = {{0}};
+    for (size_t i = 0; i < nblocks; i++) {
+        size_t lane = i >> 2, slot = i & 3;
+        bs_interleave_in(&w[lane][slot], &w[lane][slot + 4], buf + i * 16);
+    }
+    for (int i = 0; i < 8; i++) {
+        q[i] = (bs_vec){ w[0][i], w[1][i] };
+    }
+    bs_ortho(q);
+}
+
+/**
+ * @brief bs_load의 역변환 (앞쪽 nblocks개 블록만 기록)
+ */
+static void bs_store(uint8_t* buf, bs_vec* q, size_t nblocks) {
+    bs_ortho(q);
+    for (size_t i = 0; i < nblocks; i++) {
+        size_t lane = i >> 2, slot = i & 3;
+        bs_interleave_out(buf + i * 16, q[slot][lane], q[slot + 4][lane]);
+    }
+}
+
+/**
+ * @brief 라운드 키(240바이트)를 전치함: 각 라운드 키를 8개 블록 자리에 모두 복사한 것과 같음
+ */
+static void bs_key_schedule(bs_key_t* sk, const uint8_t* RoundKey) {
+    for (int r = 0; r <= Nr; r++) {
+        uint64_t q0, q1;
+        bs_vec* q = &sk->rk[r * 8];
+
+        /* 8개 자리가 모두 같은 블록이므로 한 번만 벌려서 복사함 */
+        bs_interleave_in(&q0, &q1, RoundKey + r * 16);
+        for (int i = 0; i < 4; i++) {
+            q[i] = (bs_vec){ q0, q0 };
+            q[i + 4] = (bs_vec){ q1, q1 };
+        }
+        bs_ortho(q);
+        q0 = q1 = 0;
+    }
+}
+
+static inline void bs_add_round_key(bs_vec* q, const bs_vec* rk) {
+    AES256_UNROLL
+    for (int i = 0; i < 8; i++) q[i] ^= rk[i];
+}
+
+/**
+ * @brief 비트슬라이스 S-box: GF(2^8) 역원 + 아핀 변환을 논리 게이트로 계산 (Boyar-Peralta 회로)
+ * @details q[7]이 각 바이트의 최상위 비트, q[0]이 최하위 비트
+ */
+static inline void bs_sbox(bs_vec* q) {
+    bs_vec x0, x1, x2, x3, x4, x5, x6, x7;
+    bs_vec y1, y2, y3, y4, y5, y6, y7, y8, y9;
+    bs_vec y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+    bs_vec y20, y21;
+    bs_vec z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    bs_vec z10, z11, z12, z13, z14, z15, z16, z17;
+    bs_vec t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    bs_vec t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    bs_vec t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    bs_vec t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    bs_vec t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    bs_vec t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    bs_vec t60, t61, t62, t63, t64, t65, t66, t67;
+    bs_vec s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7]; x1 = q[6]; x2 = q[5]; x3 = q[4];
+    x4 = q[3]; x5 = q[2]; x6 = q[1]; x7 = q[0];
+
+    /* 상단 선형 변환 */
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    /* 비선형 부분 (GF(2^4) 역원) */
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    /* 하단 선형 변환 (아핀 변환 포함) */
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0; q[6] = s1; q[5] = s2; q[4] = s3;
+    q[3] = s4; q[2] = s5; q[1] = s6; q[0] = s7;
+}
+
+/**
+ * @brief 역 S-box: InvS(y) = g(S(g(y))), g(y) = A^-1(y) ^ 0x05 (A는 S-box의 아핀 행렬)
+ * @details S(x) = A(x^-1) ^ 0x63 이므로 g(S(x)) = x^-1, 따라서 g(S(g(y)))가 역 S-box가 됨.
+ *          g의 각 출력 비트: b_i = y_(i+2) ^ y_(i+5) ^ y_(i+7) ^ (0x05의 i번째 비트)
+ */
+static inline void bs_inv_affine(bs_vec* q) {
+    bs_vec y[8];
+    AES256_UNROLL
+    for (int i = 0; i < 8; i++) y[i] = q[i];
+    AES256_UNROLL
+    for (int i = 0; i < 8; i++) {
+        q[i] = y[(i + 2) & 7] ^ y[(i + 5) & 7] ^ y[(i + 7) & 7];
+    }
+    q[0] = ~q[0];
+    q[2] = ~q[2];
+}
+
+static inline void bs_inv_sbox(bs_vec* q) {
+    bs_inv_affine(q);
+    bs_sbox(q);
+    bs_inv_affine(q);
+}
+
+/*
+ * 각 64비트 워드 안에서 16비트 단위가 행(row) 하나, 4비트 단위가 열(column) 하나에 해당함.
+ * ShiftRows는 워드 안의 비트 이동, MixColumns의 행 회전은 16비트/32비트 회전으로 계산함.
+ */
+static inline void bs_shift_rows(bs_vec* q) {
+    AES256_UNROLL
+    for (int i = 0; i < 8; i++) {
+        bs_vec x = q[i];
+        q[i] = (x & 0x000000000000FFFFULL)
+             | ((x & 0x00000000FFF00000ULL) >> 4)
+             | ((x & 0x00000000000F0000ULL) << 12)
+             | ((x & 0x0000FF0000000000ULL) >> 8)
+             | ((x & 0x000000FF00000000ULL) << 8)
+             | ((x & 0xF000000000000000ULL) >> 12)
+             | ((x & 0x0FFF000000000000ULL) << 4);
+    }
+}
+
+static inline void bs_inv_shift_rows(bs_vec* q) {
+    AES256_UNROLL
+    for (int i = 0; i < 8; i++) {
+        bs_vec x = q[i];
+        q[i] = (x & 0x000000000000FFFFULL)
+             | ((x & 0x000000000FFF0000ULL) << 4)
+             | ((x & 0x00000000F0000000ULL) >> 12)
+             | ((x & 0x000000FF00000000ULL) << 8)
+             | ((x & 0x0000FF0000000000ULL) >> 8)
+             | ((x & 0x000F000000000000ULL) << 12)
+             | ((x & 0xFFF0000000000000ULL) >> 4);
+    }
+}
+
+static inline bs_vec bs_rotr16(bs_vec x) {
+    return (x >> 16) | (x << 48);
+}
+
+static inline bs_vec bs_rotr32(bs_vec x) {
+    return (x >> 32) | (x << 32);
+}
+
+/**
+ * @brief 비트슬라이스 MixColumns: 열마다 2*a0 ^ 3*a1 ^ a2 ^ a3 (xtime은 비트 평면 이동 + 0x1b 피드백)
+ */
+static inline void bs_mix_columns(bs_vec* q) {
+    bs_vec q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    bs_vec q4 = q[4], q5 = q[5], q6 = q[6], q7 = q[7];
+    bs_vec r0 = bs_rotr16(q0), r1 = bs_rotr16(q1), r2 = bs_rotr16(q2), r3 = bs_rotr16(q3);
+    bs_vec r4 = bs_rotr16(q4), r5 = bs_rotr16(q5), r6 = bs_rotr16(q6), r7 = bs_rotr16(q7);
+
+    q[0] = q7 ^ r7 ^ r0 ^ bs_rotr32(q0 ^ r0);
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ bs_rotr32(q1 ^ r1);
+    q[2] = q1 ^ r1 ^ r2 ^ bs_rotr32(q2 ^ r2);
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ bs_rotr32(q3 ^ r3);
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ bs_rotr32(q4 ^ r4);
+    q[5] = q4 ^ r4 ^ r5 ^ bs_rotr32(q5 ^ r5);
+    q[6] = q5 ^ r5 ^ r6 ^ bs_rotr32(q6 ^ r6);
+    q[7] = q6 ^ r6 ^ r7 ^ bs_rotr32(q7 ^ r7);
+}
+
+/**
+ * @brief 비트슬라이스 InvMixColumns
+ * @details InvMixColumns(a) = MixColumns(b), b_i = a_i ^ 4*(a_i ^ a_(i+2)) 분해를 사용함.
+ *          a_(i+2)는 32비트 회전, 4배는 xtime 두 번(비트 평면 2칸 이동 + 0x1b 피드백)
+ */
+static inline void bs_inv_mix_columns(bs_vec* q) {
+    bs_vec t[8];
+    AES256_UNROLL
+    for (int i = 0; i < 8; i++) t[i] = q[i] ^ bs_rotr32(q[i]);
+
+    /* q ^= 4 * t */
+    q[0] ^= t[6];
+    q[1] ^= t[6] ^ t[7];
+    q[2] ^= t[0] ^ t[7];
+    q[3] ^= t[1] ^ t[6];
+    q[4] ^= t[2] ^ t[6] ^ t[7];
+    q[5] ^= t[3] ^ t[7];
+    q[6] ^= t[4];
+    q[7] ^= t[5];
+
+    bs_mix_columns(q);
+}
+
+static void bs_encrypt8(bs_vec* q, const bs_key_t* sk) {
+    bs_add_round_key(q, &sk->rk[0]);
+    for (int r = 1; r < Nr; r++) {
+        bs_sbox(q);
+        bs_shift_rows(q);
+        bs_mix_columns(q);
+        bs_add_round_key(q, &sk->rk[r * 8]);
+    }
+    bs_sbox(q);
+    bs_shift_rows(q);
+    bs_add_round_key(q, &sk->rk[Nr * 8]);
+}
+
+/**
+ * @brief 등가 역암호 순서의 8블록 복호화 (DecKey를 전치한 키 사용)
+ */
+static void bs_decrypt8(bs_vec* q, const bs_key_t* sk) {
+    bs_add_round_key(q, &sk->rk[0]);
+    for (int r = 1; r < Nr; r++) {
+        bs_inv_sbox(q);
+        bs_inv_shift_rows(q);
+        bs_inv_mix_columns(q);
+        bs_add_round_key(q, &sk->rk[r * 8]);
+    }
+    bs_inv_sbox(q);
+    bs_inv_shift_rows(q);
+    bs_add_round_key(q, &sk->rk[Nr * 8]);
+}
+
+/**
+ * @brief SubWord를 비트슬라이스 S-box로 계산함 (키 바이트로 sbox[]를 조회하지 않음)
+ */
+static void bs_sub_word(uint8_t* w) {
+    uint8_t blk[16] = {0};
+    bs_vec q[8];
+
+    memcpy(blk, w, 4);
+    bs_load(q, blk, 1);
+    bs_sbox(q);
+    bs_store(blk, q, 1);
+    memcpy(w, blk, 4);
+
+    secure_memzero(q, sizeof(q));
+    secure_memzero(blk, sizeof(blk));
+}
+
+/**
+ * @brief 라운드 키 생성 (비트슬라이스 구현)
+ * @details soft_key_expansion과 결과가 같지만 SubWord를 논리 회로로 계산하므로
+ *          키 스케줄까지 비밀 값에 따른 메모리 접근이 없음
+ */
+static void bitslice_key_expansion(uint8_t* RoundKey, const uint8_t* Key) {
+    uint8_t tempa[4];
+
+    memcpy(RoundKey, Key, Nk * 4);
+
+    for (int i = Nk; i < Nb * (Nr + 1); i++) {
+        memcpy(tempa, RoundKey + (i - 1) * 4, 4);
+
+        if (i % Nk == 0) {
+            /* RotWord -> SubWord -> Rcon (Rcon 인덱스는 공개 값) */
+            uint8_t t = tempa[0];
+            tempa[0] = tempa[1];
+            tempa[1] = tempa[2];
+            tempa[2] = tempa[3];
+            tempa[3] = t;
+            bs_sub_word(tempa);
+            tempa[0] ^= Rcon[(i/Nk) - 1];
+        }
+        else if (i % Nk == 4) {
+            bs_sub_word(tempa);
+        }
+
+        for (int j = 0; j < 4; j++) {
+            RoundKey[i * 4 + j] = RoundKey[(i - Nk) * 4 + j] ^ tempa[j];
+        }
+    }
+
+    secure_memzero(tempa, 4);
+}
+
+/**
+ * @brief 등가 역암호용 복호화 라운드 키 생성 (비트슬라이스 구현)
+ * @details 라운드 순서를 뒤집은 뒤 1~13라운드 키를 8개, 5개씩 묶어 bs_inv_mix_columns로 변환함.
+ *          soft_inv_key_expansion의 Td[sbox[x]] 조회를 쓰지 않음
+ */
+static void bitslice_inv_key_expansion(uint8_t* DecKey, const uint8_t* RoundKey) {
+    bs_vec q[8];
+
+    for (int round = 0; round <= Nr; round++) {
+        memcpy(DecKey + round * 16, RoundKey + (Nr - round) * 16, 16);
+    }
+
+    for (int round = 1; round < Nr; round += 8) {
+        size_t n = (Nr - round < 8) ? (size_t)(Nr - round) : 8;
+        bs_load(q, DecKey + round * 16, n);
+        bs_inv_mix_columns(q);
+        bs_store(DecKey + round * 16, q, n);
+    }
+
+    secure_memzero(q, sizeof(q));
+}
+
+/**
+ * @brief 독립 블록 여러 개를 8개씩 묶어 암호화함 (키 전치는 호출당 한 번)
+ */
+static void bitslice_encrypt_blocks(uint8_t* buf, size_t nblocks, const uint8_t* RoundKey) {
+    bs_key_t sk;
+    bs_vec q[8];
+
+    bs_key_schedule(&sk, RoundKey);
+    for (size_t i = 0; i < nblocks; i += 8) {
+        size_t n = (nblocks - i < 8) ? (nblocks - i) : 8;
+        bs_load(q, buf + i * 16, n);
+        bs_encrypt8(q, &sk);
+        bs_store(buf + i * 16, q, n);
+    }
+
+    secure_memzero(q, sizeof(q));
+    secure_memzero(&sk, sizeof(sk));
+}
+
+static void bitslice_decrypt_blocks(uint8_t* buf, size_t nblocks, const uint8_t* DecKey) {
+    bs_key_t sk;
+    bs_vec q[8];
+
+    bs_key_schedule(&sk, DecKey);
+    for (size_t i = 0; i < nblocks; i += 8) {
+        size_t n = (nblocks - i < 8) ? (nblocks - i) : 8;
+        bs_load(q, buf + i * 16, n);
+        bs_decrypt8(q, &sk);
+        bs_store(buf + i * 16, q, n);
+    }
+
+    secure_memzero(q, sizeof(q));
+    secure_memzero(&sk, sizeof(sk));
+}
+
+static void bitslice_encrypt_block(uint8_t* buf, const uint8_t* RoundKey) {
+    bitslice_encrypt_blocks(buf, 1, RoundKey);
+}
+
+static void bitslice_decrypt_block(uint8_t* buf, const uint8_t* DecKey) {
+    bitslice_decrypt_blocks(buf, 1, DecKey);
+}
+
+/**
+ * @brief 비트슬라이스 CBC 암호화: 블록 간 의존성 때문에 한 블록씩 처리함 (키 전치는 호출당 한 번)
+ */
+static void bitslice_cbc_encrypt(uint8_t* buf, size_t nblocks, const uint8_t* RoundKey, uint8_t* iv) {
+    bs_key_t sk;
+    bs_vec q[8];
+    const uint8_t* prev = iv;
+
+    bs_key_schedule(&sk, RoundKey);
+    for (size_t i = 0; i < nblocks; i++) {
+        uint8_t* b = buf + i * 16;
+        for (int j = 0; j < 16; j++) b[j] ^= prev[j];
+        bs_load(q, b, 1);
+        bs_encrypt8(q, &sk);
+        bs_store(b, q, 1);
+        prev = b;
+    }
+    memcpy(iv, prev, 16);
+
+    secure_memzero(q, sizeof(q));
+    secure_memzero(&sk, sizeof(sk));
+}
+
+/**
+ * @brief 비트슬라이스 CBC 복호화: 8블록씩 복호화한 뒤 직전 암호문과 XOR함
+ */
+static void bitslice_cbc_decrypt(uint8_t* buf, size_t nblocks, const uint8_t* DecKey, uint8_t* iv) {
+    bs_key_t sk;
+    bs_vec q[8];
+    uint8_t cur[8 * 16];
+
+    bs_key_schedule(&sk, DecKey);
+    for (size_t i = 0; i < nblocks; i += 8) {
+        size_t n = (nblocks - i < 8) ? (nblocks - i) : 8;
+        uint8_t* b = buf + i * 16;
+
+        memcpy(cur, b, n * 16);
+        bs_load(q, b, n);
+        bs_decrypt8(q, &sk);
+        bs_store(b, q, n);
+
+        for (int j = 0; j < 16; j++) b[j] ^= iv[j];
+        for (size_t j = 1; j < n; j++) {
+            for (int k = 0; k < 16; k++) b[j * 16 + k] ^= cur[(j - 1) * 16 + k];
+        }
+        memcpy(iv, cur + (n - 1) * 16, 16);
+    }
+
+    secure_memzero(q, sizeof(q));
+    secure_memzero(&sk, sizeof(sk));
+}
+#endif /* 비트슬라이스 */
+
+/* ---------------- 백엔드 선택 (Dispatch) ---------------- */
+
+/*
+ * 백엔드별 함수 모음
+ * - cbc_encrypt/cbc_decrypt가 NULL이면 블록 함수를 반복 호출하는 공통 루프를 사용함
+ * - encrypt_blocks/decrypt_blocks는 독립적인 블록 여러 개(ECB)를 교차 처리하는 선택 함수
+ *   (NULL이면 블록 함수를 반복 호출함)
+ * - iv 인자는 [In/Out]: 종료 시 다음 호출에 이어 쓸 체이닝 값으로 갱신됨
+ * - cbc_encrypt_lanes는 서로 다른 메시지(키/체이닝 값이 각자 다름)의 블록 여러 개를
+ *   교차 처리하는 선택 함수 (다중 버퍼 CBC용, NULL이면 작업마다 CBC 루프를 차례로 돌림)
+ * - xts_crypt는 tweak 계산까지 합친 XTS 전체 블록 처리 선택 함수
+ *   (NULL이면 tweak을 묶음 단위로 만들어 encrypt_blocks/decrypt_blocks에 넘김)
+ * - ctr_cmac은 CTR 암복호화와 CMAC 체인을 블록마다 함께 처리하는 선택 함수
+ *   (NULL이면 묶음 단위로 키스트림을 만들고 L1에 남아 있는 동안 CMAC에 흡수함)
+ * - batch: CTR/GCM/XTS가 encrypt_blocks 한 번에 넘길 블록 수 (0이면 aes256_interleave)
+ */
+typedef struct {
+    const char* name;
+    int (*available)(void);
+    void (*key_expansion)(uint8_t* RoundKey, const uint8_t* Key);
+    void (*inv_key_expansion)(uint8_t* DecKey, const uint8_t* RoundKey);
+    void (*encrypt_block)(uint8_t* buf, const uint8_t* RoundKey);
+    void (*decrypt_block)(uint8_t* buf, const uint8_t* DecKey);
+    void (*encrypt_blocks)(uint8_t* buf, size_t nblocks, const uint8_t* RoundKey);
+    void (*decrypt_blocks)(uint8_t* buf, size_t nblocks, const uint8_t* DecKey);
+    void (*cbc_encrypt)(uint8_t* buf, size_t nblocks, const uint8_t* RoundKey, uint8_t* iv);
+    void (*cbc_decrypt)(uint8_t* buf, size_t nblocks, const uint8_t* DecKey, uint8_t* iv);
+    void (*cbc_encrypt_lanes)(uint8_t* const* blk, const uint8_t* const* prev, const uint8_t* const* rk, size_t n);
+    void (*xts_crypt)(uint8_t* buf, size_t nblocks, const uint8_t* key, uint8_t* tweak, int encrypt);
+    void (*ctr_cmac)(uint8_t* buf, size_t nblocks, const uint8_t* ctr_key, const uint8_t* mac_key,
+                     uint64_t* hi, uint64_t* lo, uint8_t* mac, int encrypt);
+    size_t batch;
+} aes256_ops_t;
+
+static int always_available(void) { return 1; }
+static int never_available(void) { return 0; }
+
+static const aes256_ops_t aes256_impls[AES256_IMPL_COUNT] = {
+    [AES256_IMPL_AUTO] = { .name = "auto", .available = never_available },
+    [AES256_IMPL_REF] = {
+        .name = "ref", .available = always_available,
+        .key_expansion = soft_key_expansion, .inv_key_expansion = soft_inv_key_expansion,
+        .encrypt_block = ref_encrypt_block, .decrypt_block = ref_decrypt_block,
+    },
+    [AES256_IMPL_TTABLE] = {
+        .name = "ttable", .available = always_available,
+        .key_expansion = soft_key_expansion, .inv_key_expansion = soft_inv_key_expansion,
+        .encrypt_block = ttable_encrypt_block, .decrypt_block = ttable_decrypt_block,
+        .encrypt_blocks = ttable_encrypt_blocks, .decrypt_blocks = ttable_decrypt_blocks,
+        .cbc_encrypt_lanes = ttable_cbc_encrypt_lanes,
+    },
+#ifdef AES256_HAVE_AESNI
+    [AES256_IMPL_AESNI] = {
+        .name = "aesni", .available = aesni_available,
+        .key_expansion = aesni_key_expansion, .inv_key_expansion = aesni_inv_key_expansion,
+        .encrypt_block = aesni_encrypt_block, .decrypt_block = aesni_decrypt_block,
+        .encrypt_blocks = aesni_encrypt_blocks,
+        .cbc_encrypt = aesni_cbc_encrypt, .cbc_decrypt = aesni_cbc_decrypt,
+        .cbc_encrypt_lanes = aesni_cbc_encrypt_lanes,
+        .xts_crypt = aesni_xts_crypt,
+        .ctr_cmac = aesni_ctr_cmac,
+    },
+#else
+    [AES256_IMPL_AESNI] = { .name = "aesni", .available = never_available },
+#endif
+#ifdef AES256_HAVE_BITSLICE
+    [AES256_IMPL_BITSLICE] = {
+        .name = "bitslice", .available = always_available,
+        .key_expansion = bitslice_key_expansion, .inv_key_expansion = bitslice_inv_key_expansion,
+        .encrypt_block = bitslice_encrypt_block, .decrypt_block = bitslice_decrypt_block,
+        .encrypt_blocks = bitslice_encrypt_blocks, .decrypt_blocks = bitslice_decrypt_blocks,
+        .cbc_encrypt = bitslice_cbc_encrypt, .cbc_decrypt = bitslice_cbc_decrypt,
+        .batch = 64, /* 키 전치 비용을 8묶음에 나누어 부담 */
+    },
+#else
+    [AES256_IMPL_BITSLICE] = { .name = "bitslice", .available = never_available },
+#endif
+};
+
+/* PCLMULQDQ 지원 여부 (시작 시 CPUID로 설정, 모든 백엔드의 GHASH에 사용) */
+static int aes256_cpu_clmul = 0;
+
+/*
+ * AUTO 선택 시 우선순위
+ * - AES-NI가 없으면 T-table보다 상수 시간인 비트슬라이스를 먼저 고름.
+ *   CBC 암호화처럼 직렬인 경로는 블록마다 8블록 비용이 들어 T-table보다 느리지만,
+ *   기본값에서 캐시 타이밍 누출을 피하는 쪽을 택함 (속도가 우선이면 AES256_SetImpl로 T-table 지정)
+ */
+static const aes256_impl_t aes256_auto_order[] = {
+    AES256_IMPL_AESNI,
+    AES256_IMPL_BITSLICE,
+    AES256_IMPL_TTABLE,
+    AES256_IMPL_REF,
+};
+
+/* 현재 선택된 백엔드 (시작 시 aes256_select_default에서 다시 결정됨) */
+static aes256_impl_t aes256_cur_id = AES256_IMPL_TTABLE;
+static const aes256_ops_t* aes256_cur = &aes256_impls[AES256_IMPL_TTABLE];
+
+/**
+ * @brief 해당 백엔드를 현재 CPU에서 사용할 수 있는지 확인함
+ * @return 사용 가능하면 1, 아니면 0
+ */
+int AES256_ImplAvailable(aes256_impl_t impl) {
+    if (impl == AES256_IMPL_AUTO) return 1;
+    if ((int)impl <= 0 || impl >= AES256_IMPL_COUNT) return 0;
+    return aes256_impls[impl].available();
+}
+
+/**
+ * @brief 백엔드 이름을 반환함 (로그/벤치마크 출력용)
+ */
+const char* AES256_ImplName(aes256_impl_t impl) {
+    if ((int)impl < 0 || impl >= AES256_IMPL_COUNT) return "unknown";
+    return aes256_impls[impl].name;
+}
+
+/**
+ * @brief 사용할 백엔드를 지정함
+ * @return 성공 시 0, 사용할 수 없는 백엔드이면 -1
+ */
+int AES256_SetImpl(aes256_impl_t impl) {
+    if (impl == AES256_IMPL_AUTO) {
+        for (size_t i = 0; i < sizeof(aes256_auto_order) / sizeof(aes256_auto_order[0]); i++) {
+            if (aes256_impls[aes256_auto_order[i]].available()) {
+                impl = aes256_auto_order[i];
+                break;
+            }
+        }
+    }
+    if (impl == AES256_IMPL_AUTO || !AES256_ImplAvailable(impl)) return -1;
+
+    AES256_CFG_STORE(aes256_cur_id, impl);
+    AES256_CFG_STORE(aes256_cur, &aes256_impls[impl]);
+    return 0;
+}
+
+/**
+ * @brief 현재 사용 중인 백엔드를 반환함
+ */
+aes256_impl_t AES256_GetImpl(void) {
+    return AES256_CFG_LOAD(aes256_cur_id);
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+/**
+ * @brief 프로그램 시작 시 CPUID를 확인하여 가장 빠른 백엔드를 선택함
+ * @details 우선순위를 지정해 다른 생성자(ase256_tune.c의 자동 조정 등)보다 먼저 실행되게 함
+ */
+__attribute__((constructor(101)))
+static void aes256_select_default(void) {
+#ifdef AES256_HAVE_AESNI
+    aes256_cpu_clmul = clmul_available();
+#endif
+    AES256_SetImpl(AES256_IMPL_AUTO);
+}
+#endif
+
+/* ---------------- 키 확장 (공개 API) ---------------- */
+
+/**
+ * @brief 256비트 키를 사용하여 라운드 키를 생성함
+ * @details 백엔드와 관계없이 결과 바이트 배치는 동일하므로 중간에 백엔드를 바꿔도 됨
+ * @return 성공 시 0, 실패 시 -1
+ */
+int KeyExpansion(uint8_t* RoundKey, const uint8_t* Key) {
+    if (RoundKey == NULL || Key == NULL) return -1;
+    AES256_CFG_LOAD(aes256_cur)->key_expansion(RoundKey, Key);
+    return 0;
+}
+
+/* ---------------- 블록 단위 암복호화 (16바이트) ---------------- */
+
+/**
+ * @brief 16바이트 블록 하나를 암호화함
+ * @return 성공 시 0, 실패 시 -1
+ */
+int AES256_EncryptBlock(uint8_t* buf, const uint8_t* RoundKey) {
+    if (buf == NULL || RoundKey == NULL) return -1;
+    AES256_CFG_LOAD(aes256_cur)->encrypt_block(buf, RoundKey);
+    return 0;
+}
+
+/* AES256_DecryptBlock용 스레드별 복호화 라운드 키 (마지막으로 쓴 키 하나만 보관) */
+static pthread_once_t deckey_once = PTHREAD_ONCE_INIT;
+static pthread_key_t deckey_tls_key;
+
+typedef struct {
+    uint8_t RoundKey[AES256_ROUNDKEY_SIZE];
+    uint8_t DecKey[AES256_ROUNDKEY_SIZE];
+    const aes256_ops_t* ops;    /* DecKey를 만든 백엔드 (NULL이면 비어 있음) */
+} deckey_thread_t;
+
+static __thread deckey_thread_t deckey_tls;
+
+/* 스레드가 끝날 때 보관한 키를 지움 */
+static void deckey_thread_exit(void* p) {
+    secure_memzero(p, sizeof(deckey_thread_t));
+}
+
+static void deckey_init_once(void) {
+    pthread_key_create(&deckey_tls_key, deckey_thread_exit);
+}
+
+/**
+ * @brief 16바이트 블록 하나를 복호화함
+ * @details 복호화 라운드 키는 스레드마다 마지막 키 하나를 보관해 두고, 같은 키와 백엔드로 다시 부르면
+ *          역 키 변환 없이 바로 사용함. 키 비교는 모든 바이트를 XOR로 누적하여 일치 위치가 드러나지 않게 함.
+ *          여러 키를 번갈아 쓰면 AES256_KeyInit + AES256_DecryptBlock_Key를 사용할 것
+ * @return 성공 시 0, 실패 시 -1
+ */
+int AES256_DecryptBlock(uint8_t* buf, const uint8_t* RoundKey) {
+    if (buf == NULL || RoundKey == NULL) return -1;
+    pthread_once(&deckey_once, deckey_init_once);
+
+    const aes256_ops_t* ops = AES256_CFG_LOAD(aes256_cur);
+    deckey_thread_t* t = &deckey_tls;
+    uint8_t diff = 0;
+    for (int i = 0; i < AES256_ROUNDKEY_SIZE; i++) diff |= (uint8_t)(t->RoundKey[i] ^ RoundKey[i]);
+
+    if (t->ops != ops || diff != 0) {
+        if (t->ops == NULL) pthread_setspecific(deckey_tls_key, t);
+        memcpy(t->RoundKey, RoundKey, AES256_ROUNDKEY_SIZE);
+        ops->inv_key_expansion(t->DecKey, RoundKey);
+        t->ops = ops;
+    }
+    ops->decrypt_block(buf, t->DecKey);
+    return 0;
+}
+
+/* ---------------- CBC 운영 모드 (Cipher Block Chaining) ---------------- */
+
+/**
+ * @brief 블록 단위 XOR 연산
+ */
+static void xor_block(uint8_t* dst, const uint8_t* src) {
+    for (int i = 0; i < 16; i++) dst[i] ^= src[i];
+}
+
+/**
+ * @brief 블록 함수를 반복 호출하는 CBC 암호화 공통 루프
+ * @param iv [In/Out] 체이닝 값, 종료 시 마지막 암호문 블록으로 갱신됨
+ */
+static void cbc_encrypt_blocks(const aes256_ops_t* ops, uint8_t* buf, size_t nblocks,
+                               const uint8_t* RoundKey, uint8_t* iv) {
+    if (ops->cbc_encrypt != NULL) {
+        ops->cbc_encrypt(buf, nblocks, RoundKey, iv);
+        return;
+    }
+
+    /* 직전 암호문 블록은 버퍼에 그대로 남아 있으므로 복사 없이 참조함 */
+    const uint8_t* prev = iv;
+    for (size_t i = 0; i < nblocks; i++) {
+        xor_block(buf + i * 16, prev);
+        ops->encrypt_block(buf + i * 16, RoundKey);
+        prev = buf + i * 16;
+    }
+    memcpy(iv, prev, 16);
+}
+
+/**
+ * @brief 블록 함수를 반복 호출하는 CBC 복호화 공통 루프
+ * @details 각 블록의 복호화는 암호문에만 의존하므로 aes256_interleave개씩 묶어
+ *          decrypt_blocks로 한꺼번에 복호화한 뒤 직전 암호문과 XOR함.
+ * @param iv [In/Out] 체이닝 값, 종료 시 마지막 암호문 블록으로 갱신됨
+ */
+static void cbc_decrypt_blocks(const aes256_ops_t* ops, uint8_t* buf, size_t nblocks,
+                               const uint8_t* DecKey, uint8_t* iv) {
+    if (ops->cbc_decrypt != NULL) {
+        ops->cbc_decrypt(buf, nblocks, DecKey, iv);
+        return;
+    }
+
+    size_t width = (ops->decrypt_blocks != NULL) ? (size_t)AES256_CFG_LOAD(aes256_interleave) : 1;
+    uint8_t cur[8 * 16];
+
+    for (size_t i = 0; i < nblocks; i += width) {
+        size_t n = (nblocks - i < width) ? (nblocks - i) : width;
+        uint8_t* b = buf + i * 16;
+
+        /* 제자리(in-place) 복호화로 지워질 암호문을 먼저 보관 */
+        memcpy(cur, b, n * 16);
+        if (n > 1) {
+            ops->decrypt_blocks(b, n, DecKey);
+        } else {
+            ops->decrypt_block(b, DecKey);
+        }
+
+        xor_block(b, iv);
+        for (size_t j = 1; j < n; j++) xor_block(b + j * 16, cur + (j - 1) * 16);
+        memcpy(iv, cur + (n - 1) * 16, 16);
+    }
+}
+
+#define AES256_MAX_THREADS 64
+
+/* CBC 병렬 복호화 작업 단위 */
+typedef struct {
+    const aes256_ops_t* ops;
+    uint8_t* buf;
+    size_t nblocks;
+    const uint8_t* DecKey;
+    uint8_t chain[16]; /* 구간 직전의 암호문 블록 (첫 구간은 IV) */
+} cbc_dec_task_t;
+
+static void* cbc_decrypt_worker(void* arg) {
+    cbc_dec_task_t* task = (cbc_dec_task_t*)arg;
+    cbc_decrypt_blocks(task->ops, task->buf, task->nblocks, task->DecKey, task->chain);
+    return NULL;
+}
+
+/**
+ * @brief 버퍼를 블록 경계에서 nthreads개 구간으로 나누어 동시에 복호화함
+ * @details 구간 경계의 암호문 블록은 앞 구간 스레드가 덮어쓰기 전에 미리 복사해 둠.
+ *          스레드 생성에 실패한 구간은 호출 스레드가 직접 처리함.
+ */
+static void cbc_decrypt_parallel(const aes256_ops_t* ops, uint8_t* buf, size_t nblocks,
+                                 const uint8_t* DecKey, const uint8_t* iv, int nthreads) {
+    cbc_dec_task_t tasks[AES256_MAX_THREADS];
+    pthread_t tids[AES256_MAX_THREADS];
+    int started[AES256_MAX_THREADS] = {0};
+
+    if (nthreads > AES256_MAX_THREADS) nthreads = AES256_MAX_THREADS;
+    if ((size_t)nthreads > nblocks) nthreads = (int)nblocks;
+
+    size_t per = nblocks / (size_t)nthreads;
+    size_t extra = nblocks % (size_t)nthreads;
+    size_t pos = 0;
+
+    for (int t = 0; t < nthreads; t++) {
+        tasks[t].ops = ops;
+        tasks[t].buf = buf + pos * 16;
+        tasks[t].nblocks = per + ((size_t)t < extra ? 1 : 0);
+        tasks[t].DecKey = DecKey;
+        memcpy(tasks[t].chain, (pos == 0) ? iv : buf + (pos - 1) * 16, 16);
+        pos += tasks[t].nblocks;
+    }
+
+    for (int t = 1; t < nthreads; t++) {
+        started[t] = (pthread_create(&tids[t], NULL, cbc_decrypt_worker, &tasks[t]) == 0);
+    }
+    cbc_decrypt_worker(&tasks[0]);
+    for (int t = 1; t < nthreads; t++) {
+        if (started[t]) {
+            pthread_join(tids[t], NULL);
+        } else {
+            cbc_decrypt_worker(&tasks[t]);
+        }
+    }
+
+    secure_memzero(tasks, sizeof(tasks));
+}
+
+/**
+ * @brief 데이터를 CBC 모드로 암호화함 (데이터 길이는 16의 배수여야 함)
+ * @return 성공 시 0, 실패 시 음수
+ */
+int AES256_CBC_Encrypt(uint8_t* buf, size_t len, const uint8_t* RoundKey, const uint8_t* iv) {
+    if (buf == NULL || RoundKey == NULL || iv == NULL) return -1;
+    if (len == 0 || len % 16 != 0) return -2;
+
+    uint8_t chain[16];
+    memcpy(chain, iv, 16);
+    cbc_encrypt_blocks(AES256_CFG_LOAD(aes256_cur), buf, len / 16, RoundKey, chain);
+    return 0;
+}
+
+/**
+ * @brief AES256_SetThreads 설정과 데이터 크기로 CBC 복호화 스레드 수를 정함
+ * @details 스레드당 최소 크기를 채우지 못하면 스레드 수를 줄임
+ */
+static int cbc_decrypt_threads(size_t len) {
+    size_t max_threads = len / AES256_CFG_LOAD(aes256_split_bytes);
+    int nthreads = AES256_CFG_LOAD(aes256_threads);
+    if ((size_t)nthreads > max_threads) nthreads = (max_threads > 0) ? (int)max_threads : 1;
+    return nthreads;
+}
+
+/**
+ * @brief 이미 계산된 복호화 라운드 키로 CBC 복호화함 (인자 검사는 호출자가 함)
+ */
+static void cbc_decrypt_deckey(const aes256_ops_t* ops, uint8_t* buf, size_t len,
+                               const uint8_t* DecKey, const uint8_t* iv, int nthreads) {
+    if (nthreads > 1 && len / 16 > 1) {
+        cbc_decrypt_parallel(ops, buf, len / 16, DecKey, iv, nthreads);
+    } else {
+        uint8_t chain[16];
+        memcpy(chain, iv, 16);
+        cbc_decrypt_blocks(ops, buf, len / 16, DecKey, chain);
+    }
+}
+
+/**
+ * @brief 데이터를 CBC 모드로 복호화함 (데이터 길이는 16의 배수여야 함)
+ * @details AES256_SetThreads로 2 이상을 지정하면 큰 버퍼는 여러 스레드로 나누어 처리함
+ * @return 성공 시 0, 실패 시 음수
+ */
+int AES256_CBC_Decrypt(uint8_t* buf, size_t len, const uint8_t* RoundKey, const uint8_t* iv) {
+    if (buf == NULL || RoundKey == NULL || iv == NULL) return -1;
+    if (len == 0 || len % 16 != 0) return -2;
+
+    return AES256_CBC_Decrypt_MT(buf, len, RoundKey, iv, cbc_decrypt_threads(len));
+}
+
+/**
+ * @brief 지정한 스레드 수로 CBC 복호화함 (데이터 길이는 16의 배수여야 함)
+ * @param nthreads 사용할 스레드 수 (1 이하이면 단일 스레드)
+ * @return 성공 시 0, 실패 시 음수
+ */
+int AES256_CBC_Decrypt_MT(uint8_t* buf, size_t len, const uint8_t* RoundKey, const uint8_t* iv, int nthreads) {
+    if (buf == NULL || RoundKey == NULL || iv == NULL) return -1;
+    if (len == 0 || len % 16 != 0) return -2;
+
+    const aes256_ops_t* ops = AES256_CFG_LOAD(aes256_cur);
+    uint8_t DecKey[AES256_ROUNDKEY_SIZE];
+
+    /* 복호화 라운드 키는 호출당 한 번만 계산하여 모든 스레드가 공유함 */
+    ops->inv_key_expansion(DecKey, RoundKey);
+    cbc_decrypt_deckey(ops, buf, len, DecKey, iv, nthreads);
+
+    secure_memzero(DecKey, sizeof(DecKey));
+    return 0;
+}
+
+/* ---------------- 키 스케줄 객체와 캐시 ---------------- */
+
+/**
+ * @brief 암호화 라운드 키와 등가 역암호용 복호화 라운드 키를 함께 만듦
+ * @details 복호화 라운드 키는 백엔드와 관계없이 같은 배치이므로 이후 백엔드를 바꿔도 됨
+ * @return 성공 시 0, 실패 시 -1
+ */
+int AES256_KeyInit(AES256_KEY* key, const uint8_t* Key) {
+    if (key == NULL || Key == NULL) return -1;
+
+    const aes256_ops_t* ops = AES256_CFG_LOAD(aes256_cur);
+    ops->key_expansion(key->RoundKey, Key);
+    ops->inv_key_expansion(key->DecKey, key->RoundKey);
+    return 0;
+}
+
+void AES256_KeyClear(AES256_KEY* key) {
+    secure_memzero(key, sizeof(*key));
+}
+
+/**
+ * @brief 미리 계산된 복호화 라운드 키로 블록 하나를 복호화함
+ * @return 성공 시 0, 실패 시 -1
+ */
+int AES256_DecryptBlock_Key(uint8_t* buf, const AES256_KEY* key) {
+    if (buf == NULL || key == NULL) return -1;
+    AES256_CFG_LOAD(aes256_cur)->decrypt_block(buf, key->DecKey);
+    return 0;
+}
+
+/**
+ * @brief 미리 계산된 복호화 라운드 키로 CBC 복호화함 (역 키 변환 생략)
+ * @details 스레드 수는 AES256_CBC_Decrypt와 같은 규칙(AES256_SetThreads)을 따름
+ * @return 성공 시 0, 실패 시 음수
+ */
+int AES256_CBC_Decrypt_Key(uint8_t* buf, size_t len, const AES256_KEY* key, const uint8_t* iv) {
+    if (buf == NULL || key == NULL || iv == NULL) return -1;
+    if (len == 0 || len % 16 != 0) return -2;
+
+    cbc_decrypt_deckey(AES256_CFG_LOAD(aes256_cur), buf, len, key->DecKey, iv, cbc_decrypt_threads(len));
+    return 0;
+}
+
+/*
+ * 키 ID별 LRU 캐시
+ * - 항목은 캐시 라인(64바이트) 경계에 맞춘 고정 배열에 두고, ID -> 항목 조회는 체이닝 해시로 함
+ * - LRU 목록은 살아 있는 항목 전체를 사용 순서대로 연결하며, 꺼낼 때는 사용 중(refs > 0)인 항목을 건너뜀
+ * - 제거/교체된 항목이 아직 사용 중이면 ID만 끊어 두고(dead) 마지막 Release에서 소거함
+ * - 비어 있거나 제거된 슬롯의 키 바이트는 항상 0으로 지워져 있음
+ */
+#define KEY_CACHE_NIL (-1)
+
+typedef struct {
+    _Alignas(64) AES256_KEY key;
+    uint64_t id;
+    int32_t hnext;              /* 같은 해시 버킷의 다음 항목 */
+    int32_t prev, next;         /* LRU 목록 (prev 방향이 최근) */
+    int32_t refs;
+    uint8_t state;              /* 0: 빈 슬롯, 1: 사용 가능, 2: 제거됨(사용 중이라 소거 대기) */
+} key_cache_entry_t;
+
+struct AES256_KEY_CACHE {
+    key_cache_entry_t* entries;
+    int32_t* buckets;
+    size_t capacity;
+    size_t bucket_mask;
+    int32_t lru_head, lru_tail; /* head: 가장 최근, tail: 가장 오래됨 */
+    int32_t free_head;          /* 빈 슬롯 목록 (next로 연결) */
+    size_t live;
+    uint64_t hits, misses, evictions;
+    pthread_mutex_t lock;
+};
+
+enum { KEY_SLOT_FREE = 0, KEY_SLOT_LIVE = 1, KEY_SLOT_DEAD = 2 };
+
+static size_t key_cache_bucket(const AES256_KEY_CACHE* c, uint64_t id) {
+    return (size_t)((id * 0x9E3779B97F4A7C15ULL) >> 32) & c->bucket_mask;
+}
+
+static void key_cache_lru_unlink(AES256_KEY_CACHE* c, int32_t i) {
+    key_cache_entry_t* e = &c->entries[i];
+    if (e->prev != KEY_CACHE_NIL) c->entries[e->prev].next = e->next;
+    else c->lru_head = e->next;
+    if (e->next != KEY_CACHE_NIL) c->entries[e->next].prev = e->prev;
+    else c->lru_tail = e->prev;
+    e->prev = e->next = KEY_CACHE_NIL;
+}
+
+static void key_cache_lru_push_front(AES256_KEY_CACHE* c, int32_t i) {
+    key_cache_entry_t* e = &c->entries[i];
+    e->prev = KEY_CACHE_NIL;
+    e->next = c->lru_head;
+    if (c->lru_head != KEY_CACHE_NIL) c->entries[c->lru_head].prev = i;
+    c->lru_head = i;
+    if (c->lru_tail == KEY_CACHE_NIL) c->lru_tail = i;
+}
+
+static void key_cache_hash_unlink(AES256_KEY_CACHE* c, int32_t i) {
+    int32_t* link = &c->buckets[key_cache_bucket(c, c->entries[i].id)];
+    while (*link != i) link = &c->entries[*link].hnext;
+    *link = c->entries[i].hnext;
+    c->entries[i].hnext = KEY_CACHE_NIL;
+}
+
+/* 키를 소거하고 슬롯을 빈 목록에 돌려줌 */
+static void key_cache_free_slot(AES256_KEY_CACHE* c, int32_t i) {
+    key_cache_entry_t* e = &c->entries[i];
+    secure_memzero(&e->key, sizeof(e->key));
+    e->id = 0;
+    e->refs = 0;
+    e->state = KEY_SLOT_FREE;
+    e->prev = KEY_CACHE_NIL;
+    e->next = c->free_head;
+    c->free_head = i;
+}
+
+/* 살아 있는 항목을 ID 목록과 LRU에서 떼어내고, 사용 중이 아니면 바로 소거함 */
+static void key_cache_detach(AES256_KEY_CACHE* c, int32_t i) {
+    key_cache_hash_unlink(c, i);
+    key_cache_lru_unlink(c, i);
+    c->live--;
+    if (c->entries[i].refs > 0) {
+        c->entries[i].state = KEY_SLOT_DEAD;
+    } else {
+        key_cache_free_slot(c, i);
+    }
+}
+
+/**
+ * @brief 키 스케줄 캐시를 만듦
+ * @param capacity 동시에 보관할 키 수 (1 이상)
+ * @return 캐시 핸들, 실패 시 NULL
+ */
+AES256_KEY_CACHE* AES256_KeyCacheCreate(size_t capacity) {
+    if (capacity == 0 || capacity > (size_t)INT32_MAX / 2) return NULL;
+
+    AES256_KEY_CACHE* c = (AES256_KEY_CACHE*)calloc(1, sizeof(AES256_KEY_CACHE));
+    if (c == NULL) return NULL;
+
+    size_t nbuckets = 1;
+    while (nbuckets < capacity * 2) nbuckets <<= 1;
+
+    c->entries = (key_cache_entry_t*)aligned_alloc(64, capacity * sizeof(key_cache_entry_t));
+    c->buckets = (int32_t*)malloc(nbuckets * sizeof(int32_t));
+    if (c->entries == NULL || c->buckets == NULL || pthread_mutex_init(&c->lock, NULL) != 0) {
+        free(c->entries);
+        free(c->buckets);
+        free(c);
+        return NULL;
+    }
+
+    memset(c->entries, 0, capacity * sizeof(key_cache_entry_t));
+    for (size_t b = 0; b < nbuckets; b++) c->buckets[b] = KEY_CACHE_NIL;
+    c->capacity = capacity;
+    c->bucket_mask = nbuckets - 1;
+    c->lru_head = c->lru_tail = KEY_CACHE_NIL;
+    c->free_head = KEY_CACHE_NIL;
+    for (size_t i = capacity; i-- > 0;) {
+        c->entries[i].hnext = KEY_CACHE_NIL;
+        c->entries[i].next = c->free_head;
+        c->free_head = (int32_t)i;
+    }
+    return c;
+}
+
+/**
+ * @brief 캐시의 모든 키를 소거하고 해제함 (사용 중인 항목이 없어야 함)
+ */
+void AES256_KeyCacheDestroy(AES256_KEY_CACHE* cache) {
+    if (cache == NULL) return;
+    secure_memzero(cache->entries, cache->capacity * sizeof(key_cache_entry_t));
+    pthread_mutex_destroy(&cache->lock);
+    free(cache->entries);
+    free(cache->buckets);
+    free(cache);
+}
+
+/**
+ * @brief 키 ID에 해당하는 키 스케줄을 꺼내 사용 중으로 표시함
+ * @details 캐시에 없으면 Key로 두 라운드 키를 계산해 넣고, 자리가 없으면 사용 중이 아닌
+ *          가장 오래된 항목을 소거하고 그 자리를 씀. 같은 ID로 다른 키가 들어오면
+ *          (키 교체) 기존 항목을 버리고 새로 계산함.
+ * @param Key 32바이트 키, NULL이면 조회만 하고 없을 때 NULL 반환
+ * @return 키 스케줄 (AES256_KeyCacheRelease 전까지 유효), 실패 시 NULL
+ */
+const AES256_KEY* AES256_KeyCacheAcquire(AES256_KEY_CACHE* cache, uint64_t key_id, const uint8_t* Key) {
+    if (cache == NULL) return NULL;
+
+    pthread_mutex_lock(&cache->lock);
+    AES256_KEY_CACHE* c = cache;
+    int32_t i = c->buckets[key_cache_bucket(c, key_id)];
+    while (i != KEY_CACHE_NIL && c->entries[i].id != key_id) i = c->entries[i].hnext;
+
+    if (i != KEY_CACHE_NIL) {
+        /* AES-256 라운드 키의 앞 32바이트는 원래 키이므로 교체 여부를 바로 비교할 수 있음 */
+        uint8_t diff = 0;
+        if (Key != NULL) {
+            for (int k = 0; k < 32; k++) diff |= (uint8_t)(c->entries[i].key.RoundKey[k] ^ Key[k]);
+        }
+        if (diff == 0) {
+            c->hits++;
+            c->entries[i].refs++;
+            key_cache_lru_unlink(c, i);
+            key_cache_lru_push_front(c, i);
+            pthread_mutex_unlock(&c->lock);
+            return &c->entries[i].key;
+        }
+        key_cache_detach(c, i);
+    }
+
+    c->misses++;
+    if (Key == NULL) {
+        pthread_mutex_unlock(&c->lock);
+        return NULL;
+    }
+
+    if (c->free_head == KEY_CACHE_NIL) {
+        int32_t victim = c->lru_tail;
+        while (victim != KEY_CACHE_NIL && c->entries[victim].refs > 0) victim = c->entries[victim].prev;
+        if (victim == KEY_CACHE_NIL) {
+            /* 모든 항목이 사용 중 */
+            pthread_mutex_unlock(&c->lock);
+            return NULL;
+        }
+        key_cache_detach(c, victim);
+        c->evictions++;
+    }
+
+    i = c->free_head;
+    key_cache_entry_t* e = &c->entries[i];
+    c->free_head = e->next;
+
+    AES256_KeyInit(&e->key, Key);
+    e->id = key_id;
+    e->refs = 1;
+    e->state = KEY_SLOT_LIVE;
+    size_t b = key_cache_bucket(c, key_id);
+    e->hnext = c->buckets[b];
+    c->buckets[b] = i;
+    key_cache_lru_push_front(c, i);
+    c->live++;
+
+    pthread_mutex_unlock(&c->lock);
+    return &e->key;
+}
+
+/**
+ * @brief AES256_KeyCacheAcquire로 꺼낸 키 스케줄의 사용을 마침
+ */
+void AES256_KeyCacheRelease(AES256_KEY_CACHE* cache, const AES256_KEY* key) {
+    if (cache == NULL || key == NULL) return;
+
+    /* key는 항목의 첫 멤버이므로 주소로 슬롯 번호를 구함 */
+    size_t off = (size_t)((const uint8_t*)key - (const uint8_t*)cache->entries);
+    size_t i = off / sizeof(key_cache_entry_t);
+    if ((const uint8_t*)key < (const uint8_t*)cache->entries || i >= cache->capacity ||
+        off % sizeof(key_cache_entry_t) != 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    key_cache_entry_t* e = &cache->entries[i];
+    if (e->refs > 0 && --e->refs == 0 && e->state == KEY_SLOT_DEAD) key_cache_free_slot(cache, (int32_t)i);
+    pthread_mutex_unlock(&cache->lock);
+}
+
+/**
+ * @brief 키 ID를 캐시에서 지움 (키 폐기 시)
+ * @details 사용 중이면 더 이상 조회되지 않게만 하고, 마지막 Release에서 소거함
+ * @return 지웠으면 0, 없는 ID이면 -1
+ */
+int AES256_KeyCacheRemove(AES256_KEY_CACHE* cache, uint64_t key_id) {
+    if (cache == NULL) return -1;
+
+    pthread_mutex_lock(&cache->lock);
+    int32_t i = cache->buckets[key_cache_bucket(cache, key_id)];
+    while (i != KEY_CACHE_NIL && cache->entries[i].id != key_id) i = cache->entries[i].hnext;
+    if (i != KEY_CACHE_NIL) key_cache_detach(cache, i);
+    pthread_mutex_unlock(&cache->lock);
+    return (i != KEY_CACHE_NIL) ? 0 : -1;
+}
+
+void AES256_KeyCacheStats(AES256_KEY_CACHE* cache, AES256_KEY_CACHE_STATS* stats) {
+    if (cache == NULL || stats == NULL) return;
+
+    pthread_mutex_lock(&cache->lock);
+    stats->hits = cache->hits;
+    stats->misses = cache->misses;
+    stats->evictions = cache->evictions;
+    stats->entries = cache->live;
+    pthread_mutex_unlock(&cache->lock);
+}
+
+/* ---------------- CBC 다중 버퍼 암호화 ---------------- */
+
+/*
+ * 한 메시지 안의 CBC 암호화는 직렬이지만, 서로 독립된 메시지(키/IV가 각자 다름)끼리는
+ * 블록을 나란히 처리할 수 있음. 레인 aes256_interleave개에 작업을 하나씩 배정하고,
+ * 매 단계 각 레인의 다음 블록을 모아 cbc_encrypt_lanes로 한 번에 암호화함.
+ * 작업이 끝난 레인에는 곧바로 다음 작업을 채워 넣어 파이프라인이 비지 않게 함.
+ */
+
+static int cbc_job_check(const AES256_CBC_JOB* job) {
+    if (job->buf == NULL || job->RoundKey == NULL || job->iv == NULL) return -1;
+    if (job->len == 0 || job->len % 16 != 0) return -2;
+    return 0;
+}
+
+/**
+ * @brief 독립된 메시지 여러 개를 CBC 모드로 암호화함 (각 작업의 길이는 16의 배수)
+ * @details 작업별 결과는 jobs[i].result에 기록됨 (0 성공, -1 인자 오류, -2 길이 오류)
+ * @return 모든 작업 성공 시 0, jobs가 NULL이면 -1, 실패한 작업이 있으면 -2
+ */
+int AES256_CBC_Encrypt_Multi(AES256_CBC_JOB* jobs, size_t njobs) {
+    if (jobs == NULL && njobs > 0) return -1;
+
+    const aes256_ops_t* ops = AES256_CFG_LOAD(aes256_cur);
+    int ret = 0;
+
+    for (size_t i = 0; i < njobs; i++) {
+        jobs[i].result = cbc_job_check(&jobs[i]);
+        if (jobs[i].result != 0) ret = -2;
+    }
+
+    /* 교차 처리 함수가 없는 백엔드는 작업마다 CBC 루프를 돌림 */
+    if (ops->cbc_encrypt_lanes == NULL) {
+        for (size_t i = 0; i < njobs; i++) {
+            if (jobs[i].result != 0) continue;
+            uint8_t chain[16];
+            memcpy(chain, jobs[i].iv, 16);
+            cbc_encrypt_blocks(ops, jobs[i].buf, jobs[i].len / 16, jobs[i].RoundKey, chain);
+        }
+        return ret;
+    }
+
+    size_t width = (size_t)AES256_CFG_LOAD(aes256_interleave);
+    uint8_t* cur[8];
+    uint8_t* end[8];
+    const uint8_t* prev[8];
+    const uint8_t* rk[8];
+    size_t nlanes = 0, next = 0;
+
+    for (;;) {
+        /* 1. 빈 레인에 다음 작업을 배정 */
+        while (nlanes < width && next < njobs) {
+            AES256_CBC_JOB* job = &jobs[next++];
+            if (job->result != 0) continue;
+            cur[nlanes] = job->buf;
+            end[nlanes] = job->buf + job->len;
+            prev[nlanes] = job->iv;
+            rk[nlanes] = job->RoundKey;
+            nlanes++;
+        }
+        if (nlanes == 0) break;
+
+        /* 2. 레인별 다음 평문 블록을 (체이닝 값 XOR 포함) 한꺼번에 암호화 */
+        ops->cbc_encrypt_lanes(cur, prev, rk, nlanes);
+
+        /* 3. 직전 암호문 블록은 버퍼에 남아 있으므로 포인터만 갱신, 끝난 작업은 레인에서 제거 */
+        for (size_t l = 0; l < nlanes; ) {
+            prev[l] = cur[l];
+            cur[l] += 16;
+            if (cur[l] == end[l]) {
+                nlanes--;
+                cur[l] = cur[nlanes];
+                end[l] = end[nlanes];
+                prev[l] = prev[nlanes];
+                rk[l] = rk[nlanes];
+            } else {
+                l++;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/* ---------------- CBC 스트리밍 (init/update/final, PKCS#7) ---------------- */
+
+static int cbc_stream_init(AES256_CBC_CTX* ctx, const uint8_t* Key, const uint8_t* iv, int encrypt) {
+    if (ctx == NULL || Key == NULL || iv == NULL) return -1;
+
+    const aes256_ops_t* ops = AES256_CFG_LOAD(aes256_cur);
+    ops->key_expansion(ctx->RoundKey, Key);
+    if (!encrypt) {
+        /* 복호화 라운드 키는 스트림 전체에서 한 번만 계산 */
+        uint8_t tmp[AES256_ROUNDKEY_SIZE];
+        memcpy(tmp, ctx->RoundKey, sizeof(tmp));
+        ops->inv_key_expansion(ctx->RoundKey, tmp);
+        secure_memzero(tmp, sizeof(tmp));
+    }
+    memcpy(ctx->iv, iv, 16);
+    secure_memzero(ctx->buf, sizeof(ctx->buf));
+    ctx->buf_len = 0;
+    ctx->encrypt = encrypt;
+    return 0;
+}
+
+/**
+ * @brief 스트리밍 CBC 암호화를 시작함 (키 확장 결과와 IV를 컨텍스트에 보관)
+ * @return 성공 시 0, 실패 시 -1
+ */
+int AES256_CBC_EncryptInit(AES256_CBC_CTX* ctx, const uint8_t* Key, const uint8_t* iv) {
+    return cbc_stream_init(ctx, Key, iv, 1);
+}
+
+/**
+ * @brief 스트리밍 CBC 복호화를 시작함
+ * @return 성공 시 0, 실패 시 -1
+ */
+int AES256_CBC_DecryptInit(AES256_CBC_CTX* ctx, const uint8_t* Key, const uint8_t* iv) {
+    return cbc_stream_init(ctx, Key, iv, 0);
+}
+
+/**
+ * @brief 임의 길이 입력을 받아 완성된 블록만 암호화/복호화하여 출력함
+ * @details 블록을 채우지 못한 나머지는 컨텍스트에 보관함.
+ *          복호화 시에는 패딩 제거를 위해 마지막 블록을 Final까지 출력하지 않음.
+ * @param out     [Out] 결과 버퍼 (in_len + 16바이트 이상)
+ * @param out_len [Out] 실제로 출력한 바이트 수 (16의 배수)
+ * @return 성공 시 0, 실패 시 -1
+ */
+int AES256_CBC_Update(AES256_CBC_CTX* ctx, const uint8_t* in, size_t in_len, uint8_t* out, size_t* out_len) {
+    if (ctx == NULL || out == NULL || out_len == NULL || (in == NULL && in_len > 0)) return -1;
+
+    size_t total = ctx->buf_len + in_len;
+    size_t keep = total % 16;
+
+    /* 복호화: 입력이 블록 경계에서 끝나면 마지막 블록은 패딩일 수 있으므로 남겨 둠 */
+    if (!ctx->encrypt && keep == 0 && total > 0) keep = 16;
+
+    size_t nout = total - keep;
+    if (nout == 0) {
+        if (in_len > 0) memcpy(ctx->buf + ctx->buf_len, in, in_len);
+        ctx->buf_len = total;
+        *out_len = 0;
+        return 0;
+    }
+
+    /* 보관 중이던 조각 + 새 입력을 출력 버퍼에 이어 붙여 제자리 처리 */
+    size_t consumed = nout - ctx->buf_len;
+    memcpy(out, ctx->buf, ctx->buf_len);
+    memcpy(out + ctx->buf_len, in, consumed);
+
+    if (ctx->encrypt) {
+        cbc_encrypt_blocks(AES256_CFG_LOAD(aes256_cur), out, nout / 16, ctx->RoundKey, ctx->iv);
+    } else {
+        cbc_decrypt_blocks(AES256_CFG_LOAD(aes256_cur), out, nout / 16, ctx->RoundKey, ctx->iv);
+    }
+
+    memcpy(ctx->buf, in + consumed, keep);
+    ctx->buf_len = keep;
+    *out_len = nout;
+    return 0;
+}
+
+/**
+ * @brief 스트림을 마무리하고 컨텍스트를 지움
+ * @details 암호화: 남은 데이터에 PKCS#7 패딩을 붙여 마지막 블록(16바이트)을 출력.
+ *          복호화: 보관한 마지막 블록을 복호화하고 패딩을 검증/제거하여 출력 (0~15바이트).
+ * @return 성공 시 0, 실패 시 -1, 입력 길이가 16의 배수가 아니면 -2, 패딩 오류 시 -3
+ */
+int AES256_CBC_Final(AES256_CBC_CTX* ctx, uint8_t* out, size_t* out_len) {
+    if (ctx == NULL || out == NULL || out_len == NULL) return -1;
+
+    int ret = 0;
+    *out_len = 0;
+
+    if (ctx->encrypt) {
+        uint8_t pad = (uint8_t)(16 - ctx->buf_len);
+        memcpy(out, ctx->buf, ctx->buf_len);
+        memset(out + ctx->buf_len, pad, pad);
+        cbc_encrypt_blocks(AES256_CFG_LOAD(aes256_cur), out, 1, ctx->RoundKey, ctx->iv);
+        *out_len = 16;
+    } else if (ctx->buf_len != 16) {
+        ret = -2;
+    } else {
+        uint8_t block[16];
+        memcpy(block, ctx->buf, 16);
+        cbc_decrypt_blocks(AES256_CFG_LOAD(aes256_cur), block, 1, ctx->RoundKey, ctx->iv);
+
+        /* 패딩 값에 따라 분기하지 않고 모든 바이트를 검사 */
+        uint8_t pad = block[15];
+        uint8_t bad = (uint8_t)((pad == 0) | (pad > 16));
+        for (int i = 0; i < 16; i++) {
+            uint8_t in_pad = (uint8_t)(i >= 16 - pad);
+            bad |= (uint8_t)(in_pad & (block[i] != pad));
+        }
+
+        if (bad) {
+            ret = -3;
+        } else {
+            memcpy(out, block, (size_t)(16 - pad));
+            *out_len = (size_t)(16 - pad);
+        }
+        secure_memzero(block, sizeof(block));
+    }
+
+    AES256_CBC_Cleanup(ctx);
+    return ret;
+}
+
+/**
+ * @brief 컨텍스트에 남은 키와 데이터를 지움 (Final 없이 중단할 때 사용)
+ */
+void AES256_CBC_Cleanup(AES256_CBC_CTX* ctx) {
+    if (ctx != NULL) secure_memzero(ctx, sizeof(*ctx));
+}
+
+/* ---------------- CBC 분산/수집 (iovec) ---------------- */
+
+/*
+ * 헤더/본문/트레일러처럼 여러 버퍼로 나뉜 메시지를 하나로 모으지 않고 그대로 암복호화함
+ * - 체이닝 값은 세그먼트 경계를 넘어 이어지며, 두 세그먼트에 걸친 블록은 16바이트 임시
+ *   버퍼로 모아 처리한 뒤 출력 쪽 세그먼트들에 다시 나누어 씀
+ * - 제자리 처리는 입력 세그먼트의 연속 구간을 복사 없이 블록 함수로 바로 처리함
+ * - 출력이 따로 있으면 출력 세그먼트의 연속 구간(최대 AES256_IOV_CHUNK)으로 입력을 모은 뒤
+ *   제자리 처리하므로, 출력이 한 버퍼이면 입력이 여러 조각이어도 블록 함수 호출은 구간당 한 번임
+ */
+
+/* 출력 세그먼트가 따로 있을 때 한 번에 복사 후 처리할 최대 크기 (L1 캐시 안에 머무는 크기) */
+#define AES256_IOV_CHUNK (16 * 1024)
+
+/* iovec 목록 위의 읽기/쓰기 위치 */
+typedef struct {
+    const struct iovec* v;
+    int cnt;
+    int idx;
+    size_t off;
+} iov_cursor_t;
+
+/**
+ * @brief 현재 세그먼트에서 연속으로 남은 바이트 수 (빈 세그먼트는 건너뜀)
+ */
+static size_t iov_contig(iov_cursor_t* c) {
+    while (c->idx < c->cnt && c->off == c->v[c->idx].iov_len) {
+        c->idx++;
+        c->off = 0;
+    }
+    return (c->idx < c->cnt) ? c->v[c->idx].iov_len - c->off : 0;
+}
+
+static uint8_t* iov_ptr(const iov_cursor_t* c) {
+    return (uint8_t*)c->v[c->idx].iov_base + c->off;
+}
+
+/* n바이트를 세그먼트 경계를 넘어 읽거나(to_iov = 0) 씀(to_iov = 1) */
+static void iov_copy(iov_cursor_t* c, uint8_t* tmp, size_t n, int to_iov) {
+    while (n > 0) {
+        size_t k = iov_contig(c);
+        if (k > n) k = n;
+        if (to_iov) memcpy(iov_ptr(c), tmp, k);
+        else memcpy(tmp, iov_ptr(c), k);
+        c->off += k;
+        tmp += k;
+        n -= k;
+    }
+}
+
+/**
+ * @brief iovec 목록의 총 길이를 구함
+ * @return 총 바이트 수, 인자 오류(NULL 세그먼트, 개수 음수, 합 넘침) 시 SIZE_MAX
+ */
+static size_t iov_total(const struct iovec* v, int cnt) {
+    if (cnt < 0 || (v == NULL && cnt > 0)) return SIZE_MAX;
+    size_t total = 0;
+    for (int i = 0; i < cnt; i++) {
+        if (v[i].iov_base == NULL && v[i].iov_len > 0) return SIZE_MAX;
+        if (v[i].iov_len > SIZE_MAX - 1 - total) return SIZE_MAX;
+        total += v[i].iov_len;
+    }
+    return total;
+}
+
+/**
+ * @brief 분산된 입력을 CBC로 처리하여 출력 세그먼트들에 씀
+ * @param key 암호화 시 라운드 키, 복호화 시 복호화 라운드 키
+ */
+static void cbc_crypt_iov(const aes256_ops_t* ops, const struct iovec* in, int in_cnt,
+                          const struct iovec* out, int out_cnt, size_t total,
+                          const uint8_t* key, uint8_t* chain, int encrypt) {
+    iov_cursor_t src = { in, in_cnt, 0, 0 };
+    iov_cursor_t dst = { out, out_cnt, 0, 0 };
+    int in_place = (out == in);
+    uint8_t tmp[16];
+
+    while (total > 0) {
+        /* 제자리이면 입력 세그먼트, 아니면 출력 세그먼트에서 연속된 구간을 한 번에 처리 */
+        size_t run = in_place ? iov_contig(&src) : iov_contig(&dst);
+        if (!in_place && run > AES256_IOV_CHUNK) run = AES256_IOV_CHUNK;
+        if (run > total) run = total;
+        run &= ~(size_t)15;
+
+        if (run == 0) {
+            /* 세그먼트 경계에 걸친 블록: 모아서 처리한 뒤 출력 쪽에 다시 나누어 씀 */
+            iov_copy(&src, tmp, 16, 0);
+            if (encrypt) cbc_encrypt_blocks(ops, tmp, 1, key, chain);
+            else cbc_decrypt_blocks(ops, tmp, 1, key, chain);
+            iov_copy(&dst, tmp, 16, 1);
+            total -= 16;
+            continue;
+        }
+
+        /* 별도 출력이면 입력(여러 세그먼트일 수 있음)을 출력 구간으로 모은 뒤 제자리 처리.
+           제자리일 때 dst는 끝난 세그먼트 끝에 머물러 있을 수 있으므로 먼저 다음 세그먼트로 넘김 */
+        iov_contig(&dst);
+        uint8_t* p = iov_ptr(&dst);
+        if (in_place) src.off += run;
+        else iov_copy(&src, p, run, 0);
+        if (encrypt) cbc_encrypt_blocks(ops, p, run / 16, key, chain);
+        else cbc_decrypt_blocks(ops, p, run / 16, key, chain);
+        dst.off += run;
+        total -= run;
+    }
+    secure_memzero(tmp, sizeof(tmp));
+}
+
+static int cbc_iov(const struct iovec* in, int in_cnt, const struct iovec* out, int out_cnt,
+                   const uint8_t* RoundKey, const uint8_t* iv, int encrypt) {
+    if (RoundKey == NULL || iv == NULL) return -1;
+    if (out == NULL) {
+        out = in;
+        out_cnt = in_cnt;
+    }
+
+    size_t total = iov_total(in, in_cnt);
+    size_t out_total = iov_total(out, out_cnt);
+    if (total == SIZE_MAX || out_total == SIZE_MAX) return -1;
+    if (total == 0 || total % 16 != 0 || out_total < total) return -2;
+
+    const aes256_ops_t* ops = AES256_CFG_LOAD(aes256_cur);
+    uint8_t chain[16];
+    memcpy(chain, iv, 16);
+
+    if (encrypt) {
+        cbc_crypt_iov(ops, in, in_cnt, out, out_cnt, total, RoundKey, chain, 1);
+    } else {
+        uint8_t DecKey[AES256_ROUNDKEY_SIZE];
+        ops->inv_key_expansion(DecKey, RoundKey);
+        cbc_crypt_iov(ops, in, in_cnt, out, out_cnt, total, DecKey, chain, 0);
+        secure_memzero(DecKey, sizeof(DecKey));
+    }
+    return 0;
+}
+
+/**
+ * @brief 여러 세그먼트로 나뉜 메시지를 이어진 하나의 메시지처럼 CBC 암호화함
+ * @details 세그먼트 길이는 자유롭지만 전체 길이는 16의 배수여야 함.
+ *          out이 NULL이면 입력 세그먼트에 제자리로 쓰고, 아니면 out 세그먼트들에
+ *          (배치가 입력과 달라도 됨) 차례로 씀. 입력과 출력 메모리는 겹치면 안 됨.
+ * @param out_cnt 출력 세그먼트 수 (out의 총 길이는 입력 총 길이 이상)
+ * @return 성공 시 0, 인자 오류 -1, 길이 오류 -2
+ */
+int AES256_CBC_EncryptV(const struct iovec* in, int in_cnt, const struct iovec* out, int out_cnt,
+                        const uint8_t* RoundKey, const uint8_t* iv) {
+    return cbc_iov(in, in_cnt, out, out_cnt, RoundKey, iv, 1);
+}
+
+/**
+ * @brief 여러 세그먼트로 나뉜 CBC 암호문을 복호화함 (규칙은 AES256_CBC_EncryptV와 같음)
+ * @return 성공 시 0, 인자 오류 -1, 길이 오류 -2
+ */
+int AES256_CBC_DecryptV(const struct iovec* in, int in_cnt, const struct iovec* out, int out_cnt,
+                        const uint8_t* RoundKey, const uint8_t* iv) {
+    return cbc_iov(in, in_cnt, out, out_cnt, RoundKey, iv, 0);
+}
+
+/* ---------------- CTR 운영 모드 (Counter) ---------------- */
+
+/* CTR 키스트림을 한 번에 만드는 최대 블록 수 (백엔드의 batch 상한) */
+#define AES256_CTR_BATCH 64
+
+/**
+ * @brief 백엔드가 encrypt_blocks 한 번에 처리하기 좋은 블록 수
+ */
+static size_t ctr_batch(const aes256_ops_t* ops) {
+    size_t batch = (ops->batch != 0) ? ops->batch : (size_t)AES256_CFG_LOAD(aes256_interleave);
+    return (batch > AES256_CTR_BATCH) ? AES256_CTR_BATCH : batch;
+}
+
+static inline uint64_t load_be64(const uint8_t* p) {
+    return ((uint64_t)load_be32(p) << 32) | load_be32(p + 4);
+}
+
+static inline void store_be64(uint8_t* p, uint64_t v) {
+    store_be32(p, (uint32_t)(v >> 32));
+    store_be32(p + 4, (uint32_t)v);
+}
+
+/**
+ * @brief n바이트를 XOR함 (8바이트 단위로 처리)
+ */
+static void xor_bytes(uint8_t* dst, const uint8_t* src, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t a, b;
+        memcpy(&a, dst + i, 8);
+        memcpy(&b, src + i, 8);
+        a ^= b;
+        memcpy(dst + i, &a, 8);
+    }
+    for (; i < n; i++) dst[i] ^= src[i];
+}
+
+/**
+ * @brief 128비트 빅엔디언 카운터 블록들을 만들어 한꺼번에 암호화함 (키스트림 생성)
+ * @param hi,lo [In/Out] 카운터의 상위/하위 64비트, 종료 시 n만큼 증가함
+ */
+static void ctr_keystream(const aes256_ops_t* ops, uint8_t* ks, size_t n, const uint8_t* RoundKey,
+                          uint64_t* hi, uint64_t* lo) {
+    for (size_t j = 0; j < n; j++) {
+        store_be64(ks + j * 16, *hi);
+        store_be64(ks + j * 16 + 8, *lo);
+        if (++(*lo) == 0) (*hi)++;
+    }
+
+    if (n > 1 && ops->encrypt_blocks != NULL) {
+        ops->encrypt_blocks(ks, n, RoundKey);
+    } else {
+        for (size_t j = 0; j < n; j++) ops->encrypt_block(ks + j * 16, RoundKey);
+    }
+}
+
+/**
+ * @brief 데이터를 CTR 모드로 암호화/복호화함 (두 연산은 동일함)
+ * @details 패딩이 필요 없으며 임의 길이를 처리함. offset은 전체 스트림에서 buf[0]의
+ *          바이트 위치로, 카운터 블록 = iv + offset/16 (128비트 덧셈)이 됨.
+ *          따라서 큰 파일의 임의 구간만 복호화하거나 여러 스레드가 구간을 나누어 처리할 수 있음.
+ * @param iv 16바이트 초기 카운터 블록 (같은 키로 절대 재사용 금지)
+ * @param offset 스트림 시작 기준 바이트 오프셋 (처음부터 처리하면 0)
+ * @return 성공 시 0, 실패 시 -1
+ */
+int AES256_CTR_Crypt(uint8_t* buf, size_t len, const uint8_t* RoundKey, const uint8_t* iv, uint64_t offset) {
+    if ((buf == NULL && len > 0) || RoundKey == NULL || iv == NULL) return -1;
+    if (len == 0) return 0;
+
+    const aes256_ops_t* ops = AES256_CFG_LOAD(aes256_cur);
+    size_t batch = ctr_batch(ops);
+    uint8_t ks[AES256_CTR_BATCH * 16];
+    size_t pos = 0;
+
+    /* 시작 카운터 = iv + offset/16 */
+    uint64_t hi = load_be64(iv);
+    uint64_t lo = load_be64(iv + 8);
+    uint64_t add = offset / 16;
+    lo += add;
+    if (lo < add) hi++;
+
+    /* 1. 블록 중간에서 시작하면 첫 키스트림 블록의 앞부분을 건너뜀 */
+    size_t skip = (size_t)(offset % 16);
+    if (skip != 0) {
+        size_t n = 16 - skip;
+        if (n > len) n = len;
+        ctr_keystream(ops, ks, 1, RoundKey, &hi, &lo);
+        xor_bytes(buf, ks + skip, n);
+        pos = n;
+    }
+
+    /* 2. batch개 블록씩 키스트림을 만들어 처리 (16바이트 미만의 꼬리는 마지막 묶음에 포함) */
+    while (pos < len) {
+        size_t remain = len - pos;
+        size_t n = (remain + 15) / 16;
+        if (n > batch) n = batch;
+        size_t nbytes = (remain < n * 16) ? remain : n * 16;
+        ctr_keystream(ops, ks, n, RoundKey, &hi, &lo);
+        xor_bytes(buf + pos, ks, nbytes);
+        pos += nbytes;
+    }
+
+    secure_memzero(ks, batch * 16);
+    return 0;
+}
+
+/* ---------------- CMAC (SP 800-38B)과 CTR + CMAC 결합 모드 ---------------- */
+
+/*
+ * - CMAC: CBC-MAC에 서브키 K1/K2(L = E_K(0)을 GF(2^128)에서 2배, 4배)를 더해 임의 길이를 처리
+ * - CTR + CMAC(Encrypt-then-MAC): 태그 = CMAC_Kmac(iv || 암호문)
+ *   암호화와 MAC을 한 번의 패스로 처리하여 데이터를 한 번만 읽고 씀 (2패스 대비 메모리 트래픽 절반).
+ *   AES-NI는 블록마다 한 라운드 루프에서, 그 외 백엔드는 CTR 묶음 단위로 L1 캐시 안에서 결합함
+ * - 두 키는 서로 달라야 함 (같은 키를 쓰면 카운터 블록과 CBC-MAC 입력이 겹칠 수 있음)
+ */
+
+/**
+ * @brief GF(2^128)에서 2를 곱함 (128비트 빅엔디언 왼쪽 1비트 시프트, 넘치면 0x87로 환원)
+ */
+static void cmac_dbl(uint8_t* out, const uint8_t* in) {
+    uint8_t carry = (uint8_t)(in[0] >> 7);
+    for (int i = 0; i < 15; i++) out[i] = (uint8_t)((in[i] << 1) | (in[i + 1] >> 7));
+    out[15] = (uint8_t)((in[15] << 1) ^ (0x87 & -carry));
+}
+
+/**
+ * @brief 마지막이 아닌 블록 n개를 CBC-MAC 체인에 흡수함
+ * @details 백엔드의 CBC 암호화 경로를 그대로 쓰기 위해 AES256_CTR_BATCH 블록씩 임시 버퍼에
+ *          복사한 뒤 암호화함 (암호문은 버리고 체이닝 값만 남김)
+ * @param mac [In/Out] CBC-MAC 체이닝 값
+ */
+static void cmac_absorb(const aes256_ops_t* ops, uint8_t* mac, const uint8_t* data, size_t nblocks,
+                        const uint8_t* RoundKey) {
+    uint8_t tmp[AES256_CTR_BATCH * 16];
+    size_t used = 0;
+
+    for (size_t i = 0; i < nblocks; i += AES256_CTR_BATCH) {
+        size_t n = (nblocks - i < AES256_CTR_BATCH) ? (nblocks - i) : AES256_CTR_BATCH;
+        memcpy(tmp, data + i * 16, n * 16);
+        cbc_encrypt_blocks(ops, tmp, n, RoundKey, mac);
+        if (n > used) used = n;
+    }
+    secure_memzero(tmp, used * 16);
+}
+
+/**
+ * @brief 마지막 블록(0~16바이트)에 서브키를 적용하여 태그를 만듦
+ * @details 완전한 블록이면 K1을 XOR하고, 아니면 10* 패딩 후 K2를 XOR함
+ */
+static void cmac_final(const aes256_ops_t* ops, const uint8_t* mac, const uint8_t* last, size_t n,
+                       const uint8_t* RoundKey, uint8_t* tag) {
+    uint8_t sub[16] = { 0 }, blk[16] = { 0 };
+
+    ops->encrypt_block(sub, RoundKey); /* L = E_K(0) */
+    cmac_dbl(sub, sub);                /* K1 */
+    if (n < 16) cmac_dbl(sub, sub);    /* K2 */
+
+    memcpy(blk, last, n);
+    if (n < 16) blk[n] = 0x80;
+    xor_block(blk, sub);
+    xor_block(blk, mac);
+    ops->encrypt_block(blk, RoundKey);
+    memcpy(tag, blk, 16);
+
+    secure_memzero(sub, sizeof(sub));
+    secure_memzero(blk, sizeof(blk));
+}
+
+/**
+ * @brief 메시지의 AES-256-CMAC 태그를 계산함 (SP 800-38B)
+ * @param msg 메시지 (len이 0이면 NULL 허용)
+ * @param mac [Out] 16바이트 태그
+ * @return 성공 시 0, 실패 시 -1
+ */
+int AES256_CMAC(const uint8_t* msg, size_t len, const uint8_t* RoundKey, uint8_t* mac) {
+    if ((msg == NULL && len > 0) || RoundKey == NULL || mac == NULL) return -1;
+
+    const aes256_ops_t* ops = AES256_CFG_LOAD(aes256_cur);
+    uint8_t x[16] = { 0 };
+
+    /* 마지막 블록(1~16바이트, 빈 메시지면 0바이트)만 남기고 흡수 */
+    size_t tail = (len == 0) ? 0 : (len - 1) % 16 + 1;
+    cmac_absorb(ops, x, msg, (len - tail) / 16, RoundKey);
+    cmac_final(ops, x, (tail > 0) ? msg + (len - tail) : x, tail, RoundKey, mac);
+
+    secure_memzero(x, sizeof(x));
+    return 0;
+}
+
+/**
+ * @brief 완전한 블록 n개를 CTR로 처리하면서 암호문을 CMAC 체인에 흡수함
+ * @details 암호화는 키스트림 XOR 후, 복호화는 XOR 전에 암호문을 흡수함
+ */
+static void ctr_cmac_blocks(const aes256_ops_t* ops, uint8_t* buf, size_t nblocks, const uint8_t* ctr_key,
+                            const uint8_t* mac_key, uint64_t* hi, uint64_t* lo, uint8_t* mac, int encrypt) {
+    if (ops->ctr_cmac != NULL) {
+        ops->ctr_cmac(buf, nblocks, ctr_key, mac_key, hi, lo, mac, encrypt);
+        return;
+    }
+
+    size_t batch = ctr_batch(ops);
+    uint8_t ks[AES256_CTR_BATCH * 16];
+
+    for (size_t i = 0; i < nblocks; i += batch) {
+        size_t n = (nblocks - i < batch) ? (nblocks - i) : batch;
+        uint8_t* b = buf + i * 16;
+        if (!encrypt) cmac_absorb(ops, mac, b, n, mac_key);
+        ctr_keystream(ops, ks, n, ctr_key, hi, lo);
+        xor_bytes(b, ks, n * 16);
+        if (encrypt) cmac_absorb(ops, mac, b, n, mac_key);
+    }
+    secure_memzero(ks, sizeof(ks));
+}
+
+/**
+ * @brief CTR 암복호화와 태그 = CMAC_Kmac(iv || 암호문) 계산을 한 패스로 처리함
+ */
+static void ctr_cmac_crypt(uint8_t* buf, size_t len, const uint8_t* EncRoundKey, const uint8_t* MacRoundKey,
+                           const uint8_t* iv, uint8_t* tag, int encrypt) {
+    const aes256_ops_t* ops = AES256_CFG_LOAD(aes256_cur);
+    uint8_t x[16] = { 0 }, ks[16];
+
+    /* 빈 메시지면 iv가 CMAC의 마지막(완전한) 블록 */
+    if (len == 0) {
+        cmac_final(ops, x, iv, 16, MacRoundKey, tag);
+        return;
+    }
+
+    uint64_t hi = load_be64(iv);
+    uint64_t lo = load_be64(iv + 8);
+    memcpy(x, iv, 16);
+    ops->encrypt_block(x, MacRoundKey);
+
+    /* 1. 마지막 블록을 뺀 완전한 블록들 (CMAC 서브키가 필요 없는 구간) */
+    size_t tail = (len - 1) % 16 + 1;
+    size_t nfull = (len - tail) / 16;
+    ctr_cmac_blocks(ops, buf, nfull, EncRoundKey, MacRoundKey, &hi, &lo, x, encrypt);
+
+    /* 2. 마지막 블록 (1~16바이트): 암호문 기준으로 서브키를 적용 */
+    uint8_t* last = buf + nfull * 16;
+    ctr_keystream(ops, ks, 1, EncRoundKey, &hi, &lo);
+    if (encrypt) xor_bytes(last, ks, tail);
+    cmac_final(ops, x, last, tail, MacRoundKey, tag);
+    if (!encrypt) xor_bytes(last, ks, tail);
+
+    secure_memzero(x, sizeof(x));
+    secure_memzero(ks, sizeof(ks));
+}
+
+static int ctr_cmac_check(const uint8_t* buf, size_t len, const uint8_t* EncRoundKey,
+                          const uint8_t* MacRoundKey, const uint8_t* iv, const uint8_t* tag) {
+    if ((buf == NULL && len > 0) || EncRoundKey == NULL || MacRoundKey == NULL || iv == NULL || tag == NULL) {
+        return -1;
+    }
+    return (memcmp(EncRoundKey, MacRoundKey, 32) == 0) ? -1 : 0;
+}
+
+/**
+ * @brief CTR로 암호화하면서 암호문의 CMAC 태그를 계산함 (Encrypt-then-MAC, 제자리 처리)
+ * @details 암호화 후 AES256_CMAC을 따로 돌리는 2패스 방식과 결과가 같음:
+ *          buf = AES256_CTR_Crypt(buf, EncRoundKey, iv, 0), tag = AES256_CMAC(iv || buf, MacRoundKey)
+ * @param EncRoundKey 암호화 키의 라운드 키, MacRoundKey MAC 키의 라운드 키 (서로 다른 키)
+ * @param iv  16바이트 초기 카운터 블록 (같은 키로 절대 재사용 금지)
+ * @param tag [Out] 16바이트 인증 태그
+ * @return 성공 시 0, 실패 시 -1
+ */
+int AES256_CTR_CMAC_Encrypt(uint8_t* buf, size_t len, const uint8_t* EncRoundKey, const uint8_t* MacRoundKey,
+                            const uint8_t* iv, uint8_t* tag) {
+    if (ctr_cmac_check(buf, len, EncRoundKey, MacRoundKey, iv, tag) != 0) return -1;
+
+    ctr_cmac_crypt(buf, len, EncRoundKey, MacRoundKey, iv, tag, 1);
+    return 0;
+}
+
+/**
+ * @brief 암호문의 CMAC 태그를 검증하면서 CTR로 복호화함 (제자리 처리)
+ * @details 태그가 일치하지 않으면 복호화된 내용을 0으로 지우고 -3을 반환함
+ * @param tag 수신한 16바이트 인증 태그
+ * @return 성공 시 0, 인증 실패 시 -3, 그 외 실패 시 -1
+ */
+int AES256_CTR_CMAC_Decrypt(uint8_t* buf, size_t len, const uint8_t* EncRoundKey, const uint8_t* MacRoundKey,
+                            const uint8_t* iv, const uint8_t* tag) {
+    if (ctr_cmac_check(buf, len, EncRoundKey, MacRoundKey, iv, tag) != 0) return -1;
+
+    uint8_t calc[16];
+    ctr_cmac_crypt(buf, len, EncRoundKey, MacRoundKey, iv, calc, 0);
+
+    /* 타이밍 차이가 나지 않도록 모든 바이트를 비교 */
+    uint8_t diff = 0;
+    for (int i = 0; i < 16; i++) diff |= (uint8_t)(calc[i] ^ tag[i]);
+    secure_memzero(calc, sizeof(calc));
+
+    if (diff != 0) {
+        secure_memzero(buf, len);
+        return -3;
+    }
+    return 0;
+}
+
+/* ---------------- CTR-DRBG (SP 800-90A, AES-256, 유도 함수 없음) ---------------- */
+
+/*
+ * IV/nonce를 대량으로 만들 때 메시지마다 getrandom을 부르지 않도록 하는 결정론적 난수 생성기
+ * - 상태: Key(라운드 키로 보관), V(128비트 카운터), 재시드 카운터
+ * - Update: V+1, V+2, V+3을 암호화한 48바이트에 입력을 XOR하여 새 Key || V로 씀
+ * - Generate: V+1부터 카운터 블록을 암호화해 출력한 뒤 Update로 Key/V를 바꿈 (되돌림 방지)
+ * - 스레드별 생성기(AES256_RandomBytes)는 처음 쓸 때와 AES256_DRBG_RESEED_INTERVAL회 요청마다,
+ *   그리고 fork 후 자식 프로세스에서 처음 쓸 때 getrandom으로 다시 시드함
+ */
+
+/* Generate 한 번의 최대 출력 (SP 800-90A: 2^19비트), 더 긴 요청은 나누어 처리 */
+#define AES256_DRBG_MAX_REQUEST (64 * 1024)
+
+/**
+ * @brief CTR_DRBG_Update: provided(48바이트, NULL이면 0)로 Key와 V를 갱신함
+ */
+static void drbg_update(const aes256_ops_t* ops, AES256_DRBG* drbg, const uint8_t* provided) {
+    uint8_t temp[AES256_DRBG_SEED_LEN];
+    uint64_t hi = load_be64(drbg->V), lo = load_be64(drbg->V + 8);
+
+    if (++lo == 0) hi++;
+    ctr_keystream(ops, temp, 3, drbg->RoundKey, &hi, &lo);
+    if (provided != NULL) xor_bytes(temp, provided, AES256_DRBG_SEED_LEN);
+
+    ops->key_expansion(drbg->RoundKey, temp);
+    memcpy(drbg->V, temp + 32, 16);
+    secure_memzero(temp, sizeof(temp));
+}
+
+/**
+ * @brief 길이가 48바이트 이하인 입력을 48바이트로 0 채움 (유도 함수를 쓰지 않으므로)
+ * @return 입력이 있으면 buf, 없으면 NULL
+ */
+static const uint8_t* drbg_pad_input(uint8_t* buf, const uint8_t* in, size_t len) {
+    if (in == NULL || len == 0) return NULL;
+    memset(buf, 0, AES256_DRBG_SEED_LEN);
+    memcpy(buf, in, len);
+    return buf;
+}
+
+/**
+ * @brief 엔트로피 48바이트와 개인화 문자열(최대 48바이트)로 생성기를 초기화함
+ * @return 성공 시 0, 인자 오류 -1, 개인화 문자열이 너무 길면 -2
+ */
+int AES256_DRBG_Instantiate(AES256_DRBG* drbg, const uint8_t* entropy, const uint8_t* pers, size_t pers_len) {
+    if (drbg == NULL || entropy == NULL || (pers == NULL && pers_len > 0)) return -1;
+    if (pers_len > AES256_DRBG_SEED_LEN) return -2;
+
+    const aes256_ops_t* ops = AES256_CFG_LOAD(aes256_cur);
+    uint8_t seed[AES256_DRBG_SEED_LEN], zero[32] = { 0 };
+
+    memcpy(seed, entropy, AES256_DRBG_SEED_LEN);
+    for (size_t i = 0; i < pers_len; i++) seed[i] ^= pers[i];
+
+    ops->key_expansion(drbg->RoundKey, zero);
+    memset(drbg->V, 0, 16);
+    drbg_update(ops, drbg, seed);
+    drbg->reseed_counter = 1;
+    secure_memzero(seed, sizeof(seed));
+    return 0;
+}
+
+/**
+ * @brief 새 엔트로피 48바이트와 추가 입력(최대 48바이트)으로 다시 시드함
+ * @return 성공 시 0, 인자 오류 -1, 추가 입력이 너무 길면 -2
+ */
+int AES256_DRBG_Reseed(AES256_DRBG* drbg, const uint8_t* entropy, const uint8_t* add, size_t add_len) {
+    if (drbg == NULL || entropy == NULL || (add == NULL && add_len > 0)) return -1;
+    if (add_len > AES256_DRBG_SEED_LEN) return -2;
+
+    uint8_t seed[AES256_DRBG_SEED_LEN];
+    memcpy(seed, entropy, AES256_DRBG_SEED_LEN);
+    for (size_t i = 0; i < add_len; i++) seed[i] ^= add[i];
+
+    drbg_update(AES256_CFG_LOAD(aes256_cur), drbg, seed);
+    drbg->reseed_counter = 1;
+    secure_memzero(seed, sizeof(seed));
+    return 0;
+}
+
+/**
+ * @brief 난수 len바이트를 만듦 (요청 한 번 = Generate 한 번)
+ * @details 카운터 블록을 한꺼번에 out에 써 넣고 encrypt_blocks로 암호화하므로
+ *          긴 요청은 CTR 키스트림과 같은 속도로 처리됨
+ * @return 성공 시 0, 인자 오류 -1, 길이/추가 입력 초과 -2,
+ *         재시드 주기 초과 -3 (AES256_DRBG_Reseed 후 다시 호출)
+ */
+int AES256_DRBG_Generate(AES256_DRBG* drbg, uint8_t* out, size_t len, const uint8_t* add, size_t add_len) {
+    if (drbg == NULL || (out == NULL && len > 0) || (add == NULL && add_len > 0)) return -1;
+    if (len > AES256_DRBG_MAX_REQUEST || add_len > AES256_DRBG_SEED_LEN) return -2;
+    if (drbg->reseed_counter == 0 || drbg->reseed_counter > AES256_DRBG_RESEED_INTERVAL) return -3;
+
+    const aes256_ops_t* ops = AES256_CFG_LOAD(aes256_cur);
+    uint8_t pad[AES256_DRBG_SEED_LEN], last[16];
+    const uint8_t* extra = drbg_pad_input(pad, add, add_len);
+    if (extra != NULL) drbg_update(ops, drbg, extra);
+
+    uint64_t hi = load_be64(drbg->V), lo = load_be64(drbg->V + 8);
+    if (++lo == 0) hi++;
+
+    size_t nfull = len / 16, tail = len % 16;
+    if (nfull > 0) ctr_keystream(ops, out, nfull, drbg->RoundKey, &hi, &lo);
+    if (tail > 0) {
+        ctr_keystream(ops, last, 1, drbg->RoundKey, &hi, &lo);
+        memcpy(out + nfull * 16, last, tail);
+        secure_memzero(last, sizeof(last));
+    }
+
+    /* 마지막으로 쓴 카운터가 새 V */
+    if (lo-- == 0) hi--;
+    store_be64(drbg->V, hi);
+    store_be64(drbg->V + 8, lo);
+
+    drbg_update(ops, drbg, extra);
+    drbg->reseed_counter++;
+    if (extra != NULL) secure_memzero(pad, sizeof(pad));
+    return 0;
+}
+
+void AES256_DRBG_Clear(AES256_DRBG* drbg) {
+    if (drbg != NULL) secure_memzero(drbg, sizeof(*drbg));
+}
+
+/* 스레드별 생성기: fork마다 증가하는 세대 번호로 자식 프로세스에서의 상태 재사용을 막음 */
+static pthread_once_t drbg_once = PTHREAD_ONCE_INIT;
+static pthread_key_t drbg_tls_key;
+static volatile uint64_t drbg_fork_gen = 1;
+
+typedef struct {
+    AES256_DRBG drbg;
+    uint64_t fork_gen;      /* 시드할 때의 drbg_fork_gen (0이면 아직 시드하지 않음) */
+} drbg_thread_t;
+
+static __thread drbg_thread_t drbg_tls;
+
+/* fork 직후 자식에서 호출됨 (자식에는 fork를 부른 스레드 하나만 있음) */
+static void drbg_atfork_child(void) {
+    drbg_fork_gen++;
+}
+
+/* 스레드가 끝날 때 상태를 지움 */
+static void drbg_thread_exit(void* p) {
+    secure_memzero(p, sizeof(drbg_thread_t));
+}
+
+static void drbg_init_once(void) {
+    pthread_atfork(NULL, NULL, drbg_atfork_child);
+    pthread_key_create(&drbg_tls_key, drbg_thread_exit);
+}
+
+/**
+ * @brief OS 난수(getrandom)로 n바이트를 채움 (시그널로 끊기면 이어서 읽음)
+ * @return 성공 시 0, 실패 시 -4
+ */
+static int drbg_os_entropy(uint8_t* buf, size_t n) {
+    size_t got = 0;
+    while (got < n) {
+        ssize_t r = getrandom(buf + got, n - got, 0);
+        if (r < 0) {
+            if (errno == EINTR) continue;
+            return -4;
+        }
+        got += (size_t)r;
+    }
+    return 0;
+}
+
+/**
+ * @brief 현재 스레드의 생성기를 OS 엔트로피로 (다시) 시드함
+ * @details 개인화/추가 입력으로 상태 주소와 시각을 섞어, OS 난수가 같더라도 스레드끼리 겹치지 않게 함
+ * @return 성공 시 0, 엔트로피를 얻지 못하면 -4
+ */
+static int drbg_thread_seed(drbg_thread_t* t) {
+    uint8_t entropy[AES256_DRBG_SEED_LEN];
+    struct timespec ts;
+    uint64_t extra[3];
+
+    if (drbg_os_entropy(entropy, sizeof(entropy)) != 0) return -4;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    extra[0] = (uint64_t)(uintptr_t)t;
+    extra[1] = (uint64_t)ts.tv_sec;
+    extra[2] = (uint64_t)ts.tv_nsec;
+
+    uint64_t gen = drbg_fork_gen;
+    if (t->fork_gen == 0) {
+        AES256_DRBG_Instantiate(&t->drbg, entropy, (const uint8_t*)extra, sizeof(extra));
+        pthread_setspecific(drbg_tls_key, t);
+    } else {
+        AES256_DRBG_Reseed(&t->drbg, entropy, (const uint8_t*)extra, sizeof(extra));
+    }
+    t->fork_gen = gen;
+    secure_memzero(entropy, sizeof(entropy));
+    return 0;
+}
+
+/**
+ * @brief 현재 스레드의 생성기로 임의 길이의 난수를 만듦 (시스템 호출 없음, 재시드 시 제외)
+ * @details 64KB 단위로 나누어 Generate를 호출하며, 처음 사용/재시드 주기 초과/fork 후에는
+ *          먼저 getrandom으로 다시 시드함
+ * @return 성공 시 0, 인자 오류 -1, OS 엔트로피를 얻지 못하면 -4
+ */
+int AES256_RandomBytes(uint8_t* out, size_t len) {
+    if (out == NULL && len > 0) return -1;
+    if (len == 0) return 0;
+    pthread_once(&drbg_once, drbg_init_once);
+
+    drbg_thread_t* t = &drbg_tls;
+    size_t pos = 0;
+    do {
+        if (t->fork_gen != drbg_fork_gen || t->drbg.reseed_counter > AES256_DRBG_RESEED_INTERVAL) {
+            if (drbg_thread_seed(t) != 0) return -4;
+        }
+        size_t n = (len - pos > AES256_DRBG_MAX_REQUEST) ? AES256_DRBG_MAX_REQUEST : len - pos;
+        AES256_DRBG_Generate(&t->drbg, out + pos, n, NULL, 0);
+        pos += n;
+    } while (pos < len);
+    return 0;
+}
+
+/**
+ * @brief 16바이트 IV count개를 한 번에 만듦 (ivs에는 count * 16바이트 공간 필요)
+ * @return 성공 시 0, 인자 오류 -1, OS 엔트로피를 얻지 못하면 -4
+ */
+int AES256_RandomIVs(uint8_t* ivs, size_t count) {
+    if (count > SIZE_MAX / 16) return -1;
+    return AES256_RandomBytes(ivs, count * 16);
+}
+
+/**
+ * @brief 현재 스레드의 생성기를 즉시 OS 엔트로피로 다시 시드함
+ * @return 성공 시 0, OS 엔트로피를 얻지 못하면 -4
+ */
+int AES256_RandomReseed(void) {
+    pthread_once(&drbg_once, drbg_init_once);
+    return drbg_thread_seed(&drbg_tls);
+}
+
+/* ---------------- XTS 운영 모드 (IEEE 1619 / SP 800-38E) ---------------- */
+
+/*
+ * 디스크/저장 파일용 XTS-AES-256
+ * - 키 두 개: Key1(데이터), Key2(tweak). 각각 KeyExpansion으로 확장하여 넘김
+ * - 데이터 단위(섹터)마다 T = E_K2(tweak), 블록 j는 C = E_K1(P ^ T_j) ^ T_j, T_{j+1} = T_j * α
+ * - 블록끼리 체이닝이 없어 섹터 안에서도 교차 처리가 되고, 섹터 단위로 다시 쓸 수 있음
+ * - 16의 배수가 아닌 꼬리는 암호문 훔치기(ciphertext stealing)로 처리하여 길이가 늘지 않음
+ */
+
+/* 데이터 단위 하나의 최대 크기 (IEEE 1619: 2^20 블록) */
+#define AES256_XTS_MAX_UNIT ((size_t)1 << 24)
+
+static inline uint64_t xts_load_le64(const uint8_t* p) {
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; i--) v = (v << 8) | p[i];
+    return v;
+}
+
+static inline void xts_store_le64(uint8_t* p, uint64_t v) {
+    for (int i = 0; i < 8; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+/**
+ * @brief tweak(128비트 리틀엔디언)에 α를 곱함: 왼쪽 1비트 시프트, 넘치면 0x87로 환원
+ */
+static inline void xts_mul_alpha(uint64_t* lo, uint64_t* hi) {
+    uint64_t carry = *hi >> 63;
+    *hi = (*hi << 1) | (*lo >> 63);
+    *lo = (*lo << 1) ^ (0x87 & (0 - carry));
+}
+
+/**
+ * @brief 전체 블록 nblocks개를 XTS로 처리함
+ * @details 백엔드 전용 함수가 없으면 batch개 블록의 tweak을 먼저 만들어 XOR한 뒤
+ *          encrypt_blocks/decrypt_blocks로 한꺼번에 처리하고 다시 XOR함
+ * @param key 암호화 시 Key1의 라운드 키, 복호화 시 Key1의 복호화 라운드 키
+ * @param tweak [In/Out] 첫 블록의 tweak, 종료 시 다음 블록의 tweak으로 갱신됨
+ */
+static void xts_blocks(const aes256_ops_t* ops, uint8_t* buf, size_t nblocks, const uint8_t* key,
+                       uint8_t* tweak, int encrypt) {
+    if (ops->xts_crypt != NULL) {
+        ops->xts_crypt(buf, nblocks, key, tweak, encrypt);
+        return;
+    }
+
+    size_t batch = ctr_batch(ops);
+    uint8_t tw[AES256_CTR_BATCH * 16];
+    uint64_t lo = xts_load_le64(tweak), hi = xts_load_le64(tweak + 8);
+
+    for (size_t i = 0; i < nblocks; i += batch) {
+        size_t n = (nblocks - i < batch) ? nblocks - i : batch;
+        uint8_t* b = buf + i * 16;
+
+        for (size_t j = 0; j < n; j++) {
+            xts_store_le64(tw + j * 16, lo);
+            xts_store_le64(tw + j * 16 + 8, hi);
+            xts_mul_alpha(&lo, &hi);
+        }
+        xor_bytes(b, tw, n * 16);
+        if (encrypt) {
+            if (n > 1 && ops->encrypt_blocks != NULL) ops->encrypt_blocks(b, n, key);
+            else for (size_t j = 0; j < n; j++) ops->encrypt_block(b + j * 16, key);
+        } else {
+            if (n > 1 && ops->decrypt_blocks != NULL) ops->decrypt_blocks(b, n, key);
+            else for (size_t j = 0; j < n; j++) ops->decrypt_block(b + j * 16, key);
+        }
+        xor_bytes(b, tw, n * 16);
+    }
+
+    xts_store_le64(tweak, lo);
+    xts_store_le64(tweak + 8, hi);
+    secure_memzero(tw, sizeof(tw));
+}
+
+/**
+ * @brief 데이터 단위 하나를 XTS로 처리함 (인자 검사는 호출자가 함, len >= 16)
+ * @details 꼬리가 r바이트(0 < r < 16)이면 마지막 전체 블록까지 처리한 결과의 앞 r바이트를
+ *          꼬리 암호문으로 내보내고, 꼬리 평문 + 나머지 16-r바이트를 다음 tweak으로 다시 암호화함.
+ *          복호화는 두 tweak의 사용 순서를 바꾸어 같은 과정을 거꾸로 수행함.
+ * @param key Key1의 라운드 키(암호화) 또는 복호화 라운드 키(복호화)
+ * @param RoundKey2 Key2의 라운드 키 (tweak 암호화는 방향과 관계없이 항상 암호화)
+ */
+static void xts_crypt_unit(const aes256_ops_t* ops, uint8_t* buf, size_t len, const uint8_t* key,
+                           const uint8_t* RoundKey2, const uint8_t* tweak, int encrypt) {
+    uint8_t t[16], t_next[16], tmp[16];
+    size_t nfull = len / 16, r = len % 16;
+
+    memcpy(t, tweak, 16);
+    ops->encrypt_block(t, RoundKey2);
+
+    if (r == 0) {
+        xts_blocks(ops, buf, nfull, key, t, encrypt);
+        secure_memzero(t, sizeof(t));
+        return;
+    }
+
+    xts_blocks(ops, buf, nfull - 1, key, t, encrypt);
+    uint8_t* last = buf + (nfull - 1) * 16;
+    uint8_t* tail = last + 16;
+
+    if (encrypt) {
+        /* CC = 마지막 전체 블록 암호문 → 꼬리 암호문은 CC의 앞 r바이트, CC 자리에는 (꼬리 평문 || CC 나머지)의 암호문 */
+        xts_blocks(ops, last, 1, key, t, 1);
+        memcpy(tmp, last, 16);
+        memcpy(last, tail, r);
+        memcpy(tail, tmp, r);
+        xts_blocks(ops, last, 1, key, t, 1);
+    } else {
+        /* 암호화와 반대로 다음 tweak(T_m)으로 먼저 풀고, 원래 tweak(T_m-1)으로 나중에 품 */
+        uint64_t lo = xts_load_le64(t), hi = xts_load_le64(t + 8);
+        xts_mul_alpha(&lo, &hi);
+        xts_store_le64(t_next, lo);
+        xts_store_le64(t_next + 8, hi);
+
+        xts_blocks(ops, last, 1, key, t_next, 0);
+        memcpy(tmp, last, 16);
+        memcpy(last, tail, r);
+        memcpy(tail, tmp, r);
+        xts_blocks(ops, last, 1, key, t, 0);
+    }
+
+    secure_memzero(t, sizeof(t));
+    secure_memzero(t_next, sizeof(t_next));
+    secure_memzero(tmp, sizeof(tmp));
+}
+
+/**
+ * @brief XTS 인자 공통 검사 (두 키가 같으면 SP 800-38E에 따라 거부)
+ * @details AES-256 라운드 키의 앞 32바이트는 원래 키와 같음
+ * @return 정상이면 0, 인자 오류 -1
+ */
+static int xts_check_keys(const uint8_t* RoundKey1, const uint8_t* RoundKey2) {
+    if (RoundKey1 == NULL || RoundKey2 == NULL) return -1;
+    return (memcmp(RoundKey1, RoundKey2, 32) == 0) ? -1 : 0;
+}
+
+static int xts_unit(uint8_t* buf, size_t len, const uint8_t* RoundKey1, const uint8_t* RoundKey2,
+                    const uint8_t* tweak, int encrypt) {
+    if (buf == NULL || tweak == NULL || xts_check_keys(RoundKey1, RoundKey2) != 0) return -1;
+    if (len < 16 || len > AES256_XTS_MAX_UNIT) return -2;
+
+    const aes256_ops_t* ops = AES256_CFG_LOAD(aes256_cur);
+    if (encrypt) {
+        xts_crypt_unit(ops, buf, len, RoundKey1, RoundKey2, tweak, 1);
+        return 0;
+    }
+
+    uint8_t DecKey[AES256_ROUNDKEY_SIZE];
+    ops->inv_key_expansion(DecKey, RoundKey1);
+    xts_crypt_unit(ops, buf, len, DecKey, RoundKey2, tweak, 0);
+    secure_memzero(DecKey, sizeof(DecKey));
+    return 0;
+}
+
+/**
+ * @brief 데이터 단위 하나를 XTS로 암호화함 (제자리 처리, 길이 16 ~ 2^24바이트)
+ * @param tweak 16바이트 tweak (보통 섹터 번호의 리틀엔디언 표현)
+ * @return 성공 시 0, 인자 오류 -1 (두 키가 같은 경우 포함), 길이 오류 -2
+ */
+int AES256_XTS_Encrypt(uint8_t* buf, size_t len, const uint8_t* RoundKey1, const uint8_t* RoundKey2,
+                       const uint8_t* tweak) {
+    return xts_unit(buf, len, RoundKey1, RoundKey2, tweak, 1);
+}
+
+int AES256_XTS_Decrypt(uint8_t* buf, size_t len, const uint8_t* RoundKey1, const uint8_t* RoundKey2,
+                       const uint8_t* tweak) {
+    return xts_unit(buf, len, RoundKey1, RoundKey2, tweak, 0);
+}
+
+/* XTS 섹터 병렬 처리 작업 단위 */
+typedef struct {
+    const aes256_ops_t* ops;
+    uint8_t* buf;
+    size_t sector_size;
+    size_t nsectors;
+    uint64_t first_sector;
+    const uint8_t* key;
+    const uint8_t* RoundKey2;
+    int encrypt;
+} xts_task_t;
+
+static void* xts_sector_worker(void* arg) {
+    xts_task_t* task = (xts_task_t*)arg;
+    uint8_t tweak[16] = {0};
+
+    for (size_t s = 0; s < task->nsectors; s++) {
+        xts_store_le64(tweak, task->first_sector + s);
+        xts_crypt_unit(task->ops, task->buf + s * task->sector_size, task->sector_size, task->key,
+                       task->RoundKey2, tweak, task->encrypt);
+    }
+    return NULL;
+}
+
+/**
+ * @brief 연속된 섹터들을 스레드 여러 개로 나누어 처리함
+ * @details tweak = 섹터 번호(128비트 리틀엔디언). 스레드마다 연속된 섹터 구간을 맡고,
+ *          스레드 생성에 실패한 구간은 호출 스레드가 직접 처리함.
+ */
+static int xts_sectors(uint8_t* buf, size_t sector_size, size_t nsectors, const uint8_t* RoundKey1,
+                       const uint8_t* RoundKey2, uint64_t first_sector, int nthreads, int encrypt) {
+    if (buf == NULL || xts_check_keys(RoundKey1, RoundKey2) != 0) return -1;
+    if (sector_size < 16 || sector_size > AES256_XTS_MAX_UNIT || nsectors == 0) return -2;
+    if (nsectors > SIZE_MAX / sector_size) return -2;
+
+    const aes256_ops_t* ops = AES256_CFG_LOAD(aes256_cur);
+    uint8_t DecKey[AES256_ROUNDKEY_SIZE];
+    const uint8_t* key = RoundKey1;
+    if (!encrypt) {
+        /* 복호화 라운드 키는 호출당 한 번만 계산하여 모든 스레드가 공유함 */
+        ops->inv_key_expansion(DecKey, RoundKey1);
+        key = DecKey;
+    }
+
+    /* 0 이하이면 AES256_SetThreads 설정을 따르되, 스레드당 최소 크기를 채우지 못하면 줄임 */
+    if (nthreads <= 0) {
+        size_t max_threads = (sector_size * nsectors) / AES256_CFG_LOAD(aes256_split_bytes);
+        nthreads = AES256_CFG_LOAD(aes256_threads);
+        if ((size_t)nthreads > max_threads) nthreads = (max_threads > 0) ? (int)max_threads : 1;
+    }
+    if (nthreads > AES256_MAX_THREADS) nthreads = AES256_MAX_THREADS;
+    if ((size_t)nthreads > nsectors) nthreads = (int)nsectors;
+
+    xts_task_t tasks[AES256_MAX_THREADS];
+    pthread_t tids[AES256_MAX_THREADS];
+    int started[AES256_MAX_THREADS] = {0};
+    size_t per = nsectors / (size_t)nthreads;
+    size_t extra = nsectors % (size_t)nthreads;
+    size_t pos = 0;
+
+    for (int t = 0; t < nthreads; t++) {
+        tasks[t] = (xts_task_t){ .ops = ops, .buf = buf + pos * sector_size, .sector_size = sector_size,
+                                 .nsectors = per + ((size_t)t < extra ? 1 : 0), .first_sector = first_sector + pos,
+                                 .key = key, .RoundKey2 = RoundKey2, .encrypt = encrypt };
+        pos += tasks[t].nsectors;
+    }
+
+    for (int t = 1; t < nthreads; t++) {
+        started[t] = (pthread_create(&tids[t], NULL, xts_sector_worker, &tasks[t]) == 0);
+    }
+    xts_sector_worker(&tasks[0]);
+    for (int t = 1; t < nthreads; t++) {
+        if (started[t]) {
+            pthread_join(tids[t], NULL);
+        } else {
+            xts_sector_worker(&tasks[t]);
+        }
+    }
+
+    if (!encrypt) secure_memzero(DecKey, sizeof(DecKey));
+    return 0;
+}
+
+/**
+ * @brief 연속된 섹터 nsectors개를 XTS로 암호화함 (섹터 i의 tweak = first_sector + i)
+ * @param nthreads 사용할 스레드 수 (0 이하이면 AES256_SetThreads 설정과 데이터 크기로 결정)
+ * @return 성공 시 0, 인자 오류 -1, 크기 오류 -2
+ */
+int AES256_XTS_EncryptSectors(uint8_t* buf, size_t sector_size, size_t nsectors, const uint8_t* RoundKey1,
+                              const uint8_t* RoundKey2, uint64_t first_sector, int nthreads) {
+    return xts_sectors(buf, sector_size, nsectors, RoundKey1, RoundKey2, first_sector, nthreads, 1);
+}
+
+int AES256_XTS_DecryptSectors(uint8_t* buf, size_t sector_size, size_t nsectors, const uint8_t* RoundKey1,
+                              const uint8_t* RoundKey2, uint64_t first_sector, int nthreads) {
+    return xts_sectors(buf, sector_size, nsectors, RoundKey1, RoundKey2, first_sector, nthreads, 0);
+}
+
+/* ---------------- GCM 운영 모드 (Galois/Counter Mode) ---------------- */
+
+/*
+ * GHASH 상태
+ * - 이식 가능 구현: H의 4비트 곱셈표(Htable)로 니블 단위 곱셈 (Shoup 방식)
+ * - PCLMULQDQ 구현: H^1~H^4를 미리 구해 두고 4블록을 곱한 뒤 한 번만 모듈러 축약
+ */
+typedef struct {
+    uint64_t Htable[16][2]; /* Htable[i] = (4비트 값 i) x H, [0]: 상위 64비트 */
+    uint8_t Hpow[4][16];    /* H^1 ~ H^4 (PCLMULQDQ용, 바이트 역순 배치) */
+    uint8_t X[16];          /* GHASH 누적값 */
+    int clmul;
+} ghash_t;
+
+/* 니블을 오른쪽으로 밀어낼 때 x^128 + x^7 + x^2 + x + 1로 축약하는 값 */
+static const uint64_t ghash_rem_4bit[16] = {
+    (uint64_t)0x0000 << 48, (uint64_t)0x1C20 << 48, (uint64_t)0x3840 << 48, (uint64_t)0x2460 << 48,
+    (uint64_t)0x7080 << 48, (uint64_t)0x6CA0 << 48, (uint64_t)0x48C0 << 48, (uint64_t)0x54E0 << 48,
+    (uint64_t)0xE100 << 48, (uint64_t)0xFD20 << 48, (uint64_t)0xD940 << 48, (uint64_t)0xC560 << 48,
+    (uint64_t)0x9180 << 48, (uint64_t)0x8DA0 << 48, (uint64_t)0xA9C0 << 48, (uint64_t)0xB5E0 << 48
+};
+
+/**
+ * @brief 이식 가능 구현: H로부터 4비트 곱셈표를 만듦
+ */
+static void ghash_init_4bit(ghash_t* g, const uint8_t* H) {
+    uint64_t vh = load_be64(H), vl = load_be64(H + 8);
+
+    /* Htable[8] = H, [4] = H*x, [2] = H*x^2, [1] = H*x^3 (GCM 비트 순서 기준) */
+    for (int i = 8; i >= 1; i >>= 1) {
+        g->Htable[i][0] = vh;
+        g->Htable[i][1] = vl;
+        uint64_t t = (uint64_t)0xe100000000000000ULL & (0 - (vl & 1));
+        vl = (vh << 63) | (vl >> 1);
+        vh = (vh >> 1) ^ t;
+    }
+    g->Htable[0][0] = g->Htable[0][1] = 0;
+    for (int i = 2; i < 16; i <<= 1) {
+        for (int j = 1; j < i; j++) {
+            g->Htable[i + j][0] = g->Htable[i][0] ^ g->Htable[j][0];
+            g->Htable[i + j][1] = g->Htable[i][1] ^ g->Htable[j][1];
+        }
+    }
+}
+
+/**
+ * @brief 이식 가능 구현: X = X x H (니블 32개를 뒤에서부터 처리)
+ */
+static void ghash_mul_4bit(uint8_t* X, const uint64_t Htable[16][2]) {
+    size_t nlo = X[15] & 0xf, nhi = X[15] >> 4;
+    uint64_t zh = Htable[nlo][0], zl = Htable[nlo][1];
+    int cnt = 15;
+
+    for (;;) {
+        size_t rem = (size_t)(zl & 0xf);
+        zl = (zh << 60) | (zl >> 4);
+        zh = (zh >> 4) ^ ghash_rem_4bit[rem];
+        zh ^= Htable[nhi][0];
+        zl ^= Htable[nhi][1];
+
+        if (--cnt < 0) break;
+
+        nlo = X[cnt] & 0xf;
+        nhi = X[cnt] >> 4;
+
+        rem = (size_t)(zl & 0xf);
+        zl = (zh << 60) | (zl >> 4);
+        zh = (zh >> 4) ^ ghash_rem_4bit[rem];
+        zh ^= Htable[nlo][0];
+        zl ^= Htable[nlo][1];
+    }
+
+    store_be64(X, zh);
+    store_be64(X + 8, zl);
+}
+
+#ifdef AES256_HAVE_AESNI
+#include <tmmintrin.h>
+
+#define CLMUL_TARGET __attribute__((target("pclmul,ssse3,sse2")))
+
+/* GCM 블록을 PCLMULQDQ 연산 순서에 맞게 바이트 역순으로 바꾸는 마스크 */
+#define CLMUL_BSWAP_MASK _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)
+
+/**
+ * @brief 128 x 128 -> 256비트 캐리 없는 곱셈 (축약 전)
+ */
+static inline CLMUL_TARGET void clmul_mul256(__m128i a, __m128i b, __m128i* lo, __m128i* hi) {
+    __m128i t0 = _mm_clmulepi64_si128(a, b, 0x00);
+    __m128i t1 = _mm_clmulepi64_si128(a, b, 0x10);
+    __m128i t2 = _mm_clmulepi64_si128(a, b, 0x01);
+    __m128i t3 = _mm_clmulepi64_si128(a, b, 0x11);
+
+    t1 = _mm_xor_si128(t1, t2);
+    *lo = _mm_xor_si128(t0, _mm_slli_si128(t1, 8));
+    *hi = _mm_xor_si128(t3, _mm_srli_si128(t1, 8));
+}
+
+/**
+ * @brief 256비트 곱을 GCM 다항식으로 축약함
+ * @details GCM의 비트 반사(reflected) 표현 때문에 1비트 왼쪽 시프트 후 축약함
+ *          (Intel "Carry-Less Multiplication and Its Usage for Computing the GCM Mode")
+ */
+static inline CLMUL_TARGET __m128i clmul_reduce(__m128i lo, __m128i hi) {
+    __m128i t7, t8, t9;
+
+    /* 256비트 값을 1비트 왼쪽으로 시프트 */
+    t7 = _mm_srli_epi32(lo, 31);
+    t8 = _mm_srli_epi32(hi, 31);
+    lo = _mm_slli_epi32(lo, 1);
+    hi = _mm_slli_epi32(hi, 1);
+    t9 = _mm_srli_si128(t7, 12);
+    t8 = _mm_slli_si128(t8, 4);
+    t7 = _mm_slli_si128(t7, 4);
+    lo = _mm_or_si128(lo, t7);
+    hi = _mm_or_si128(hi, t8);
+    hi = _mm_or_si128(hi, t9);
+
+    /* 1단계 축약 */
+    t7 = _mm_slli_epi32(lo, 31);
+    t8 = _mm_slli_epi32(lo, 30);
+    t9 = _mm_slli_epi32(lo, 25);
+    t7 = _mm_xor_si128(t7, t8);
+    t7 = _mm_xor_si128(t7, t9);
+    t8 = _mm_srli_si128(t7, 4);
+    t7 = _mm_slli_si128(t7, 12);
+    lo = _mm_xor_si128(lo, t7);
+
+    /* 2단계 축약 */
+    __m128i t2 = _mm_srli_epi32(lo, 1);
+    __m128i t4 = _mm_srli_epi32(lo, 2);
+    __m128i t5 = _mm_srli_epi32(lo, 7);
+    t2 = _mm_xor_si128(t2, t4);
+    t2 = _mm_xor_si128(t2, t5);
+    t2 = _mm_xor_si128(t2, t8);
+    lo = _mm_xor_si128(lo, t2);
+    return _mm_xor_si128(hi, lo);
+}
+
+static inline CLMUL_TARGET __m128i clmul_gfmul(__m128i a, __m128i b) {
+    __m128i lo, hi;
+    clmul_mul256(a, b, &lo, &hi);
+    return clmul_reduce(lo, hi);
+}
+
+/**
+ * @brief PCLMULQDQ 구현: H^1 ~ H^4를 미리 계산함
+ */
+static CLMUL_TARGET void ghash_init_clmul(ghash_t* g, const uint8_t* H) {
+    const __m128i mask = CLMUL_BSWAP_MASK;
+    __m128i h1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)H), mask);
+    __m128i hn = h1;
+
+    _mm_storeu_si128((__m128i*)g->Hpow[0], h1);
+    for (int i = 1; i < 4; i++) {
+        hn = clmul_gfmul(hn, h1);
+        _mm_storeu_si128((__m128i*)g->Hpow[i], hn);
+    }
+}
+
+/**
+ * @brief PCLMULQDQ 구현: 블록 4개씩 곱한 뒤 한 번에 축약하며 GHASH를 누적함
+ * @details X' = (X ^ B1)H^4 ^ B2 H^3 ^ B3 H^2 ^ B4 H
+ */
+static CLMUL_TARGET void ghash_blocks_clmul(ghash_t* g, const uint8_t* data, size_t nblocks) {
+    const __m128i mask = CLMUL_BSWAP_MASK;
+    const __m128i h1 = _mm_loadu_si128((const __m128i*)g->Hpow[0]);
+    const __m128i h2 = _mm_loadu_si128((const __m128i*)g->Hpow[1]);
+    const __m128i h3 = _mm_loadu_si128((const __m128i*)g->Hpow[2]);
+    const __m128i h4 = _mm_loadu_si128((const __m128i*)g->Hpow[3]);
+    __m128i x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)g->X), mask);
+    size_t i = 0;
+
+    for (; i + 4 <= nblocks; i += 4) {
+        __m128i b0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + i * 16)), mask);
+        __m128i b1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + i * 16 + 16)), mask);
+        __m128i b2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + i * 16 + 32)), mask);
+        __m128i b3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + i * 16 + 48)), mask);
+        __m128i lo, hi, l, h;
+
+        clmul_mul256(_mm_xor_si128(x, b0), h4, &lo, &hi);
+        clmul_mul256(b1, h3, &l, &h);
+        lo = _mm_xor_si128(lo, l); hi = _mm_xor_si128(hi, h);
+        clmul_mul256(b2, h2, &l, &h);
+        lo = _mm_xor_si128(lo, l); hi = _mm_xor_si128(hi, h);
+        clmul_mul256(b3, h1, &l, &h);
+        lo = _mm_xor_si128(lo, l); hi = _mm_xor_si128(hi, h);
+        x = clmul_reduce(lo, hi);
+    }
+
+    for (; i < nblocks; i++) {
+        __m128i b = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + i * 16)), mask);
+        x = clmul_gfmul(_mm_xor_si128(x, b), h1);
+    }
+
+    _mm_storeu_si128((__m128i*)g->X, _mm_shuffle_epi8(x, mask));
+}
+#endif /* PCLMULQDQ */
+
+/**
+ * @brief GHASH 상태를 초기화함 (누적값 0)
+ * @param clmul 1이면 PCLMULQDQ 구현 사용
+ */
+static void ghash_init(ghash_t* g, const uint8_t* H, int clmul) {
+    memset(g->X, 0, sizeof(g->X));
+#ifdef AES256_HAVE_AESNI
+    g->clmul = clmul;
+    if (clmul) {
+        ghash_init_clmul(g, H);
+        return;
+    }
+#else
+    (void)clmul;
+    g->clmul = 0;
+#endif
+    ghash_init_4bit(g, H);
+}
+
+/**
+ * @brief 16바이트 블록 nblocks개를 GHASH에 누적함
+ */
+static void ghash_blocks(ghash_t* g, const uint8_t* data, size_t nblocks) {
+#ifdef AES256_HAVE_AESNI
+    if (g->clmul) {
+        ghash_blocks_clmul(g, data, nblocks);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < nblocks; i++) {
+        xor_block(g->X, data + i * 16);
+        ghash_mul_4bit(g->X, g->Htable);
+    }
+}
+
+/**
+ * @brief 임의 길이 데이터를 GHASH에 누적함 (마지막 블록은 0으로 채움)
+ */
+static void ghash_update(ghash_t* g, const uint8_t* data, size_t len) {
+    ghash_blocks(g, data, len / 16);
+    if (len % 16 != 0) {
+        uint8_t last[16] = {0};
+        memcpy(last, data + (len & ~(size_t)15), len % 16);
+        ghash_blocks(g, last, 1);
+    }
+}
+
+/* GCM 한 번에 처리할 수 있는 최대 평문 길이: 32비트 카운터 (2^32 - 2)블록 */
+#define AES256_GCM_MAX_LEN (((uint64_t)0xfffffffe) * 16)
+
+/**
+ * @brief GCM 암호화/복호화 공통 처리
+ * @details 카운터 블록 8개씩 키스트림을 만들어 XOR하고, 방금 만든(또는 읽은)
+ *          암호문 블록이 캐시에 남아 있을 때 바로 GHASH에 누적함 (버퍼 1회 순회).
+ * @param tag [Out] 계산된 16바이트 인증 태그
+ */
+static void gcm_crypt(uint8_t* buf, size_t len, const uint8_t* aad, size_t aad_len,
+                      const uint8_t* RoundKey, const uint8_t* iv, size_t iv_len,
+                      uint8_t* tag, int encrypt) {
+    const aes256_ops_t* ops = AES256_CFG_LOAD(aes256_cur);
+    size_t batch = ctr_batch(ops);
+    uint8_t H[16] = {0};
+    uint8_t J0[16];
+    uint8_t ks[AES256_CTR_BATCH * 16];
+    uint8_t lens[16];
+    ghash_t g;
+
+    /* 1. 해시 키 H = E(K, 0^128). PCLMULQDQ는 AES 백엔드와 무관하게 CPU가 지원하면 사용
+     *    (4비트 곱셈표는 H에 따라 주소가 달라지므로 비트슬라이스 백엔드에서도 피함) */
+    ops->encrypt_block(H, RoundKey);
+#ifdef AES256_HAVE_AESNI
+    ghash_init(&g, H, aes256_cpu_clmul);
+#else
+    ghash_init(&g, H, 0);
+#endif
+
+    /* 2. 초기 카운터 J0: 96비트 IV는 IV || 0^31 || 1, 그 외 길이는 GHASH(IV) */
+    if (iv_len == 12) {
+        memcpy(J0, iv, 12);
+        J0[12] = 0; J0[13] = 0; J0[14] = 0; J0[15] = 1;
+    } else {
+        ghash_update(&g, iv, iv_len);
+        store_be64(lens, 0);
+        store_be64(lens + 8, (uint64_t)iv_len * 8);
+        ghash_blocks(&g, lens, 1);
+        memcpy(J0, g.X, 16);
+        memset(g.X, 0, sizeof(g.X));
+    }
+
+    /* 3. 추가 인증 데이터(AAD) */
+    if (aad_len > 0) ghash_update(&g, aad, aad_len);
+
+    /* 4. 본문: 하위 32비트 카운터(inc32)로 키스트림 생성 + GHASH를 한 번에 처리 */
+    uint32_t ctr = load_be32(J0 + 12);
+    size_t pos = 0;
+    while (pos < len) {
+        size_t remain = len - pos;
+        size_t nblocks = (remain + 15) / 16;
+        if (nblocks > batch) nblocks = batch;
+        size_t nbytes = (remain < nblocks * 16) ? remain : nblocks * 16;
+
+        for (size_t j = 0; j < nblocks; j++) {
+            memcpy(ks + j * 16, J0, 12);
+            store_be32(ks + j * 16 + 12, ++ctr);
+        }
+        if (nblocks > 1 && ops->encrypt_blocks != NULL) {
+            ops->encrypt_blocks(ks, nblocks, RoundKey);
+        } else {
+            for (size_t j = 0; j < nblocks; j++) ops->encrypt_block(ks + j * 16, RoundKey);
+        }
+
+        /* GHASH는 항상 암호문에 대해 계산: 복호화는 XOR 전, 암호화는 XOR 후 */
+        if (!encrypt) ghash_update(&g, buf + pos, nbytes);
+        xor_bytes(buf + pos, ks, nbytes);
+        if (encrypt) ghash_update(&g, buf + pos, nbytes);
+        pos += nbytes;
+    }
+
+    /* 5. 길이 블록 [len(A)]64 || [len(C)]64 (비트 단위) */
+    store_be64(lens, (uint64_t)aad_len * 8);
+    store_be64(lens + 8, (uint64_t)len * 8);
+    ghash_blocks(&g, lens, 1);
+
+    /* 6. 태그 = E(K, J0) ^ GHASH */
+    ops->encrypt_block(J0, RoundKey);
+    for (int i = 0; i < 16; i++) tag[i] = J0[i] ^ g.X[i];
+
+    secure_memzero(&g, sizeof(g));
+    secure_memzero(H, sizeof(H));
+    secure_memzero(J0, sizeof(J0));
+    secure_memzero(ks, batch * 16);
+}
+
+/**
+ * @brief 데이터를 AES-256-GCM으로 암호화하고 인증 태그를 생성함 (제자리 처리, 임의 길이)
+ * @param aad 암호화하지 않고 인증만 할 데이터 (없으면 NULL, 0)
+ * @param iv  IV (권장 길이 12바이트, 같은 키로 절대 재사용 금지)
+ * @param tag [Out] 16바이트 인증 태그
+ * @return 성공 시 0, 실패 시 음수
+ */
+int AES256_GCM_Encrypt(uint8_t* buf, size_t len, const uint8_t* aad, size_t aad_len,
+                       const uint8_t* RoundKey, const uint8_t* iv, size_t iv_len, uint8_t* tag) {
+    if ((buf == NULL && len > 0) || (aad == NULL && aad_len > 0)) return -1;
+    if (RoundKey == NULL || iv == NULL || tag == NULL) return -1;
+    if (iv_len == 0 || (uint64_t)len > AES256_GCM_MAX_LEN) return -2;
+
+    gcm_crypt(buf, len, aad, aad_len, RoundKey, iv, iv_len, tag, 1);
+    return 0;
+}
+
+/**
+ * @brief AES-256-GCM 암호문을 복호화하고 인증 태그를 검증함 (제자리 처리)
+ * @details 태그가 일치하지 않으면 복호화된 내용을 0으로 지우고 -3을 반환함
+ * @param tag 수신한 16바이트 인증 태그
+ * @return 성공 시 0, 인증 실패 시 -3, 그 외 실패 시 음수
+ */
+int AES256_GCM_Decrypt(uint8_t* buf, size_t len, const uint8_t* aad, size_t aad_len,
+                       const uint8_t* RoundKey, const uint8_t* iv, size_t iv_len, const uint8_t* tag) {
+    if ((buf == NULL && len > 0) || (aad == NULL && aad_len > 0)) return -1;
+    if (RoundKey == NULL || iv == NULL || tag == NULL) return -1;
+    if (iv_len == 0 || (uint64_t)len > AES256_GCM_MAX_LEN) return -2;
+
+    uint8_t calc[16];
+    gcm_crypt(buf, len, aad, aad_len, RoundKey, iv, iv_len, calc, 0);
+
+    /* 타이밍 차이가 나지 않도록 모든 바이트를 비교 */
+    uint8_t diff = 0;
+    for (int i = 0; i < 16; i++) diff |= (uint8_t)(calc[i] ^ tag[i]);
+    secure_memzero(calc, sizeof(calc));
+
+    if (diff != 0) {
+        secure_memzero(buf, len);
+        return -3;
+    }
+    return 0;
+}
+
+/**
+ * @brief 교차 처리 폭(한 번에 처리할 독립 블록 수)을 지정함
+ * @return 성공 시 0, 1/2/4/8 이외의 값이면 -1
+ */
+int AES256_SetInterleave(int blocks) {
+    if (blocks != 1 && blocks != 2 && blocks != 4 && blocks != 8) return -1;
+    AES256_CFG_STORE(aes256_interleave, blocks);
+    return 0;
+}
+
+int AES256_GetInterleave(void) {
+    return AES256_CFG_LOAD(aes256_interleave);
+}
+
+/**
+ * @brief AES256_CBC_Decrypt가 큰 버퍼에 사용할 스레드 수를 지정함
+ * @return 성공 시 0, 범위(1~64)를 벗어나면 -1
+ */
+int AES256_SetThreads(int nthreads) {
+    if (nthreads < 1 || nthreads > AES256_MAX_THREADS) return -1;
+    AES256_CFG_STORE(aes256_threads, nthreads);
+    return 0;
+}
+
+int AES256_GetThreads(void) {
+    return AES256_CFG_LOAD(aes256_threads);
+}
+
+/**
+ * @brief 큰 버퍼를 스레드로 나눌 때 스레드 하나가 맡을 최소 크기를 지정함
+ * @return 성공 시 0, 16KB~64MB를 벗어나면 -1
+ */
+int AES256_SetSplitSize(size_t bytes) {
+    if (bytes < AES256_SPLIT_MIN || bytes > AES256_SPLIT_MAX) return -1;
+    AES256_CFG_STORE(aes256_split_bytes, bytes);
+    return 0;
+}
+
+size_t AES256_GetSplitSize(void) {
+    return AES256_CFG_LOAD(aes256_split_bytes);
+}
+
+/* ---------------- 사용 예시 ----------------
+uint8_t key[32] = { ... };          // 256비트 키
+uint8_t iv[16]  = { ... };          // 초기화 벡터(IV)
+uint8_t RoundKey[240];              // 확장된 라운드 키 버퍼
+
+// (선택) 백엔드 지정: 시작 시 CPUID로 자동 선택됨 (AES-NI > 비트슬라이스 > T-table > ref)
+AES256_SetImpl(AES256_IMPL_TTABLE);
+
+// 키 확장 수행
+if (KeyExpansion(RoundKey, key) != 0) {
+    // 에러 처리
+}
+
+// CBC 암호화
+if (AES256_CBC_Encrypt(data, data_len, RoundKey, iv) != 0) {
+    // 에러 처리
+}
+
+// CBC 복호화
+if (AES256_CBC_Decrypt(data, data_len, RoundKey, iv) != 0) {
+    // 에러 처리
+}
+
+// 스트리밍 CBC (PKCS#7 패딩 자동 처리): 파일/소켓을 고정 크기 조각으로 처리
+AES256_CBC_CTX ctx;
+uint8_t chunk[4096], out[4096 + 16];
+size_t n, out_len;
+AES256_CBC_EncryptInit(&ctx, key, iv);
+while ((n = fread(chunk, 1, sizeof(chunk), in_fp)) > 0) {
+    AES256_CBC_Update(&ctx, chunk, n, out, &out_len);
+    fwrite(out, 1, out_len, out_fp);
+}
+AES256_CBC_Final(&ctx, out, &out_len);   // 마지막 패딩 블록, ctx는 자동으로 지워짐
+fwrite(out, 1, out_len, out_fp);
+
+// 헤더/본문/트레일러로 나뉜 메시지를 한 버퍼로 모으지 않고 암호화하여 전송 버퍼에 씀
+struct iovec parts[3] = { { hdr, hdr_len }, { body, body_len }, { trailer, trailer_len } };
+struct iovec wire = { send_buf, hdr_len + body_len + trailer_len };   // 합계는 16의 배수
+AES256_CBC_EncryptV(parts, 3, &wire, 1, RoundKey, iv);              // out을 NULL로 주면 제자리 처리
+
+// CTR 암복호화 (패딩 불필요, 임의 길이). 파일의 4096번째 바이트부터 일부만 복호화하는 예:
+if (AES256_CTR_Crypt(data + 4096, 100, RoundKey, iv, 4096) != 0) {
+    // 에러 처리
+}
+
+// XTS (디스크/스풀 파일): 데이터 키와 tweak 키를 각각 확장, 4KB 섹터 단위로 다시 쓸 수 있음
+uint8_t rk_data[240], rk_tweak[240];
+KeyExpansion(rk_data, key_data);
+KeyExpansion(rk_tweak, key_tweak);                              // key_data와 다른 키여야 함
+AES256_XTS_EncryptSectors(disk_buf, 4096, nsectors, rk_data, rk_tweak, first_sector, 0);
+AES256_XTS_DecryptSectors(disk_buf + 4096 * 3, 4096, 1, rk_data, rk_tweak, first_sector + 3, 1);
+
+// GCM 인증 암호화 (암호화와 인증을 한 번의 순회로 처리)
+uint8_t nonce[12] = { ... }, tag[16];
+AES256_GCM_Encrypt(data, data_len, header, header_len, RoundKey, nonce, sizeof(nonce), tag);
+if (AES256_GCM_Decrypt(data, data_len, header, header_len, RoundKey, nonce, sizeof(nonce), tag) == -3) {
+    // 위변조 감지: data는 0으로 지워져 있음
+}
+
+// GCM을 쓸 수 없는 상대 기관: CTR + CMAC을 한 패스로 (암호화 키와 MAC 키는 서로 다른 키)
+uint8_t rk_enc[240], rk_mac[240], ctr_iv[16] = { ... }, mac[16];
+KeyExpansion(rk_enc, key_enc);
+KeyExpansion(rk_mac, key_mac);
+AES256_CTR_CMAC_Encrypt(data, data_len, rk_enc, rk_mac, ctr_iv, mac);     // 전송: ctr_iv || data || mac
+if (AES256_CTR_CMAC_Decrypt(data, data_len, rk_enc, rk_mac, ctr_iv, mac) == -3) {
+    // 위변조 감지: data는 0으로 지워져 있음
+}
+AES256_CMAC(msg, msg_len, rk_mac, mac);                                    // MAC만 필요할 때
+
+// 상대 기관별 키가 여러 개일 때: 키 ID로 캐시해 메시지마다 키 확장을 반복하지 않음
+AES256_KEY_CACHE* cache = AES256_KeyCacheCreate(256);
+const AES256_KEY* k = AES256_KeyCacheAcquire(cache, partner_id, partner_key);
+if (k != NULL) {
+    AES256_CBC_Decrypt_Key(data, data_len, k, iv);             // 복호화 라운드 키도 캐시된 것 사용
+    AES256_GCM_Encrypt(data, data_len, NULL, 0, k->RoundKey, nonce, sizeof(nonce), tag);
+    AES256_KeyCacheRelease(cache, k);
 }
+AES256_KeyCacheDestroy(cache);                                  // 남은 키는 모두 소거됨
 
 // 사용 완료 후 민감 정보 안전하게 삭제
 secure_memzero(RoundKey, sizeof(RoundKey));
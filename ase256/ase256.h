@@ -0,0 +1,231 @@
+/*
+ * ase256.h
+ * - AES-256 블록 암호 및 운영 모드의 공개 인터페이스
+ *
+ * 사용 방법:
+ * - KeyExpansion으로 240바이트 라운드 키를 만든 뒤 블록/CBC 함수에 전달합니다.
+ * - 내부 구현(백엔드)은 프로그램 시작 시 CPUID로 자동 선택되며
+ *   (AES-NI > 비트슬라이스 > T-table), AES256_SetImpl로 강제할 수 있습니다.
+ *   AES-NI가 없을 때는 캐시 타이밍에 안전한 비트슬라이스 구현이 기본값입니다.
+ *   어떤 백엔드를 쓰더라도 입출력 결과는 FIPS-197과 동일합니다.
+ */
+
+#ifndef ASE256_H
+#define ASE256_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/uio.h>
+
+/* 확장된 라운드 키의 크기 (15라운드 x 16바이트) */
+#define AES256_ROUNDKEY_SIZE 240
+
+/* 구현 백엔드 식별자 */
+typedef enum {
+    AES256_IMPL_AUTO = 0, /* 현재 CPU에서 가장 빠른 구현 자동 선택 */
+    AES256_IMPL_REF,      /* 바이트 단위 참조 구현 (state_t 기반) */
+    AES256_IMPL_TTABLE,   /* 32비트 T-table 구현 */
+    AES256_IMPL_AESNI,    /* x86 AES-NI 명령어 (CPUID로 지원 여부 확인) */
+    AES256_IMPL_BITSLICE, /* 비트슬라이스 8블록 병렬 (테이블 조회 없는 상수 시간 구현) */
+    AES256_IMPL_COUNT
+} aes256_impl_t;
+
+int KeyExpansion(uint8_t* RoundKey, const uint8_t* Key);
+
+int AES256_EncryptBlock(uint8_t* buf, const uint8_t* RoundKey);
+int AES256_DecryptBlock(uint8_t* buf, const uint8_t* RoundKey);
+
+int AES256_CBC_Encrypt(uint8_t* buf, size_t len, const uint8_t* RoundKey, const uint8_t* iv);
+int AES256_CBC_Decrypt(uint8_t* buf, size_t len, const uint8_t* RoundKey, const uint8_t* iv);
+
+/* 스레드 수를 직접 지정하는 CBC 복호화 (블록 경계에서 버퍼를 나누어 병렬 처리) */
+int AES256_CBC_Decrypt_MT(uint8_t* buf, size_t len, const uint8_t* RoundKey, const uint8_t* iv, int nthreads);
+
+/*
+ * 다중 버퍼 CBC 암호화: 키/IV가 각자 다른 독립 메시지 여러 개를 블록 단위로 교차 처리
+ * - 작은 메시지를 대량으로 암호화할 때 AES256_CBC_Encrypt를 반복 호출하는 것보다 빠름
+ * - result는 함수가 채움 (0 성공, -1 인자 오류, -2 길이가 16의 배수가 아님)
+ */
+typedef struct {
+    uint8_t* buf;             /* 제자리 암호화할 메시지 */
+    size_t len;               /* 16의 배수 */
+    const uint8_t* RoundKey;  /* KeyExpansion 결과 */
+    const uint8_t* iv;        /* 16바이트 IV */
+    int result;
+} AES256_CBC_JOB;
+
+int AES256_CBC_Encrypt_Multi(AES256_CBC_JOB* jobs, size_t njobs);
+
+/*
+ * CBC 스트리밍 컨텍스트 (PKCS#7 패딩을 라이브러리가 처리)
+ * - Init에서 키를 한 번만 확장해 보관하고, Update는 임의 길이 조각을 받아
+ *   완성된 블록만 출력하며, Final이 패딩 블록을 처리한 뒤 컨텍스트를 지웁니다.
+ * - Update의 out에는 in_len + 16바이트, Final의 out에는 16바이트 공간이 필요합니다.
+ * - in과 out은 겹치면 안 됩니다.
+ * - 중간에 중단할 때는 AES256_CBC_Cleanup으로 키를 지울 것
+ */
+typedef struct {
+    uint8_t RoundKey[AES256_ROUNDKEY_SIZE]; /* 암호화: 라운드 키 / 복호화: 복호화 라운드 키 */
+    uint8_t iv[16];                         /* 체이닝 값 (직전 암호문 블록) */
+    uint8_t buf[16];                        /* 아직 블록을 채우지 못한 입력 */
+    size_t buf_len;
+    int encrypt;                            /* 1: 암호화, 0: 복호화 */
+} AES256_CBC_CTX;
+
+int AES256_CBC_EncryptInit(AES256_CBC_CTX* ctx, const uint8_t* Key, const uint8_t* iv);
+int AES256_CBC_DecryptInit(AES256_CBC_CTX* ctx, const uint8_t* Key, const uint8_t* iv);
+int AES256_CBC_Update(AES256_CBC_CTX* ctx, const uint8_t* in, size_t in_len, uint8_t* out, size_t* out_len);
+int AES256_CBC_Final(AES256_CBC_CTX* ctx, uint8_t* out, size_t* out_len);
+void AES256_CBC_Cleanup(AES256_CBC_CTX* ctx);
+
+/*
+ * CBC 분산/수집(iovec) 암복호화: 여러 버퍼로 나뉜 메시지를 모으지 않고 처리
+ * - 세그먼트 길이는 자유이며 전체 길이만 16의 배수이면 됨 (세그먼트에 걸친 블록도 처리)
+ * - out이 NULL이면 제자리 처리, 아니면 out 세그먼트들(배치가 달라도 됨)에 씀 (입출력이 겹치면 안 됨)
+ * - 반환값: 0 성공, -1 인자 오류, -2 길이 오류 (전체 길이가 0이거나 16의 배수가 아님, 출력 공간 부족)
+ */
+int AES256_CBC_EncryptV(const struct iovec* in, int in_cnt, const struct iovec* out, int out_cnt,
+                        const uint8_t* RoundKey, const uint8_t* iv);
+int AES256_CBC_DecryptV(const struct iovec* in, int in_cnt, const struct iovec* out, int out_cnt,
+                        const uint8_t* RoundKey, const uint8_t* iv);
+
+/*
+ * 키 스케줄 객체: 암호화 라운드 키와 등가 역암호용 복호화 라운드 키를 함께 보관
+ * - RoundKey는 KeyExpansion 결과와 같으므로 암호화/CTR/GCM 함수에 그대로 넘기면 됨
+ * - *_Key 복호화 함수는 호출마다 하던 역 라운드 키 계산(InvMixColumns 13회)을 생략함
+ */
+typedef struct {
+    uint8_t RoundKey[AES256_ROUNDKEY_SIZE];
+    uint8_t DecKey[AES256_ROUNDKEY_SIZE];
+} AES256_KEY;
+
+int AES256_KeyInit(AES256_KEY* key, const uint8_t* Key);
+void AES256_KeyClear(AES256_KEY* key);
+int AES256_DecryptBlock_Key(uint8_t* buf, const AES256_KEY* key);
+int AES256_CBC_Decrypt_Key(uint8_t* buf, size_t len, const AES256_KEY* key, const uint8_t* iv);
+
+/*
+ * 키 ID별 키 스케줄 LRU 캐시 (상대 기관마다 키가 다른 다중 테넌트 환경용, 스레드 안전)
+ * - Acquire: 캐시에 있으면 바로 반환, 없으면 Key로 계산해 넣음 (자리가 없으면 가장 오래된 항목을 소거)
+ * - 반환된 키는 Release 전까지 쫓겨나지 않으며, 모든 항목이 사용 중이면 Acquire가 NULL을 반환
+ * - 같은 ID에 다른 Key를 넘기면 키 교체로 보고 새로 계산함
+ * - 항목은 캐시 라인 경계에 정렬되어 있고, 쫓겨나거나 지워진 키는 즉시 0으로 소거됨
+ */
+typedef struct AES256_KEY_CACHE AES256_KEY_CACHE;
+
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    size_t entries;
+} AES256_KEY_CACHE_STATS;
+
+AES256_KEY_CACHE* AES256_KeyCacheCreate(size_t capacity);
+void AES256_KeyCacheDestroy(AES256_KEY_CACHE* cache);
+const AES256_KEY* AES256_KeyCacheAcquire(AES256_KEY_CACHE* cache, uint64_t key_id, const uint8_t* Key);
+void AES256_KeyCacheRelease(AES256_KEY_CACHE* cache, const AES256_KEY* key);
+int AES256_KeyCacheRemove(AES256_KEY_CACHE* cache, uint64_t key_id);
+void AES256_KeyCacheStats(AES256_KEY_CACHE* cache, AES256_KEY_CACHE_STATS* stats);
+
+/*
+ * CTR 모드 암복호화 (같은 함수로 양방향 처리, 임의 길이, 패딩 없음)
+ * - iv: 16바이트 초기 카운터 블록, 블록마다 128비트 빅엔디언으로 1씩 증가
+ * - offset: buf[0]이 스트림에서 차지하는 바이트 위치 (임의 구간 처리/병렬 분할용)
+ */
+int AES256_CTR_Crypt(uint8_t* buf, size_t len, const uint8_t* RoundKey, const uint8_t* iv, uint64_t offset);
+
+/*
+ * AES-256-CMAC (SP 800-38B, 임의 길이 메시지, 태그 16바이트)
+ */
+int AES256_CMAC(const uint8_t* msg, size_t len, const uint8_t* RoundKey, uint8_t* mac);
+
+/*
+ * CTR + CMAC 인증 암호화 (Encrypt-then-MAC, 제자리 처리, 임의 길이, 한 패스로 처리)
+ * - 결과는 AES256_CTR_Crypt(offset 0) 후 태그 = AES256_CMAC(iv || 암호문)과 같음
+ * - EncRoundKey와 MacRoundKey는 서로 다른 키를 각각 KeyExpansion한 결과
+ * - 반환값: 0 성공, -1 인자 오류(두 키가 같은 경우 포함), -3 태그 불일치(buf를 0으로 지움)
+ */
+int AES256_CTR_CMAC_Encrypt(uint8_t* buf, size_t len, const uint8_t* EncRoundKey, const uint8_t* MacRoundKey,
+                            const uint8_t* iv, uint8_t* tag);
+int AES256_CTR_CMAC_Decrypt(uint8_t* buf, size_t len, const uint8_t* EncRoundKey, const uint8_t* MacRoundKey,
+                            const uint8_t* iv, const uint8_t* tag);
+
+/*
+ * 난수 생성 (IV/nonce용): AES-256 CTR-DRBG (SP 800-90A, 유도 함수 없음)
+ * - AES256_RandomBytes/RandomIVs: 스레드마다 따로 둔 생성기를 사용하며 평소에는 시스템 호출이
+ *   없음. 처음 사용할 때, AES256_DRBG_RESEED_INTERVAL회 요청마다, fork 후 자식 프로세스에서
+ *   처음 사용할 때 getrandom으로 다시 시드함. 실패 시 -4
+ * - AES256_DRBG_*: 상태를 직접 관리하는 저수준 인터페이스 (엔트로피는 호출자가 공급, 시험용)
+ *   엔트로피 48바이트, 개인화/추가 입력 최대 48바이트, Generate 한 번에 최대 64KB,
+ *   재시드 주기를 넘기면 Generate가 -3을 반환함
+ */
+#define AES256_DRBG_SEED_LEN        48
+#define AES256_DRBG_RESEED_INTERVAL (1ULL << 16)
+
+typedef struct {
+    uint8_t RoundKey[AES256_ROUNDKEY_SIZE];
+    uint8_t V[16];
+    uint64_t reseed_counter;
+} AES256_DRBG;
+
+int AES256_DRBG_Instantiate(AES256_DRBG* drbg, const uint8_t* entropy, const uint8_t* pers, size_t pers_len);
+int AES256_DRBG_Reseed(AES256_DRBG* drbg, const uint8_t* entropy, const uint8_t* add, size_t add_len);
+int AES256_DRBG_Generate(AES256_DRBG* drbg, uint8_t* out, size_t len, const uint8_t* add, size_t add_len);
+void AES256_DRBG_Clear(AES256_DRBG* drbg);
+
+int AES256_RandomBytes(uint8_t* out, size_t len);
+int AES256_RandomIVs(uint8_t* ivs, size_t count);
+int AES256_RandomReseed(void);
+
+/*
+ * XTS-AES-256 (IEEE 1619, 저장 장치/파일의 섹터 단위 암호화, 제자리 처리, 길이 불변)
+ * - RoundKey1(데이터 키)과 RoundKey2(tweak 키)는 서로 다른 키를 각각 KeyExpansion한 결과
+ * - 데이터 단위 하나는 16 ~ 2^24바이트, 16의 배수가 아니면 암호문 훔치기로 처리
+ * - Encrypt/Decrypt: tweak 16바이트를 직접 지정 / *Sectors: 크기가 같은 연속 섹터 여러 개,
+ *   섹터 i의 tweak은 (first_sector + i)의 128비트 리틀엔디언 표현, 스레드로 나누어 처리
+ * - 반환값: 0 성공, -1 인자 오류(두 키가 같은 경우 포함), -2 길이 오류
+ */
+int AES256_XTS_Encrypt(uint8_t* buf, size_t len, const uint8_t* RoundKey1, const uint8_t* RoundKey2,
+                       const uint8_t* tweak);
+int AES256_XTS_Decrypt(uint8_t* buf, size_t len, const uint8_t* RoundKey1, const uint8_t* RoundKey2,
+                       const uint8_t* tweak);
+int AES256_XTS_EncryptSectors(uint8_t* buf, size_t sector_size, size_t nsectors, const uint8_t* RoundKey1,
+                              const uint8_t* RoundKey2, uint64_t first_sector, int nthreads);
+int AES256_XTS_DecryptSectors(uint8_t* buf, size_t sector_size, size_t nsectors, const uint8_t* RoundKey1,
+                              const uint8_t* RoundKey2, uint64_t first_sector, int nthreads);
+
+/*
+ * GCM 인증 암호화 (제자리 처리, 임의 길이, 태그 16바이트)
+ * - GHASH는 CPU가 지원하면 백엔드와 무관하게 PCLMULQDQ, 없으면 4비트 테이블 구현을 사용
+ * - Decrypt는 태그 불일치 시 -3을 반환하고 buf를 0으로 지움
+ */
+int AES256_GCM_Encrypt(uint8_t* buf, size_t len, const uint8_t* aad, size_t aad_len,
+                       const uint8_t* RoundKey, const uint8_t* iv, size_t iv_len, uint8_t* tag);
+int AES256_GCM_Decrypt(uint8_t* buf, size_t len, const uint8_t* aad, size_t aad_len,
+                       const uint8_t* RoundKey, const uint8_t* iv, size_t iv_len, const uint8_t* tag);
+
+/*
+ * 병렬 처리 설정 (프로세스 전역, 암복호화 호출 전에 설정할 것)
+ * - Interleave: 한 스레드가 동시에 처리할 독립 블록 수 (1, 2, 4, 8 / 기본 8)
+ *   CBC 복호화와 CTR 키스트림 생성에 적용됨
+ * - Threads: AES256_CBC_Decrypt가 SplitSize 이상 구간마다 나누어 쓸 스레드 수 (기본 1)
+ * - SplitSize: 스레드 하나가 맡을 최소 크기 (16KB~64MB / 기본 256KB), XTS 섹터 병렬 처리에도 적용
+ * - 이 머신에 맞는 값은 ase256_tune.h의 AES256_Autotune으로 측정해 정할 수 있음
+ */
+int AES256_SetInterleave(int blocks);
+int AES256_GetInterleave(void);
+int AES256_SetThreads(int nthreads);
+int AES256_GetThreads(void);
+int AES256_SetSplitSize(size_t bytes);
+size_t AES256_GetSplitSize(void);
+
+/*
+ * 백엔드 선택: 사용할 수 없는 구현을 요청하면 -1을 반환하고 기존 설정을 유지합니다.
+ * AES256_IMPL_AUTO는 사용 가능한 구현 중 가장 빠른 것을 고릅니다.
+ */
+int AES256_SetImpl(aes256_impl_t impl);
+aes256_impl_t AES256_GetImpl(void);
+int AES256_ImplAvailable(aes256_impl_t impl);
+const char* AES256_ImplName(aes256_impl_t impl);
+
+#endif // ASE256_H
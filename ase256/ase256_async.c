@@ -0,0 +1,591 @@
+/*
+ * ase256_async.c
+ * - 고정 워커 풀로 동작하는 비동기 AES-256 암복호화 서비스 (동작 방식은 ase256_async.h 참고)
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE /* sched_getcpu, pthread_setaffinity_np */
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sched.h>
+#include <pthread.h>
+#include "ase256.h"
+#include "ase256_async.h"
+
+/* 워커 하나의 대기열과 대기열 통계 (모두 lock으로 보호) */
+typedef struct {
+    AES256_ASYNC* svc;
+    int id;
+    pthread_t tid;
+    int started;
+
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    AES256_ASYNC_TASK* head;
+    AES256_ASYNC_TASK* tail;
+    size_t depth;
+    int idle;               /* 대기열이 비어 cond에서 기다리는 중 */
+    int wake;               /* 다른 대기열의 작업을 가져가라는 신호 */
+    int stop;               /* 남은 작업이 없으면 종료 */
+
+    uint64_t tasks;
+    uint64_t batches;
+    uint64_t max_batch;
+    uint64_t steals;
+    uint64_t max_depth;
+} async_worker_t;
+
+struct AES256_ASYNC {
+    int nworkers;
+    size_t batch_max;
+    size_t split_bytes;
+    async_worker_t* w;
+
+    /* 완료 통지, 종료 처리, 작업 단위 통계 */
+    pthread_mutex_t lock;
+    pthread_cond_t done_cond;   /* 작업 하나 완료 (Wait 중인 스레드가 있을 때만 알림) */
+    pthread_cond_t drain_cond;  /* 진행 중인 작업이 0개가 됨 */
+    size_t inflight;
+    size_t waiters;             /* AES256_AsyncWait에서 기다리는 스레드 수 */
+    int closing;            /* 새 제출 거부 */
+    unsigned next_queue;    /* sched_getcpu를 쓸 수 없을 때의 순환 배정 */
+    uint64_t submitted, completed, failed, split_jobs;
+    uint64_t latency_total_ns, latency_max_ns;
+    uint64_t latency_hist[AES256_ASYNC_LAT_BUCKETS];
+};
+
+static uint64_t async_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int async_online_cpus(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n < 1) ? 1 : (int)n;
+}
+
+/**
+ * @brief 지연 시간(ns)이 들어갈 히스토그램 버킷 (µs 단위 log2)
+ */
+static int async_lat_bucket(uint64_t ns) {
+    uint64_t us = ns / 1000;
+    int b = 0;
+    while (us != 0 && b < AES256_ASYNC_LAT_BUCKETS - 1) {
+        us >>= 1;
+        b++;
+    }
+    return b;
+}
+
+/* ---------------- 대기열 ---------------- */
+
+/**
+ * @brief 대기 중인 워커 하나를 깨워 다른 대기열의 작업을 가져가게 함 (skip은 제외)
+ */
+static void async_wake_idle(AES256_ASYNC* svc, int skip) {
+    for (int i = 0; i < svc->nworkers; i++) {
+        if (i == skip) continue;
+        async_worker_t* w = &svc->w[i];
+        pthread_mutex_lock(&w->lock);
+        int idle = w->idle;
+        if (idle) {
+            w->idle = 0;
+            w->wake = 1;
+            pthread_cond_signal(&w->cond);
+        }
+        pthread_mutex_unlock(&w->lock);
+        if (idle) return;
+    }
+}
+
+/**
+ * @brief 워커 qi의 대기열 끝에 항목을 넣음
+ * @details 주인 워커가 바쁘면 쉬고 있는 다른 워커를 깨워 가져가게 함
+ */
+static void async_push(AES256_ASYNC* svc, int qi, AES256_ASYNC_TASK* t) {
+    async_worker_t* w = &svc->w[qi];
+
+    t->next = NULL;
+    pthread_mutex_lock(&w->lock);
+    if (w->tail != NULL) {
+        w->tail->next = t;
+    } else {
+        w->head = t;
+    }
+    w->tail = t;
+    if (++w->depth > w->max_depth) w->max_depth = w->depth;
+    /* 한 번 깨운 뒤에는 워커가 실제로 돌기 전까지 다시 깨우지 않음 (futex 호출 절약) */
+    int idle = w->idle;
+    if (idle) {
+        w->idle = 0;
+        pthread_cond_signal(&w->cond);
+    }
+    pthread_mutex_unlock(&w->lock);
+
+    if (!idle) async_wake_idle(svc, qi);
+}
+
+/**
+ * @brief 대기열 앞에서 묶음 하나를 꺼냄 (w->lock을 잡은 상태에서 호출)
+ * @details 최대 batch_max개를 꺼내되, 누적 크기가 split_bytes에 이르면 멈춤
+ *          (큰 조각은 혼자 처리되고 작은 작업만 여러 개가 묶임)
+ * @return 꺼낸 항목 수
+ */
+static size_t async_take(AES256_ASYNC* svc, async_worker_t* w, AES256_ASYNC_TASK** out) {
+    size_t n = 0, bytes = 0;
+
+    while (w->head != NULL && n < svc->batch_max && bytes < svc->split_bytes) {
+        AES256_ASYNC_TASK* t = w->head;
+        w->head = t->next;
+        out[n++] = t;
+        bytes += t->len;
+    }
+    if (w->head == NULL) w->tail = NULL;
+    w->depth -= n;
+    return n;
+}
+
+/**
+ * @brief 꺼낸 묶음을 통계에 반영함 (self->lock을 잡은 상태에서 호출)
+ * @details 처리 전에 세어 두어야 AES256_AsyncDrain 직후의 통계에 빠지지 않음
+ */
+static void async_count_batch(async_worker_t* self, size_t n) {
+    self->tasks += n;
+    self->batches++;
+    if (n > self->max_batch) self->max_batch = n;
+}
+
+/**
+ * @brief 자기 대기열, 비어 있으면 다른 워커의 대기열에서 묶음을 꺼냄
+ * @return 꺼낸 항목 수 (모두 비어 있으면 0)
+ */
+static size_t async_next_batch(AES256_ASYNC* svc, async_worker_t* self, AES256_ASYNC_TASK** out) {
+    pthread_mutex_lock(&self->lock);
+    size_t n = async_take(svc, self, out);
+    if (n > 0) async_count_batch(self, n);
+    pthread_mutex_unlock(&self->lock);
+    if (n > 0) return n;
+
+    for (int k = 1; k < svc->nworkers; k++) {
+        async_worker_t* victim = &svc->w[(self->id + k) % svc->nworkers];
+        pthread_mutex_lock(&victim->lock);
+        n = async_take(svc, victim, out);
+        pthread_mutex_unlock(&victim->lock);
+        if (n > 0) {
+            pthread_mutex_lock(&self->lock);
+            self->steals++;
+            async_count_batch(self, n);
+            pthread_mutex_unlock(&self->lock);
+            return n;
+        }
+    }
+    return 0;
+}
+
+/* ---------------- 작업 처리 ---------------- */
+
+/* 묶음 하나를 처리하는 동안 끝난 작업의 통계와 완료 표시를 모았다가 한 번에 반영함 */
+typedef struct {
+    uint64_t completed, failed, latency_total_ns, latency_max_ns;
+    uint64_t latency_hist[AES256_ASYNC_LAT_BUCKETS];
+    AES256_ASYNC_JOB* futures[AES256_ASYNC_MAX_BATCH];  /* 콜백이 없어 done 표시가 필요한 작업 */
+    size_t nfutures;
+} async_done_t;
+
+/**
+ * @brief 작업을 끝냄: 지연 시간 기록, 콜백 호출 (콜백이 없으면 완료 표시를 미룸)
+ * @details 콜백 호출 후에는 job이 해제될 수 있으므로 건드리지 않음
+ */
+static void async_finish(AES256_ASYNC_JOB* job, uint64_t end, async_done_t* d) {
+    job->queue_ns = job->start_ns - job->submit_ns;
+    job->latency_ns = end - job->submit_ns;
+    free(job->pieces);
+    job->pieces = NULL;
+
+    uint64_t lat = job->latency_ns;
+    d->completed++;
+    if (job->result != 0) d->failed++;
+    d->latency_total_ns += lat;
+    if (lat > d->latency_max_ns) d->latency_max_ns = lat;
+    d->latency_hist[async_lat_bucket(lat)]++;
+
+    if (job->callback != NULL) {
+        job->callback(job, job->arg);
+    } else {
+        d->futures[d->nfutures++] = job;
+    }
+}
+
+/**
+ * @brief 모아 둔 완료 정보를 서비스에 반영하고 기다리는 스레드를 깨움
+ */
+static void async_commit(AES256_ASYNC* svc, async_done_t* d) {
+    if (d->completed == 0) return;
+
+    pthread_mutex_lock(&svc->lock);
+    svc->completed += d->completed;
+    svc->failed += d->failed;
+    svc->latency_total_ns += d->latency_total_ns;
+    if (d->latency_max_ns > svc->latency_max_ns) svc->latency_max_ns = d->latency_max_ns;
+    for (int i = 0; i < AES256_ASYNC_LAT_BUCKETS; i++) svc->latency_hist[i] += d->latency_hist[i];
+    for (size_t i = 0; i < d->nfutures; i++) d->futures[i]->done = 1;
+    if (d->nfutures > 0 && svc->waiters > 0) pthread_cond_broadcast(&svc->done_cond);
+    svc->inflight -= d->completed;
+    if (svc->inflight == 0) pthread_cond_broadcast(&svc->drain_cond);
+    pthread_mutex_unlock(&svc->lock);
+}
+
+/**
+ * @brief 항목 하나의 처리가 끝났음을 기록하고, 작업의 마지막 항목이면 작업을 끝냄
+ */
+static void async_task_done(AES256_ASYNC* svc, AES256_ASYNC_TASK* t, int rc, uint64_t start, uint64_t end,
+                            async_done_t* d) {
+    AES256_ASYNC_JOB* job = t->job;
+
+    /* 나누지 않은 작업은 이 워커만 건드리므로 잠그지 않음 */
+    if (job->pieces == NULL) {
+        job->result = rc;
+        job->start_ns = start;
+        async_finish(job, end, d);
+        return;
+    }
+
+    pthread_mutex_lock(&svc->lock);
+    if (rc != 0 && job->result == 0) job->result = rc;
+    if (start < job->start_ns) job->start_ns = start;
+    int last = (--job->pending == 0);
+    pthread_mutex_unlock(&svc->lock);
+
+    if (last) async_finish(job, end, d);
+}
+
+/**
+ * @brief 꺼낸 묶음을 처리함
+ * @details CBC 암호화 작업들은 AES256_CBC_Encrypt_Multi 한 번으로 교차 처리하고,
+ *          CBC 복호화/CTR 항목은 차례로 처리함 (조각이면 조각 범위만)
+ */
+static void async_run_batch(AES256_ASYNC* svc, AES256_ASYNC_TASK** batch, size_t n) {
+    AES256_CBC_JOB multi[AES256_ASYNC_MAX_BATCH];
+    AES256_ASYNC_TASK* multi_task[AES256_ASYNC_MAX_BATCH];
+    size_t nmulti = 0;
+    async_done_t done = { 0 };
+    uint64_t start = async_now_ns();
+
+    for (size_t i = 0; i < n; i++) {
+        AES256_ASYNC_TASK* t = batch[i];
+        AES256_ASYNC_JOB* job = t->job;
+        int rc;
+
+        switch (job->op) {
+        case AES256_ASYNC_CBC_ENCRYPT:
+            multi[nmulti] = (AES256_CBC_JOB){ .buf = job->buf, .len = job->len,
+                                              .RoundKey = job->RoundKey, .iv = job->iv };
+            multi_task[nmulti++] = t;
+            continue;
+        case AES256_ASYNC_CBC_DECRYPT:
+            /* 워커가 이미 병렬로 돌고 있으므로 조각 안에서는 스레드를 더 만들지 않음 */
+            rc = AES256_CBC_Decrypt_MT(job->buf + t->off, t->len, job->RoundKey, t->iv, 1);
+            break;
+        default:
+            rc = AES256_CTR_Crypt(job->buf + t->off, t->len, job->RoundKey, job->iv, t->off);
+            break;
+        }
+        async_task_done(svc, t, rc, start, async_now_ns(), &done);
+    }
+
+    if (nmulti > 0) {
+        AES256_CBC_Encrypt_Multi(multi, nmulti);
+        uint64_t end = async_now_ns();
+        for (size_t i = 0; i < nmulti; i++) async_task_done(svc, multi_task[i], multi[i].result, start, end, &done);
+    }
+    async_commit(svc, &done);
+}
+
+static void* async_worker(void* arg) {
+    async_worker_t* self = (async_worker_t*)arg;
+    AES256_ASYNC* svc = self->svc;
+    AES256_ASYNC_TASK* batch[AES256_ASYNC_MAX_BATCH];
+
+    for (;;) {
+        size_t n = async_next_batch(svc, self, batch);
+        if (n > 0) {
+            async_run_batch(svc, batch, n);
+            continue;
+        }
+
+        /* 할 일이 없으면 자기 대기열에 작업이 들어오거나 깨울 때까지 기다림 */
+        pthread_mutex_lock(&self->lock);
+        while (self->head == NULL && !self->wake && !self->stop) {
+            self->idle = 1;
+            pthread_cond_wait(&self->cond, &self->lock);
+            self->idle = 0;
+        }
+        self->wake = 0;
+        int stop = self->stop && self->head == NULL;
+        pthread_mutex_unlock(&self->lock);
+        if (stop) break;
+    }
+    return NULL;
+}
+
+/* ---------------- 서비스 생성/종료 ---------------- */
+
+/**
+ * @brief 워커들을 깨워 종료시키고 자원을 해제함 (남은 작업이 없는 상태에서 호출)
+ */
+static void async_shutdown(AES256_ASYNC* svc, int nworkers) {
+    for (int i = 0; i < nworkers; i++) {
+        async_worker_t* w = &svc->w[i];
+        pthread_mutex_lock(&w->lock);
+        w->stop = 1;
+        pthread_cond_signal(&w->cond);
+        pthread_mutex_unlock(&w->lock);
+    }
+    for (int i = 0; i < nworkers; i++) {
+        if (svc->w[i].started) pthread_join(svc->w[i].tid, NULL);
+        pthread_cond_destroy(&svc->w[i].cond);
+        pthread_mutex_destroy(&svc->w[i].lock);
+    }
+    pthread_cond_destroy(&svc->done_cond);
+    pthread_cond_destroy(&svc->drain_cond);
+    pthread_mutex_destroy(&svc->lock);
+    free(svc->w);
+    free(svc);
+}
+
+/**
+ * @brief 비동기 서비스를 만들고 워커 스레드를 시작함
+ * @param cfg 설정 (NULL이거나 0인 항목은 기본값)
+ * @return 서비스 핸들, 실패 시 NULL
+ */
+AES256_ASYNC* AES256_AsyncCreate(const AES256_ASYNC_CONFIG* cfg) {
+    AES256_ASYNC_CONFIG c = { 0 };
+    if (cfg != NULL) c = *cfg;
+
+    int ncpu = async_online_cpus();
+    if (c.workers < 0 || c.workers > AES256_ASYNC_MAX_WORKERS) return NULL;
+    if (c.batch_max > AES256_ASYNC_MAX_BATCH) return NULL;
+    if (c.workers == 0) c.workers = (ncpu > AES256_ASYNC_MAX_WORKERS) ? AES256_ASYNC_MAX_WORKERS : ncpu;
+    if (c.batch_max == 0) c.batch_max = AES256_ASYNC_DEFAULT_BATCH;
+    if (c.split_bytes == 0) c.split_bytes = AES256_ASYNC_DEFAULT_SPLIT;
+    c.split_bytes &= ~(size_t)15;
+    if (c.split_bytes == 0) return NULL;
+
+    AES256_ASYNC* svc = (AES256_ASYNC*)calloc(1, sizeof(AES256_ASYNC));
+    if (svc == NULL) return NULL;
+    svc->w = (async_worker_t*)calloc((size_t)c.workers, sizeof(async_worker_t));
+    if (svc->w == NULL) {
+        free(svc);
+        return NULL;
+    }
+    svc->nworkers = c.workers;
+    svc->batch_max = c.batch_max;
+    svc->split_bytes = c.split_bytes;
+    pthread_mutex_init(&svc->lock, NULL);
+    pthread_cond_init(&svc->done_cond, NULL);
+    pthread_cond_init(&svc->drain_cond, NULL);
+
+    for (int i = 0; i < c.workers; i++) {
+        svc->w[i].svc = svc;
+        svc->w[i].id = i;
+        pthread_mutex_init(&svc->w[i].lock, NULL);
+        pthread_cond_init(&svc->w[i].cond, NULL);
+    }
+
+    for (int i = 0; i < c.workers; i++) {
+        async_worker_t* w = &svc->w[i];
+        if (pthread_create(&w->tid, NULL, async_worker, w) != 0) {
+            async_shutdown(svc, c.workers);
+            return NULL;
+        }
+        w->started = 1;
+        if (c.pin) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(i % ncpu, &set);
+            pthread_setaffinity_np(w->tid, sizeof(set), &set); /* 실패해도 고정 없이 계속 */
+        }
+    }
+    return svc;
+}
+
+void AES256_AsyncDrain(AES256_ASYNC* svc) {
+    if (svc == NULL) return;
+    pthread_mutex_lock(&svc->lock);
+    while (svc->inflight > 0) pthread_cond_wait(&svc->drain_cond, &svc->lock);
+    pthread_mutex_unlock(&svc->lock);
+}
+
+void AES256_AsyncDestroy(AES256_ASYNC* svc) {
+    if (svc == NULL) return;
+    pthread_mutex_lock(&svc->lock);
+    svc->closing = 1;
+    pthread_mutex_unlock(&svc->lock);
+
+    AES256_AsyncDrain(svc);
+    async_shutdown(svc, svc->nworkers);
+}
+
+/* ---------------- 제출과 완료 대기 ---------------- */
+
+static int async_check(const AES256_ASYNC_JOB* job) {
+    if (job->RoundKey == NULL || (job->buf == NULL && job->len > 0)) return -1;
+    switch (job->op) {
+    case AES256_ASYNC_CBC_ENCRYPT:
+    case AES256_ASYNC_CBC_DECRYPT:
+        if (job->buf == NULL) return -1;
+        return (job->len == 0 || job->len % 16 != 0) ? -2 : 0;
+    case AES256_ASYNC_CTR:
+        return 0;
+    default:
+        return -1;
+    }
+}
+
+/**
+ * @brief 제출한 스레드가 실행 중인 CPU의 워커 대기열 번호
+ */
+static int async_home_queue(AES256_ASYNC* svc) {
+    int cpu = sched_getcpu();
+    if (cpu >= 0) return cpu % svc->nworkers;
+
+    pthread_mutex_lock(&svc->lock);
+    int q = (int)(svc->next_queue++ % (unsigned)svc->nworkers);
+    pthread_mutex_unlock(&svc->lock);
+    return q;
+}
+
+/**
+ * @brief 큰 작업을 split_bytes 단위 조각으로 나눔
+ * @details CBC 복호화 조각의 체이닝 값(직전 조각의 마지막 암호문 블록)은 다른 조각이
+ *          제자리 복호화로 덮어쓰기 전에, 즉 대기열에 넣기 전에 모두 복사해 둠
+ * @return 조각 수 (메모리 부족이면 0)
+ */
+static size_t async_split(AES256_ASYNC* svc, AES256_ASYNC_JOB* job) {
+    size_t n = (job->len + svc->split_bytes - 1) / svc->split_bytes;
+    job->pieces = (AES256_ASYNC_TASK*)calloc(n, sizeof(AES256_ASYNC_TASK));
+    if (job->pieces == NULL) return 0;
+
+    for (size_t i = 0; i < n; i++) {
+        AES256_ASYNC_TASK* t = &job->pieces[i];
+        t->job = job;
+        t->off = i * svc->split_bytes;
+        t->len = (job->len - t->off < svc->split_bytes) ? job->len - t->off : svc->split_bytes;
+        if (job->op == AES256_ASYNC_CBC_DECRYPT) {
+            memcpy(t->iv, (i == 0) ? job->iv : job->buf + t->off - 16, 16);
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief 작업을 대기열에 넣음 (즉시 반환)
+ * @return 성공 시 0, 인자 오류 -1, 길이 오류 -2, 종료 중/메모리 부족 -4
+ *         (실패하면 작업은 제출되지 않으며 콜백도 호출되지 않음)
+ */
+int AES256_AsyncSubmit(AES256_ASYNC* svc, AES256_ASYNC_JOB* job) {
+    if (svc == NULL || job == NULL) return -1;
+    int rc = async_check(job);
+    if (rc != 0) return rc;
+
+    job->svc = svc;
+    job->result = 0;
+    job->queue_ns = 0;
+    job->latency_ns = 0;
+    job->done = 0;
+    job->pieces = NULL;
+    job->start_ns = UINT64_MAX;
+
+    /* CBC 암호화는 직렬이라 나누지 않음 */
+    size_t npieces = 0;
+    if (job->op != AES256_ASYNC_CBC_ENCRYPT && job->len > svc->split_bytes && svc->nworkers > 1) {
+        npieces = async_split(svc, job);
+        if (npieces == 0) return -4;
+    }
+    if (npieces == 0) {
+        job->task = (AES256_ASYNC_TASK){ .job = job, .off = 0, .len = job->len };
+        memcpy(job->task.iv, job->iv, 16);
+    }
+    job->pending = (npieces > 0) ? npieces : 1;
+
+    pthread_mutex_lock(&svc->lock);
+    if (svc->closing) {
+        pthread_mutex_unlock(&svc->lock);
+        free(job->pieces);
+        job->pieces = NULL;
+        return -4;
+    }
+    svc->inflight++;
+    svc->submitted++;
+    if (npieces > 0) svc->split_jobs++;
+    pthread_mutex_unlock(&svc->lock);
+
+    int home = async_home_queue(svc);
+    job->submit_ns = async_now_ns();
+    if (npieces == 0) {
+        async_push(svc, home, &job->task);
+    } else {
+        for (size_t i = 0; i < npieces; i++) {
+            async_push(svc, (int)((home + i) % (size_t)svc->nworkers), &job->pieces[i]);
+        }
+    }
+    return 0;
+}
+
+int AES256_AsyncWait(AES256_ASYNC_JOB* job) {
+    if (job == NULL || job->svc == NULL || job->callback != NULL) return -1;
+    AES256_ASYNC* svc = job->svc;
+
+    pthread_mutex_lock(&svc->lock);
+    svc->waiters++;
+    while (!job->done) pthread_cond_wait(&svc->done_cond, &svc->lock);
+    svc->waiters--;
+    pthread_mutex_unlock(&svc->lock);
+    return job->result;
+}
+
+int AES256_AsyncPoll(AES256_ASYNC_JOB* job) {
+    if (job == NULL || job->svc == NULL || job->callback != NULL) return 0;
+    AES256_ASYNC* svc = job->svc;
+
+    pthread_mutex_lock(&svc->lock);
+    int done = job->done;
+    pthread_mutex_unlock(&svc->lock);
+    return done;
+}
+
+/**
+ * @brief 서비스 통계를 모음 (워커 대기열 통계는 워커마다 잠그고 읽어 합산)
+ */
+void AES256_AsyncStats(AES256_ASYNC* svc, AES256_ASYNC_STATS* stats) {
+    if (svc == NULL || stats == NULL) return;
+    memset(stats, 0, sizeof(*stats));
+    stats->workers = svc->nworkers;
+
+    for (int i = 0; i < svc->nworkers; i++) {
+        async_worker_t* w = &svc->w[i];
+        pthread_mutex_lock(&w->lock);
+        stats->tasks += w->tasks;
+        stats->batches += w->batches;
+        stats->steals += w->steals;
+        stats->queue_depth += w->depth;
+        if (w->max_batch > stats->max_batch) stats->max_batch = w->max_batch;
+        if (w->max_depth > stats->max_queue_depth) stats->max_queue_depth = w->max_depth;
+        pthread_mutex_unlock(&w->lock);
+    }
+
+    pthread_mutex_lock(&svc->lock);
+    stats->submitted = svc->submitted;
+    stats->completed = svc->completed;
+    stats->failed = svc->failed;
+    stats->split_jobs = svc->split_jobs;
+    stats->latency_total_ns = svc->latency_total_ns;
+    stats->latency_max_ns = svc->latency_max_ns;
+    memcpy(stats->latency_hist, svc->latency_hist, sizeof(stats->latency_hist));
+    pthread_mutex_unlock(&svc->lock);
+}
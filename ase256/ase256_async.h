@@ -0,0 +1,119 @@
+/*
+ * ase256_async.h
+ * - ase256 위에서 동작하는 비동기 암복호화 서비스 (고정 워커 풀 + 워커별 작업 대기열)
+ *
+ * 동작 방식:
+ * - 워커 스레드마다 대기열이 하나씩 있으며, 작업은 제출한 스레드가 실행 중인 CPU에 해당하는
+ *   워커의 대기열에 들어갑니다. 대기열이 빈 워커는 다른 워커의 대기열에서 작업을 가져옵니다.
+ * - 워커는 대기열에서 작은 작업을 최대 batch_max개씩 한 번에 꺼내 처리하며, 같은 묶음의
+ *   CBC 암호화 작업은 AES256_CBC_Encrypt_Multi로 블록 단위 교차 처리합니다.
+ * - split_bytes보다 큰 CBC 복호화/CTR 작업은 split_bytes 단위 조각으로 나누어 여러 워커가
+ *   동시에 처리합니다 (CBC 암호화는 블록끼리 직렬이라 나누지 않음).
+ *   따라서 큰 작업 뒤에 들어온 작은 작업이 큰 작업 전체를 기다리지 않습니다.
+ *
+ * 완료 통지:
+ * - callback이 있으면 워커 스레드에서 호출하며, 호출 후에는 라이브러리가 job을 건드리지 않습니다.
+ *   (콜백 안에서 job을 해제하거나 다시 제출해도 되지만 AES256_AsyncWait/Poll은 쓰면 안 됨)
+ * - callback이 NULL이면 AES256_AsyncWait(블록) 또는 AES256_AsyncPoll(확인만)로 완료를 기다립니다.
+ * - 완료 전까지 job, buf, RoundKey를 유지해야 합니다.
+ *
+ * 반환값: 0 성공, -1 인자 오류, -2 길이 오류, -4 서비스 종료 중이거나 자원 부족
+ */
+
+#ifndef ASE256_ASYNC_H
+#define ASE256_ASYNC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define AES256_ASYNC_MAX_WORKERS   64
+#define AES256_ASYNC_MAX_BATCH     64
+#define AES256_ASYNC_DEFAULT_BATCH 32
+#define AES256_ASYNC_DEFAULT_SPLIT (256 * 1024)
+#define AES256_ASYNC_LAT_BUCKETS   24
+
+typedef enum {
+    AES256_ASYNC_CBC_ENCRYPT = 0,
+    AES256_ASYNC_CBC_DECRYPT,
+    AES256_ASYNC_CTR,          /* offset 0부터의 CTR (암복호화 동일) */
+} aes256_async_op_t;
+
+typedef struct AES256_ASYNC AES256_ASYNC;
+typedef struct AES256_ASYNC_JOB AES256_ASYNC_JOB;
+typedef void (*AES256_ASYNC_CALLBACK)(AES256_ASYNC_JOB* job, void* arg);
+
+/* 대기열 항목: 나누지 않은 작업은 job 안의 task 하나, 나눈 작업은 조각마다 하나 (라이브러리 전용) */
+typedef struct AES256_ASYNC_TASK {
+    struct AES256_ASYNC_JOB* job;
+    struct AES256_ASYNC_TASK* next;
+    size_t off;
+    size_t len;
+    uint8_t iv[16];                         /* CBC 복호화 조각의 체이닝 값 */
+} AES256_ASYNC_TASK;
+
+struct AES256_ASYNC_JOB {
+    /* 입력 (제출 전에 채움) */
+    aes256_async_op_t op;
+    uint8_t* buf;                           /* 제자리 처리 */
+    size_t len;                             /* CBC는 16의 배수 */
+    const uint8_t* RoundKey;                /* KeyExpansion 결과 */
+    uint8_t iv[16];                         /* CBC IV 또는 CTR 초기 카운터 블록 */
+    AES256_ASYNC_CALLBACK callback;         /* NULL이면 Wait/Poll로 완료 확인 */
+    void* arg;
+
+    /* 결과 (완료 후 유효) */
+    int result;                             /* 0 성공, 음수 실패 */
+    uint64_t queue_ns;                      /* 제출부터 처리 시작까지 */
+    uint64_t latency_ns;                    /* 제출부터 완료까지 */
+
+    /* 내부 상태 (라이브러리 전용) */
+    AES256_ASYNC* svc;
+    AES256_ASYNC_TASK task;
+    AES256_ASYNC_TASK* pieces;
+    size_t pending;
+    uint64_t submit_ns;
+    uint64_t start_ns;
+    int done;
+};
+
+/* 서비스 설정 (0인 항목은 기본값 사용) */
+typedef struct {
+    int workers;            /* 워커 수 (기본: CPU 수, 최대 64) */
+    size_t batch_max;       /* 대기열에서 한 번에 꺼낼 최대 작업 수 (기본 32, 최대 64) */
+    size_t split_bytes;     /* 이보다 큰 작업을 나눌 조각 크기, 16의 배수로 내림 (기본 256KB) */
+    int pin;                /* 1이면 워커 i를 CPU (i % CPU 수)에 고정 */
+} AES256_ASYNC_CONFIG;
+
+/* 관측용 통계 (AES256_AsyncStats 호출 시점의 값) */
+typedef struct {
+    int workers;
+    uint64_t submitted;
+    uint64_t completed;
+    uint64_t failed;
+    uint64_t split_jobs;                    /* 조각으로 나눈 작업 수 */
+    uint64_t tasks;                         /* 처리한 대기열 항목 수 (조각 포함) */
+    uint64_t batches;                       /* 대기열에서 꺼낸 묶음 수 (tasks / batches = 평균 묶음 크기) */
+    uint64_t max_batch;
+    uint64_t steals;                        /* 다른 워커의 대기열에서 가져온 묶음 수 */
+    uint64_t queue_depth;                   /* 현재 대기 중인 항목 수 (모든 워커 합) */
+    uint64_t max_queue_depth;               /* 워커 대기열 하나의 최대 깊이 */
+    uint64_t latency_total_ns;              /* 완료된 작업의 지연 시간 합 (제출부터 완료까지) */
+    uint64_t latency_max_ns;
+    uint64_t latency_hist[AES256_ASYNC_LAT_BUCKETS]; /* 0: 1µs 미만, i: 2^(i-1)µs 이상 2^i µs 미만 (마지막은 그 이상 전부) */
+} AES256_ASYNC_STATS;
+
+/* cfg가 NULL이면 모두 기본값, 실패 시 NULL */
+AES256_ASYNC* AES256_AsyncCreate(const AES256_ASYNC_CONFIG* cfg);
+/* 새 제출을 막고 남은 작업을 모두 처리한 뒤 워커를 종료함 */
+void AES256_AsyncDestroy(AES256_ASYNC* svc);
+
+int AES256_AsyncSubmit(AES256_ASYNC* svc, AES256_ASYNC_JOB* job);
+/* 완료될 때까지 기다려 job->result를 반환 (callback이 없는 작업만) */
+int AES256_AsyncWait(AES256_ASYNC_JOB* job);
+/* 완료되었으면 1, 아니면 0 (callback이 없는 작업만) */
+int AES256_AsyncPoll(AES256_ASYNC_JOB* job);
+/* 지금까지 제출된 작업이 모두 완료될 때까지 기다림 */
+void AES256_AsyncDrain(AES256_ASYNC* svc);
+void AES256_AsyncStats(AES256_ASYNC* svc, AES256_ASYNC_STATS* stats);
+
+#endif // ASE256_ASYNC_H
@@ -0,0 +1,359 @@
+/*
+ * ase256_cli.c
+ * - 청크 단위 암호화 컨테이너(ase256_file.h) 명령행 도구
+ *
+ * 사용 방법:
+ *   ase256_cli enc  [-c 청크크기] [-t 스레드수] 키파일 평문파일 출력파일
+ *   ase256_cli dec  [-t 스레드수] 키파일 컨테이너 출력파일
+ *   ase256_cli penc [-c 청크크기] [-t 스레드수] [-q 버퍼수] [-e 방식] [-D] [-v] 키파일 평문파일 출력파일
+ *   ase256_cli pdec [-t 스레드수] [-q 버퍼수] [-e 방식] [-D] [-v] 키파일 컨테이너 출력파일
+ *   ase256_cli read 키파일 컨테이너 오프셋 길이     (해당 구간만 복호화하여 표준 출력으로 씀)
+ *   ase256_cli info 컨테이너
+ *   ase256_cli tune [-f] [-a] [캐시파일]   (이 머신에 맞는 백엔드/교차 폭/스레드 수를 측정해 캐시에 저장)
+ *
+ * - 키파일: 32바이트 바이너리 또는 16진수 64글자 (끝의 줄바꿈 허용)
+ * - 청크크기: 바이트 단위, K/M 접미사 허용 (기본 1M)
+ * - penc/pdec: 메모리보다 큰 파일용. 읽기/암복호화/쓰기를 겹쳐 진행하며 결과 형식은 enc/dec와 같음
+ *   -q 돌려 쓸 버퍼 수, -e auto|uring|threads 입출력 방식, -D 평문 쪽 O_DIRECT, -v 처리 속도와 병목 정보 출력
+ * - tune: -f 캐시를 무시하고 다시 측정, -a T-table/참조 구현도 후보에 넣음. ASE256_AUTOTUNE=1로 실행하면
+ *   모든 명령이 시작할 때 캐시된 설정을 적용함
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include "ase256.h"
+#include "ase256_file.h"
+#include "ase256_tune.h"
+
+static void usage(void) {
+    fprintf(stderr,
+            "사용법:\n"
+            "  ase256_cli enc  [-c 청크크기] [-t 스레드수] 키파일 평문파일 출력파일\n"
+            "  ase256_cli dec  [-t 스레드수] 키파일 컨테이너 출력파일\n"
+            "  ase256_cli penc [-c 청크크기] [-t 스레드수] [-q 버퍼수] [-e auto|uring|threads] [-D] [-v]\n"
+            "                  키파일 평문파일 출력파일\n"
+            "  ase256_cli pdec [-t 스레드수] [-q 버퍼수] [-e auto|uring|threads] [-D] [-v] 키파일 컨테이너 출력파일\n"
+            "  ase256_cli read 키파일 컨테이너 오프셋 길이\n"
+            "  ase256_cli info 컨테이너\n"
+            "  ase256_cli tune [-f] [-a] [캐시파일]\n");
+}
+
+static const char* error_text(int rc) {
+    switch (rc) {
+    case -1: return "잘못된 인자";
+    case -2: return "컨테이너 형식 오류";
+    case -3: return "인증 실패 (키가 다르거나 파일이 변조됨)";
+    case -4: return "파일 입출력 오류";
+    default: return "알 수 없는 오류";
+    }
+}
+
+/**
+ * @brief 키가 남지 않도록 컴파일러가 생략하지 못하는 방식으로 지움
+ */
+static void wipe(void* p, size_t len) {
+    volatile uint8_t* vp = (volatile uint8_t*)p;
+    while (len--) *vp++ = 0;
+}
+
+static int hex_value(int c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    c = tolower(c);
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+/**
+ * @brief 키 파일을 읽음 (32바이트 바이너리 또는 16진수 64글자)
+ * @return 성공 시 0, 실패 시 -1
+ */
+static int load_key(const char* path, uint8_t key[32]) {
+    uint8_t raw[130];
+    FILE* fp = fopen(path, "rb");
+    if (fp == NULL) return -1;
+    size_t n = fread(raw, 1, sizeof(raw), fp);
+    fclose(fp);
+
+    int ret = -1;
+    while (n > 0 && (raw[n - 1] == '\n' || raw[n - 1] == '\r')) n--;
+    if (n == 32) {
+        memcpy(key, raw, 32);
+        ret = 0;
+    } else if (n == 64) {
+        ret = 0;
+        for (int i = 0; i < 32; i++) {
+            int hi = hex_value(raw[i * 2]), lo = hex_value(raw[i * 2 + 1]);
+            if (hi < 0 || lo < 0) {
+                ret = -1;
+                break;
+            }
+            key[i] = (uint8_t)(hi << 4 | lo);
+        }
+    }
+
+    wipe(raw, sizeof(raw));
+    return ret;
+}
+
+/**
+ * @brief "64K", "4M" 같은 크기 문자열을 바이트 수로 변환함
+ * @return 성공 시 0, 실패 시 -1
+ */
+static int parse_size(const char* s, unsigned long long* out) {
+    char* end;
+    unsigned long long v = strtoull(s, &end, 10);
+    if (end == s) return -1;
+    if (*end == 'K' || *end == 'k') { v *= 1024ULL; end++; }
+    else if (*end == 'M' || *end == 'm') { v *= 1024ULL * 1024ULL; end++; }
+    if (*end != '\0') return -1;
+    *out = v;
+    return 0;
+}
+
+static int cmd_info(const char* path) {
+    AES256_FILE_INFO info;
+    int rc = AES256_FileInfo(path, &info);
+    if (rc != 0) {
+        fprintf(stderr, "%s: %s\n", path, error_text(rc));
+        return 1;
+    }
+    printf("평문 크기  : %llu 바이트\n", (unsigned long long)info.plain_size);
+    printf("청크 크기  : %u 바이트\n", info.chunk_size);
+    printf("청크 수    : %llu\n", (unsigned long long)info.chunk_count);
+    printf("인덱스 위치: %llu\n", (unsigned long long)info.index_offset);
+    printf("파일 ID    : ");
+    for (int i = 0; i < 8; i++) printf("%02x", info.file_id[i]);
+    printf("\n");
+    return 0;
+}
+
+static int cmd_read(const uint8_t* key, const char* path, const char* off_s, const char* len_s) {
+    unsigned long long offset, len;
+    if (parse_size(off_s, &offset) != 0 || parse_size(len_s, &len) != 0) {
+        usage();
+        return 1;
+    }
+
+    int rc;
+    AES256_FILE_READER* r = AES256_FileOpen(path, key, &rc);
+    if (r == NULL) {
+        fprintf(stderr, "%s: %s\n", path, error_text(rc));
+        return 1;
+    }
+
+    /* 요청 구간을 64KB씩 나누어 읽어 메모리 사용량을 일정하게 유지 */
+    static uint8_t buf[64 * 1024];
+    int status = 0;
+    while (len > 0) {
+        size_t want = (len < sizeof(buf)) ? (size_t)len : sizeof(buf);
+        long long got = AES256_FileRead(r, offset, buf, want);
+        if (got < 0) {
+            fprintf(stderr, "%s: %s\n", path, error_text((int)got));
+            status = 1;
+            break;
+        }
+        if (got == 0) break;
+        fwrite(buf, 1, (size_t)got, stdout);
+        offset += (unsigned long long)got;
+        len -= (unsigned long long)got;
+    }
+
+    wipe(buf, sizeof(buf));
+    AES256_FileClose(r);
+    return status;
+}
+
+static int parse_io(const char* s, aes256_file_io_t* io) {
+    if (strcmp(s, "auto") == 0) *io = AES256_FILE_IO_AUTO;
+    else if (strcmp(s, "uring") == 0) *io = AES256_FILE_IO_URING;
+    else if (strcmp(s, "threads") == 0) *io = AES256_FILE_IO_THREADS;
+    else return -1;
+    return 0;
+}
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief penc/pdec: 파이프라인 변환을 실행하고, verbose이면 처리 속도와 대기 횟수를 표준 오류로 출력함
+ */
+static int cmd_pipe(int encrypt, const uint8_t* key, const char* in, const char* out,
+                    const AES256_FILE_PIPE_CONFIG* cfg, int verbose) {
+    AES256_FILE_PIPE_STATS st;
+    double t0 = now_sec();
+    int rc = encrypt ? AES256_FileEncryptPipe(in, out, key, cfg, &st)
+                     : AES256_FileDecryptPipe(in, out, key, cfg, &st);
+    double sec = now_sec() - t0;
+    if (rc != 0) {
+        fprintf(stderr, "%s: %s\n", in, error_text(rc));
+        return 1;
+    }
+
+    if (verbose) {
+        AES256_FILE_INFO info;
+        uint64_t bytes = (AES256_FileInfo(encrypt ? out : in, &info) == 0) ? info.plain_size : 0;
+        fprintf(stderr, "%s: %llu 바이트, %.3f초 (%.1f MB/s)\n", encrypt ? "암호화" : "복호화",
+                (unsigned long long)bytes, sec, sec > 0 ? (double)bytes / sec / 1e6 : 0.0);
+        fprintf(stderr, "입출력 %s, O_DIRECT %s, 버퍼 %d개, 워커 %d개\n",
+                st.io == AES256_FILE_IO_URING ? "io_uring" : "스레드", st.direct ? "사용" : "안 씀",
+                st.depth, st.nthreads);
+        fprintf(stderr, "빈 버퍼 대기 %llu회, 워커의 읽기 대기 %llu회\n",
+                (unsigned long long)st.buffer_waits, (unsigned long long)st.crypto_waits);
+    }
+    return 0;
+}
+
+/**
+ * @brief tune: 자동 조정을 실행하고 적용된 설정을 출력함
+ */
+static int cmd_tune(int argc, char* argv[]) {
+    int flags = 0;
+    const char* path = NULL;
+
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "-f") == 0) {
+            flags |= AES256_TUNE_FORCE;
+        } else if (strcmp(argv[i], "-a") == 0) {
+            flags |= AES256_TUNE_ALLOW_TABLES;
+        } else if (argv[i][0] != '-' && path == NULL) {
+            path = argv[i];
+        } else {
+            usage();
+            return 1;
+        }
+    }
+
+    AES256_TUNE t;
+    int rc = AES256_Autotune(path, flags, &t);
+    if (rc == -1) {
+        usage();
+        return 1;
+    }
+    printf("백엔드     : %s\n", AES256_ImplName(t.impl));
+    printf("교차 폭    : %d블록\n", t.interleave);
+    printf("스레드 수  : %d\n", t.threads);
+    printf("분할 크기  : %zu바이트\n", t.split_bytes);
+    printf("처리량     : %.0f MB/s (단일 스레드, CTR + CBC 복호화)\n", t.mbps);
+    if (t.from_cache) {
+        printf("출처       : 캐시 파일\n");
+    } else {
+        printf("출처       : 측정 (%.1f ms)\n", t.tune_ms);
+    }
+    if (rc != 0) {
+        fprintf(stderr, "캐시 파일을 쓰지 못했습니다 (설정은 이 프로세스에만 적용됨)\n");
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        usage();
+        return 1;
+    }
+
+    const char* cmd = argv[1];
+    unsigned long long chunk = 0;
+    int nthreads = 0;
+    int i = 2;
+
+    if (strcmp(cmd, "info") == 0) {
+        if (argc != 3) {
+            usage();
+            return 1;
+        }
+        return cmd_info(argv[2]);
+    }
+    if (strcmp(cmd, "tune") == 0) return cmd_tune(argc, argv);
+
+    /* 옵션 (-c, -t, -q, -e는 값을 받고 -D, -v는 단독) */
+    AES256_FILE_PIPE_CONFIG pcfg = {0};
+    int verbose = 0;
+    while (i < argc && argv[i][0] == '-') {
+        if (strcmp(argv[i], "-D") == 0) {
+            pcfg.direct = 1;
+            i++;
+            continue;
+        }
+        if (strcmp(argv[i], "-v") == 0) {
+            verbose = 1;
+            i++;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            usage();
+            return 1;
+        }
+        if (strcmp(argv[i], "-e") == 0) {
+            if (parse_io(argv[i + 1], &pcfg.io) != 0) {
+                usage();
+                return 1;
+            }
+            i += 2;
+            continue;
+        }
+
+        unsigned long long v;
+        if (parse_size(argv[i + 1], &v) != 0) {
+            usage();
+            return 1;
+        }
+        if (strcmp(argv[i], "-c") == 0) {
+            chunk = v;
+        } else if (strcmp(argv[i], "-t") == 0) {
+            nthreads = (int)v;
+        } else if (strcmp(argv[i], "-q") == 0) {
+            pcfg.depth = (v > 1024) ? 1024 : (int)v;
+        } else {
+            usage();
+            return 1;
+        }
+        i += 2;
+    }
+
+    if (argc - i < 3) {
+        usage();
+        return 1;
+    }
+
+    uint8_t key[32];
+    if (load_key(argv[i], key) != 0) {
+        fprintf(stderr, "%s: 키 파일은 32바이트 바이너리 또는 16진수 64글자여야 합니다\n", argv[i]);
+        return 1;
+    }
+
+    int rc, status = 0;
+    if (strcmp(cmd, "enc") == 0 && argc - i == 3) {
+        if (chunk > AES256_FILE_MAX_CHUNK) chunk = 0xffffffffULL; /* 범위 검사는 라이브러리가 함 */
+        rc = AES256_FileEncrypt(argv[i + 1], argv[i + 2], key, (uint32_t)chunk, nthreads);
+        if (rc != 0) {
+            fprintf(stderr, "%s: %s\n", argv[i + 1], error_text(rc));
+            status = 1;
+        }
+    } else if (strcmp(cmd, "dec") == 0 && argc - i == 3) {
+        rc = AES256_FileDecrypt(argv[i + 1], argv[i + 2], key, nthreads);
+        if (rc != 0) {
+            fprintf(stderr, "%s: %s\n", argv[i + 1], error_text(rc));
+            status = 1;
+        }
+    } else if ((strcmp(cmd, "penc") == 0 || strcmp(cmd, "pdec") == 0) && argc - i == 3) {
+        if (chunk > AES256_FILE_MAX_CHUNK) chunk = 0xffffffffULL;
+        pcfg.chunk_size = (uint32_t)chunk;
+        pcfg.nthreads = nthreads;
+        status = cmd_pipe(cmd[1] == 'e', key, argv[i + 1], argv[i + 2], &pcfg, verbose);
+    } else if (strcmp(cmd, "read") == 0 && argc - i == 4) {
+        status = cmd_read(key, argv[i + 1], argv[i + 2], argv[i + 3]);
+    } else {
+        usage();
+        status = 1;
+    }
+
+    wipe(key, sizeof(key));
+    return status;
+}
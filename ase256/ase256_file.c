@@ -0,0 +1,1320 @@
+/*
+ * ase256_file.c
+ * - 청크 단위 AES-256-GCM 컨테이너 파일의 생성/복호화/임의 위치 읽기 (형식은 ase256_file.h 참고)
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE /* O_DIRECT */
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/random.h>
+#include <sys/syscall.h>
+#include <sys/eventfd.h>
+#include <linux/io_uring.h>
+#include "ase256.h"
+#include "ase256_file.h"
+
+#define FILE_MAGIC       "ASE256CF"
+#define FILE_VERSION     1
+#define FILE_CIPHER_GCM  1
+#define FILE_MAX_THREADS 64
+
+/* ---------------- 공통 보조 함수 ---------------- */
+
+static void file_put_be32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24); p[1] = (uint8_t)(v >> 16); p[2] = (uint8_t)(v >> 8); p[3] = (uint8_t)v;
+}
+
+static void file_put_be64(uint8_t* p, uint64_t v) {
+    file_put_be32(p, (uint32_t)(v >> 32));
+    file_put_be32(p + 4, (uint32_t)v);
+}
+
+static uint32_t file_get_be32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static uint64_t file_get_be64(const uint8_t* p) {
+    return ((uint64_t)file_get_be32(p) << 32) | file_get_be32(p + 4);
+}
+
+/**
+ * @brief 컴파일러가 생략하지 못하는 메모리 소거 (키/평문 잔여물 제거용)
+ */
+static void file_wipe(void* p, size_t len) {
+    volatile uint8_t* vp = (volatile uint8_t*)p;
+    while (len--) *vp++ = 0;
+}
+
+static int file_default_threads(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n < 1) return 1;
+    return (n > FILE_MAX_THREADS) ? FILE_MAX_THREADS : (int)n;
+}
+
+/**
+ * @brief 청크 i의 GCM nonce = 파일 ID(8바이트) || 청크 번호(32비트 빅엔디언)
+ */
+static void file_chunk_nonce(uint8_t nonce[12], const uint8_t file_id[8], uint64_t chunk) {
+    memcpy(nonce, file_id, 8);
+    file_put_be32(nonce + 8, (uint32_t)chunk);
+}
+
+/* ---------------- 헤더 ---------------- */
+
+static void file_build_header(uint8_t* hdr, const AES256_FILE_INFO* info) {
+    memset(hdr, 0, AES256_FILE_HEADER_SIZE);
+    memcpy(hdr, FILE_MAGIC, 8);
+    hdr[8] = 0; hdr[9] = FILE_VERSION;
+    hdr[10] = 0; hdr[11] = AES256_FILE_HEADER_SIZE;
+    file_put_be32(hdr + 12, FILE_CIPHER_GCM);
+    file_put_be32(hdr + 16, info->chunk_size);
+    file_put_be64(hdr + 24, info->plain_size);
+    file_put_be64(hdr + 32, info->chunk_count);
+    file_put_be64(hdr + 40, info->index_offset);
+    memcpy(hdr + 48, info->file_id, 8);
+}
+
+/**
+ * @brief 헤더를 해석하고 파일 크기와의 일관성을 검증함
+ * @return 성공 시 0, 형식 오류 시 -2
+ */
+static int file_parse_header(const uint8_t* hdr, uint64_t file_size, AES256_FILE_INFO* info) {
+    if (file_size < AES256_FILE_HEADER_SIZE) return -2;
+    if (memcmp(hdr, FILE_MAGIC, 8) != 0) return -2;
+    if (hdr[8] != 0 || hdr[9] != FILE_VERSION) return -2;
+    if (hdr[10] != 0 || hdr[11] != AES256_FILE_HEADER_SIZE) return -2;
+    if (file_get_be32(hdr + 12) != FILE_CIPHER_GCM) return -2;
+
+    info->chunk_size = file_get_be32(hdr + 16);
+    info->plain_size = file_get_be64(hdr + 24);
+    info->chunk_count = file_get_be64(hdr + 32);
+    info->index_offset = file_get_be64(hdr + 40);
+    memcpy(info->file_id, hdr + 48, 8);
+
+    if (info->chunk_size < AES256_FILE_MIN_CHUNK || info->chunk_size > AES256_FILE_MAX_CHUNK) return -2;
+    if (info->plain_size > UINT64_MAX - AES256_FILE_HEADER_SIZE) return -2;
+    if (info->chunk_count != (info->plain_size + info->chunk_size - 1) / info->chunk_size) return -2;
+    if (info->chunk_count > UINT32_MAX) return -2;
+    if (info->index_offset != AES256_FILE_HEADER_SIZE + info->plain_size) return -2;
+    if ((file_size - info->index_offset) / AES256_FILE_INDEX_ENTRY != info->chunk_count ||
+        (file_size - info->index_offset) % AES256_FILE_INDEX_ENTRY != 0) return -2;
+    return 0;
+}
+
+/**
+ * @brief 인덱스 항목이 헤더에서 계산한 청크 위치/길이와 일치하는지 확인함
+ */
+static int file_check_index(const uint8_t* entry, const AES256_FILE_INFO* info, uint64_t chunk) {
+    uint64_t start = chunk * info->chunk_size;
+    uint64_t remain = info->plain_size - start;
+    uint32_t len = (remain < info->chunk_size) ? (uint32_t)remain : info->chunk_size;
+
+    if (file_get_be64(entry) != AES256_FILE_HEADER_SIZE + start) return -2;
+    if (file_get_be32(entry + 8) != len) return -2;
+    return 0;
+}
+
+/* ---------------- mmap 보조 ---------------- */
+
+typedef struct {
+    int fd;
+    uint8_t* map;
+    uint64_t size;
+} file_map_t;
+
+static int file_map_read(const char* path, file_map_t* m) {
+    struct stat st;
+
+    m->map = NULL;
+    m->fd = open(path, O_RDONLY);
+    if (m->fd < 0) return -4;
+    if (fstat(m->fd, &st) != 0) {
+        close(m->fd);
+        m->fd = -1;
+        return -4;
+    }
+
+    m->size = (uint64_t)st.st_size;
+    if (m->size > 0) {
+        void* p = mmap(NULL, (size_t)m->size, PROT_READ, MAP_SHARED, m->fd, 0);
+        if (p == MAP_FAILED) {
+            close(m->fd);
+            m->fd = -1;
+            return -4;
+        }
+        m->map = (uint8_t*)p;
+    }
+    return 0;
+}
+
+static int file_map_create(const char* path, uint64_t size, file_map_t* m) {
+    m->map = NULL;
+    m->size = size;
+    m->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (m->fd < 0) return -4;
+    if (ftruncate(m->fd, (off_t)size) != 0) {
+        close(m->fd);
+        m->fd = -1;
+        return -4;
+    }
+
+    if (size > 0) {
+        void* p = mmap(NULL, (size_t)size, PROT_READ | PROT_WRITE, MAP_SHARED, m->fd, 0);
+        if (p == MAP_FAILED) {
+            close(m->fd);
+            m->fd = -1;
+            return -4;
+        }
+        m->map = (uint8_t*)p;
+    }
+    return 0;
+}
+
+static void file_unmap(file_map_t* m) {
+    if (m->map != NULL) munmap(m->map, (size_t)m->size);
+    if (m->fd >= 0) close(m->fd);
+    m->map = NULL;
+    m->fd = -1;
+}
+
+/* ---------------- 청크 병렬 처리 ---------------- */
+
+typedef struct {
+    const uint8_t* RoundKey;
+    const AES256_FILE_INFO* info;
+    const uint8_t* header;     /* AAD로 사용할 헤더 64바이트 */
+    const uint8_t* src;        /* 입력 청크 데이터 시작 (평문 또는 암호문) */
+    uint8_t* dst;              /* 출력 청크 데이터 시작 */
+    uint8_t* index_out;        /* 암호화: 인덱스를 기록할 위치 */
+    const uint8_t* index_in;   /* 복호화: 읽을 인덱스 */
+    int encrypt;
+    int first, step;           /* 이 스레드가 맡는 청크: first, first + step, ... */
+    int result;
+} file_task_t;
+
+/**
+ * @brief 청크를 출력 위치로 복사한 뒤 제자리에서 GCM 암호화/복호화함
+ * @details 스레드 t는 청크 t, t + n, t + 2n ... 을 처리하여 청크 크기가 같을 때 부하가 고르게 나뉨
+ */
+static void* file_chunk_worker(void* arg) {
+    file_task_t* task = (file_task_t*)arg;
+    const AES256_FILE_INFO* info = task->info;
+    uint8_t nonce[12];
+
+    task->result = 0;
+    for (uint64_t c = (uint64_t)task->first; c < info->chunk_count; c += (uint64_t)task->step) {
+        uint64_t start = c * info->chunk_size;
+        uint64_t remain = info->plain_size - start;
+        size_t len = (remain < info->chunk_size) ? (size_t)remain : info->chunk_size;
+        uint8_t* out = task->dst + start;
+
+        memcpy(out, task->src + start, len);
+        file_chunk_nonce(nonce, info->file_id, c);
+
+        if (task->encrypt) {
+            uint8_t* entry = task->index_out + c * AES256_FILE_INDEX_ENTRY;
+            file_put_be64(entry, AES256_FILE_HEADER_SIZE + start);
+            file_put_be32(entry + 8, (uint32_t)len);
+            file_put_be32(entry + 12, 0);
+            AES256_GCM_Encrypt(out, len, task->header, AES256_FILE_HEADER_SIZE,
+                               task->RoundKey, nonce, sizeof(nonce), entry + 16);
+        } else {
+            const uint8_t* entry = task->index_in + c * AES256_FILE_INDEX_ENTRY;
+            int rc = file_check_index(entry, info, c);
+            if (rc == 0) {
+                rc = AES256_GCM_Decrypt(out, len, task->header, AES256_FILE_HEADER_SIZE,
+                                        task->RoundKey, nonce, sizeof(nonce), entry + 16);
+            }
+            if (rc != 0) {
+                task->result = rc;
+                break;
+            }
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief 청크를 nthreads개 스레드에 나누어 처리함 (스레드 생성 실패 시 호출 스레드가 대신 처리)
+ * @return 모든 청크 성공 시 0, 실패한 청크가 있으면 그 오류 코드
+ */
+static int file_run_chunks(file_task_t* proto, int nthreads) {
+    file_task_t tasks[FILE_MAX_THREADS];
+    pthread_t tids[FILE_MAX_THREADS];
+    int started[FILE_MAX_THREADS] = {0};
+    int ret = 0;
+
+    if (nthreads <= 0) nthreads = file_default_threads();
+    if (nthreads > FILE_MAX_THREADS) nthreads = FILE_MAX_THREADS;
+    if ((uint64_t)nthreads > proto->info->chunk_count) nthreads = (int)proto->info->chunk_count;
+    if (nthreads < 1) nthreads = 1;
+
+    for (int t = 0; t < nthreads; t++) {
+        tasks[t] = *proto;
+        tasks[t].first = t;
+        tasks[t].step = nthreads;
+    }
+    for (int t = 1; t < nthreads; t++) {
+        started[t] = (pthread_create(&tids[t], NULL, file_chunk_worker, &tasks[t]) == 0);
+    }
+    file_chunk_worker(&tasks[0]);
+    for (int t = 1; t < nthreads; t++) {
+        if (started[t]) {
+            pthread_join(tids[t], NULL);
+        } else {
+            file_chunk_worker(&tasks[t]);
+        }
+    }
+
+    for (int t = 0; t < nthreads; t++) {
+        if (tasks[t].result != 0 && ret == 0) ret = tasks[t].result;
+    }
+    return ret;
+}
+
+/* ---------------- 파일 전체 암호화/복호화 ---------------- */
+
+/**
+ * @brief 평문 파일을 청크 단위 컨테이너로 암호화함
+ * @param chunk_size 청크 크기 (0이면 1MB, 4KB~256MB)
+ * @param nthreads   사용할 스레드 수 (0이면 CPU 수)
+ * @return 성공 시 0, 실패 시 음수
+ */
+int AES256_FileEncrypt(const char* in_path, const char* out_path, const uint8_t* Key,
+                       uint32_t chunk_size, int nthreads) {
+    if (in_path == NULL || out_path == NULL || Key == NULL) return -1;
+    if (chunk_size == 0) chunk_size = AES256_FILE_DEFAULT_CHUNK;
+    if (chunk_size < AES256_FILE_MIN_CHUNK || chunk_size > AES256_FILE_MAX_CHUNK) return -1;
+
+    file_map_t in, out;
+    int rc = file_map_read(in_path, &in);
+    if (rc != 0) return rc;
+
+    AES256_FILE_INFO info;
+    info.chunk_size = chunk_size;
+    info.plain_size = in.size;
+    info.chunk_count = (in.size + chunk_size - 1) / chunk_size;
+    info.index_offset = AES256_FILE_HEADER_SIZE + in.size;
+    if (info.chunk_count > UINT32_MAX) {
+        file_unmap(&in);
+        return -1;
+    }
+    if (getrandom(info.file_id, sizeof(info.file_id), 0) != (ssize_t)sizeof(info.file_id)) {
+        file_unmap(&in);
+        return -4;
+    }
+
+    uint64_t total = info.index_offset + info.chunk_count * AES256_FILE_INDEX_ENTRY;
+    rc = file_map_create(out_path, total, &out);
+    if (rc != 0) {
+        file_unmap(&in);
+        return rc;
+    }
+
+    uint8_t RoundKey[AES256_ROUNDKEY_SIZE];
+    KeyExpansion(RoundKey, Key);
+    file_build_header(out.map, &info);
+
+    file_task_t proto = {
+        .RoundKey = RoundKey, .info = &info, .header = out.map,
+        .src = in.map, .dst = out.map + AES256_FILE_HEADER_SIZE,
+        .index_out = out.map + info.index_offset, .encrypt = 1,
+    };
+    if (info.chunk_count > 0) rc = file_run_chunks(&proto, nthreads);
+
+    file_wipe(RoundKey, sizeof(RoundKey));
+    file_unmap(&in);
+    file_unmap(&out);
+    if (rc != 0) unlink(out_path);
+    return rc;
+}
+
+/**
+ * @brief 컨테이너 파일 전체를 복호화하여 평문 파일로 저장함
+ * @details 하나라도 인증에 실패하면 복호화된 내용을 믿을 수 없으므로 출력 파일을 지움
+ * @return 성공 시 0, 실패 시 음수 (-3: 변조 감지)
+ */
+int AES256_FileDecrypt(const char* in_path, const char* out_path, const uint8_t* Key, int nthreads) {
+    if (in_path == NULL || out_path == NULL || Key == NULL) return -1;
+
+    file_map_t in, out;
+    int rc = file_map_read(in_path, &in);
+    if (rc != 0) return rc;
+
+    AES256_FILE_INFO info;
+    rc = (in.map != NULL) ? file_parse_header(in.map, in.size, &info) : -2;
+    if (rc != 0) {
+        file_unmap(&in);
+        return rc;
+    }
+
+    rc = file_map_create(out_path, info.plain_size, &out);
+    if (rc != 0) {
+        file_unmap(&in);
+        return rc;
+    }
+
+    uint8_t RoundKey[AES256_ROUNDKEY_SIZE];
+    KeyExpansion(RoundKey, Key);
+
+    file_task_t proto = {
+        .RoundKey = RoundKey, .info = &info, .header = in.map,
+        .src = in.map + AES256_FILE_HEADER_SIZE, .dst = out.map,
+        .index_in = in.map + info.index_offset, .encrypt = 0,
+    };
+    if (info.chunk_count > 0) rc = file_run_chunks(&proto, nthreads);
+
+    file_wipe(RoundKey, sizeof(RoundKey));
+    file_unmap(&in);
+    file_unmap(&out);
+    if (rc != 0) unlink(out_path);
+    return rc;
+}
+
+/**
+ * @brief 컨테이너 헤더만 읽어 형식을 확인함 (키 불필요)
+ * @return 성공 시 0, 실패 시 음수
+ */
+int AES256_FileInfo(const char* path, AES256_FILE_INFO* info) {
+    if (path == NULL || info == NULL) return -1;
+
+    file_map_t m;
+    int rc = file_map_read(path, &m);
+    if (rc != 0) return rc;
+    rc = (m.map != NULL) ? file_parse_header(m.map, m.size, info) : -2;
+    file_unmap(&m);
+    return rc;
+}
+
+/* ---------------- 파이프라인 변환 (읽기 / 암복호화 / 쓰기 겹치기) ---------------- */
+
+/*
+ * 정렬된 버퍼 depth개를 돌려 쓰면서 청크마다 읽기 → 암복호화 → 쓰기를 진행함
+ * - 버퍼마다 청크 하나를 맡으므로 여러 청크의 읽기, 암복호화, 쓰기가 동시에 진행됨
+ * - 청크 위치가 고정이라 쓰기 순서는 상관없음 (pwrite / io_uring 위치 지정 쓰기)
+ * - 입출력: io_uring(호출 스레드 하나가 모든 읽기/쓰기를 제출하고 완료를 거둠) 또는
+ *   스레드 방식(호출 스레드가 읽고 쓰기 스레드 하나가 씀). 암복호화는 항상 워커 스레드가 함
+ * - O_DIRECT는 평문 쪽에만 적용함. 컨테이너 쪽 청크는 64바이트 헤더 뒤에 있어 블록 경계에 맞지 않음
+ */
+
+#define PIPE_ALIGN     4096
+#define PIPE_MAX_DEPTH 256
+
+typedef struct pipe_slot {
+    uint8_t* buf;               /* PIPE_ALIGN 정렬, 청크 크기를 PIPE_ALIGN 배수로 올린 크기 */
+    uint64_t chunk;
+    size_t len;                 /* 청크 길이 (평문 = 암호문) */
+    size_t io_len;              /* 이번 읽기/쓰기 요청 길이 (O_DIRECT 쪽은 PIPE_ALIGN 배수) */
+    size_t done;                /* 지금까지 읽거나 쓴 바이트 */
+    int writing;                /* io_uring 완료 구분: 0 읽기, 1 쓰기 */
+    struct pipe_slot* next;
+} pipe_slot_t;
+
+typedef struct {
+    int encrypt;
+    int in_fd, out_fd;
+    int in_direct, out_direct;
+    uint64_t in_base, out_base;     /* 청크 0의 파일 위치 (컨테이너 쪽은 헤더 뒤) */
+    const AES256_FILE_INFO* info;
+    const uint8_t* header;
+    uint8_t* index;                 /* 암호화: 채워서 마지막에 씀, 복호화: 미리 읽어 둠 */
+    const uint8_t* RoundKey;
+
+    pipe_slot_t* slots;
+    int nslots;
+    int nworkers;
+
+    pthread_mutex_t lock;
+    pthread_cond_t slot_cond;       /* 빈 버퍼가 생기거나 오류 발생 (읽는 쪽) */
+    pthread_cond_t work_cond;       /* 암복호화할 청크가 생김 (워커) */
+    pthread_cond_t write_cond;      /* 쓸 청크가 생김 (스레드 방식의 쓰기 스레드) */
+    pipe_slot_t* free_list;
+    pipe_slot_t* work_head;
+    pipe_slot_t* work_tail;
+    pipe_slot_t* write_head;
+    pipe_slot_t* write_tail;
+    uint64_t scheduled;             /* 읽기를 시작한 청크 수 */
+    uint64_t retired;               /* 쓰기를 마쳤거나 오류로 버린 청크 수 */
+    int read_done;                  /* 더 읽을 청크가 없음 */
+    int stop;                       /* 워커 종료 */
+    int result;                     /* 처음 발생한 오류 (0이면 정상) */
+    int efd;                        /* io_uring 방식: 쓸 청크가 생겼음을 알리는 eventfd, 아니면 -1 */
+
+    uint64_t buffer_waits;
+    uint64_t crypto_waits;
+} file_pipe_t;
+
+static size_t pipe_round_up(size_t n) {
+    return (n + PIPE_ALIGN - 1) & ~(size_t)(PIPE_ALIGN - 1);
+}
+
+/**
+ * @brief 버퍼에 청크 c를 배정하고 읽기 요청 길이를 정함
+ * @details O_DIRECT 읽기는 정렬 길이로 요청하며, 파일 끝의 마지막 청크는 실제 길이만큼만 읽힘
+ */
+static void pipe_slot_assign(file_pipe_t* p, pipe_slot_t* s, uint64_t c) {
+    uint64_t start = c * p->info->chunk_size;
+    uint64_t remain = p->info->plain_size - start;
+
+    s->chunk = c;
+    s->len = (remain < p->info->chunk_size) ? (size_t)remain : p->info->chunk_size;
+    s->io_len = p->in_direct ? pipe_round_up(s->len) : s->len;
+    s->done = 0;
+    s->writing = 0;
+}
+
+/**
+ * @brief 쓰기 요청 길이를 정함 (O_DIRECT 쓰기는 정렬 길이로 0을 채워 쓰고 끝에서 ftruncate)
+ */
+static void pipe_slot_begin_write(file_pipe_t* p, pipe_slot_t* s) {
+    s->io_len = s->len;
+    if (p->out_direct) {
+        s->io_len = pipe_round_up(s->len);
+        memset(s->buf + s->len, 0, s->io_len - s->len);
+    }
+    s->done = 0;
+    s->writing = 1;
+}
+
+static uint64_t pipe_in_offset(const file_pipe_t* p, const pipe_slot_t* s) {
+    return p->in_base + s->chunk * p->info->chunk_size + s->done;
+}
+
+static uint64_t pipe_out_offset(const file_pipe_t* p, const pipe_slot_t* s) {
+    return p->out_base + s->chunk * p->info->chunk_size + s->done;
+}
+
+/**
+ * @brief 읽기/쓰기 완료 n바이트를 반영함
+ * @return 1이면 요청이 끝남, 0이면 나머지를 다시 요청해야 함, 음수면 입출력 오류
+ */
+static int pipe_slot_advance(pipe_slot_t* s, long long n) {
+    if (n < 0) return -4;
+    if (n == 0) {
+        /* 읽기에서 청크 길이 전에 파일 끝: 입력이 도중에 줄어듦 */
+        return (!s->writing && s->done >= s->len) ? 1 : -4;
+    }
+    s->done += (size_t)n;
+    if (s->writing) return (s->done >= s->io_len) ? 1 : 0;
+    return (s->done >= s->len) ? 1 : 0;
+}
+
+/* 아래 목록 조작 함수는 모두 p->lock을 잡고 호출함 */
+static void pipe_push(pipe_slot_t** head, pipe_slot_t** tail, pipe_slot_t* s) {
+    s->next = NULL;
+    if (*tail != NULL) {
+        (*tail)->next = s;
+    } else {
+        *head = s;
+    }
+    *tail = s;
+}
+
+static pipe_slot_t* pipe_pop(pipe_slot_t** head, pipe_slot_t** tail) {
+    pipe_slot_t* s = *head;
+    if (s != NULL) {
+        *head = s->next;
+        if (*head == NULL) *tail = NULL;
+    }
+    return s;
+}
+
+static void pipe_fail(file_pipe_t* p, int rc) {
+    if (p->result == 0) p->result = rc;
+    pthread_cond_broadcast(&p->slot_cond);
+}
+
+/* 청크 하나를 끝냄 (쓰기 완료 또는 오류로 버림): 버퍼를 돌려주고 읽는 쪽을 깨움 */
+static void pipe_retire(file_pipe_t* p, pipe_slot_t* s) {
+    s->next = p->free_list;
+    p->free_list = s;
+    p->retired++;
+    pthread_cond_signal(&p->slot_cond);
+    pthread_cond_signal(&p->write_cond);
+}
+
+/* 읽기가 끝난 청크를 워커에게 넘김 (오류가 난 뒤라면 바로 버림) */
+static void pipe_enqueue_work(file_pipe_t* p, pipe_slot_t* s) {
+    if (p->result != 0) {
+        pipe_retire(p, s);
+        return;
+    }
+    pipe_push(&p->work_head, &p->work_tail, s);
+    pthread_cond_signal(&p->work_cond);
+}
+
+/**
+ * @brief 버퍼 안의 청크 하나를 GCM 암호화/복호화함 (file_chunk_worker와 같은 규칙)
+ */
+static int pipe_crypt(file_pipe_t* p, pipe_slot_t* s) {
+    const AES256_FILE_INFO* info = p->info;
+    uint8_t* entry = p->index + s->chunk * AES256_FILE_INDEX_ENTRY;
+    uint8_t nonce[12];
+
+    file_chunk_nonce(nonce, info->file_id, s->chunk);
+    if (p->encrypt) {
+        file_put_be64(entry, AES256_FILE_HEADER_SIZE + s->chunk * info->chunk_size);
+        file_put_be32(entry + 8, (uint32_t)s->len);
+        file_put_be32(entry + 12, 0);
+        return AES256_GCM_Encrypt(s->buf, s->len, p->header, AES256_FILE_HEADER_SIZE,
+                                  p->RoundKey, nonce, sizeof(nonce), entry + 16);
+    }
+
+    int rc = file_check_index(entry, info, s->chunk);
+    if (rc != 0) return rc;
+    return AES256_GCM_Decrypt(s->buf, s->len, p->header, AES256_FILE_HEADER_SIZE,
+                              p->RoundKey, nonce, sizeof(nonce), entry + 16);
+}
+
+/**
+ * @brief 암복호화 워커: 읽기가 끝난 청크를 처리해 쓰기 목록으로 넘김
+ * @details 오류가 난 뒤에는 처리하지 않고 넘겨서 쓰는 쪽이 버퍼를 회수하게 함
+ */
+static void* pipe_worker(void* arg) {
+    file_pipe_t* p = (file_pipe_t*)arg;
+    static const uint64_t one = 1;
+
+    pthread_mutex_lock(&p->lock);
+    for (;;) {
+        pipe_slot_t* s = pipe_pop(&p->work_head, &p->work_tail);
+        if (s == NULL) {
+            if (p->stop) break;
+            p->crypto_waits++;
+            pthread_cond_wait(&p->work_cond, &p->lock);
+            continue;
+        }
+
+        int skip = (p->result != 0);
+        pthread_mutex_unlock(&p->lock);
+        int rc = skip ? 0 : pipe_crypt(p, s);
+        pthread_mutex_lock(&p->lock);
+
+        if (rc != 0) pipe_fail(p, rc);
+        pipe_push(&p->write_head, &p->write_tail, s);
+        if (p->efd >= 0) {
+            pthread_mutex_unlock(&p->lock);
+            if (write(p->efd, &one, sizeof(one)) < 0) { /* 카운터가 넘칠 일은 없음 */ }
+            pthread_mutex_lock(&p->lock);
+        } else {
+            pthread_cond_signal(&p->write_cond);
+        }
+    }
+    pthread_mutex_unlock(&p->lock);
+    return NULL;
+}
+
+/* ---- 스레드 방식: 호출 스레드가 읽고, 쓰기 스레드 하나가 씀 ---- */
+
+static int pipe_pread_slot(file_pipe_t* p, pipe_slot_t* s) {
+    for (;;) {
+        ssize_t n = pread(p->in_fd, s->buf + s->done, s->io_len - s->done, (off_t)pipe_in_offset(p, s));
+        if (n < 0 && errno == EINTR) continue;
+        int rc = pipe_slot_advance(s, n);
+        if (rc != 0) return (rc > 0) ? 0 : rc;
+    }
+}
+
+static int pipe_pwrite_slot(file_pipe_t* p, pipe_slot_t* s) {
+    for (;;) {
+        ssize_t n = pwrite(p->out_fd, s->buf + s->done, s->io_len - s->done, (off_t)pipe_out_offset(p, s));
+        if (n < 0 && errno == EINTR) continue;
+        int rc = pipe_slot_advance(s, n);
+        if (rc != 0) return (rc > 0) ? 0 : rc;
+    }
+}
+
+static void* pipe_writer(void* arg) {
+    file_pipe_t* p = (file_pipe_t*)arg;
+
+    pthread_mutex_lock(&p->lock);
+    for (;;) {
+        pipe_slot_t* s = pipe_pop(&p->write_head, &p->write_tail);
+        if (s == NULL) {
+            if (p->read_done && p->retired == p->scheduled) break;
+            pthread_cond_wait(&p->write_cond, &p->lock);
+            continue;
+        }
+        if (p->result == 0) {
+            pthread_mutex_unlock(&p->lock);
+            pipe_slot_begin_write(p, s);
+            int rc = pipe_pwrite_slot(p, s);
+            pthread_mutex_lock(&p->lock);
+            if (rc != 0) pipe_fail(p, rc);
+        }
+        pipe_retire(p, s);
+    }
+    pthread_mutex_unlock(&p->lock);
+    return NULL;
+}
+
+static int pipe_run_threads(file_pipe_t* p) {
+    pthread_t writer;
+    if (pthread_create(&writer, NULL, pipe_writer, p) != 0) return -4;
+
+    for (uint64_t c = 0; c < p->info->chunk_count; c++) {
+        pthread_mutex_lock(&p->lock);
+        if (p->free_list == NULL && p->result == 0) {
+            p->buffer_waits++;
+            while (p->free_list == NULL && p->result == 0) pthread_cond_wait(&p->slot_cond, &p->lock);
+        }
+        if (p->result != 0) {
+            pthread_mutex_unlock(&p->lock);
+            break;
+        }
+        pipe_slot_t* s = p->free_list;
+        p->free_list = s->next;
+        p->scheduled++;
+        pthread_mutex_unlock(&p->lock);
+
+        pipe_slot_assign(p, s, c);
+        int rc = pipe_pread_slot(p, s);
+
+        pthread_mutex_lock(&p->lock);
+        if (rc != 0) {
+            pipe_fail(p, rc);
+            pipe_retire(p, s);
+        } else {
+            pipe_enqueue_work(p, s);
+        }
+        pthread_mutex_unlock(&p->lock);
+    }
+
+    pthread_mutex_lock(&p->lock);
+    p->read_done = 1;
+    pthread_cond_signal(&p->write_cond);
+    pthread_mutex_unlock(&p->lock);
+    pthread_join(writer, NULL);
+    return 0;
+}
+
+/* ---- io_uring 방식 (liburing 없이 시스템 호출과 공유 링을 직접 사용) ---- */
+
+typedef struct {
+    int fd;
+    unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+    unsigned *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_sqe* sqes;
+    struct io_uring_cqe* cqes;
+    void* sq_map;
+    void* cq_map;
+    size_t sq_map_len, cq_map_len, sqes_len;
+    unsigned to_submit;
+} pipe_uring_t;
+
+static void pipe_uring_close(pipe_uring_t* r) {
+    if (r->sqes != NULL) munmap(r->sqes, r->sqes_len);
+    if (r->cq_map != NULL && r->cq_map != r->sq_map) munmap(r->cq_map, r->cq_map_len);
+    if (r->sq_map != NULL) munmap(r->sq_map, r->sq_map_len);
+    if (r->fd >= 0) close(r->fd);
+    memset(r, 0, sizeof(*r));
+    r->fd = -1;
+}
+
+/**
+ * @brief 링을 만들고 READ/WRITE 명령 지원 여부를 확인함
+ * @return 성공 시 0, 커널이 지원하지 않거나 막혀 있으면 -4 (스레드 방식으로 대체)
+ */
+static int pipe_uring_init(pipe_uring_t* r, unsigned entries) {
+    struct io_uring_params prm;
+
+    memset(r, 0, sizeof(*r));
+    memset(&prm, 0, sizeof(prm));
+    r->fd = (int)syscall(__NR_io_uring_setup, entries, &prm);
+    if (r->fd < 0) return -4;
+
+    size_t probe_size = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe* probe = (struct io_uring_probe*)calloc(1, probe_size);
+    int ok = (probe != NULL && syscall(__NR_io_uring_register, r->fd, IORING_REGISTER_PROBE, probe, 256) == 0 &&
+              probe->last_op >= IORING_OP_WRITE &&
+              (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) &&
+              (probe->ops[IORING_OP_WRITE].flags & IO_URING_OP_SUPPORTED));
+    free(probe);
+    if (!ok) goto fail;
+
+    r->sq_map_len = prm.sq_off.array + prm.sq_entries * sizeof(unsigned);
+    r->cq_map_len = prm.cq_off.cqes + prm.cq_entries * sizeof(struct io_uring_cqe);
+    if (prm.features & IORING_FEAT_SINGLE_MMAP) {
+        if (r->cq_map_len > r->sq_map_len) r->sq_map_len = r->cq_map_len;
+        r->cq_map_len = r->sq_map_len;
+    }
+
+    r->sq_map = mmap(NULL, r->sq_map_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQ_RING);
+    if (r->sq_map == MAP_FAILED) {
+        r->sq_map = NULL;
+        goto fail;
+    }
+    if (prm.features & IORING_FEAT_SINGLE_MMAP) {
+        r->cq_map = r->sq_map;
+    } else {
+        r->cq_map = mmap(NULL, r->cq_map_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_CQ_RING);
+        if (r->cq_map == MAP_FAILED) {
+            r->cq_map = NULL;
+            goto fail;
+        }
+    }
+    r->sqes_len = prm.sq_entries * sizeof(struct io_uring_sqe);
+    r->sqes = (struct io_uring_sqe*)mmap(NULL, r->sqes_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                         r->fd, IORING_OFF_SQES);
+    if (r->sqes == MAP_FAILED) {
+        r->sqes = NULL;
+        goto fail;
+    }
+
+    uint8_t* sq = (uint8_t*)r->sq_map;
+    uint8_t* cq = (uint8_t*)r->cq_map;
+    r->sq_head = (unsigned*)(sq + prm.sq_off.head);
+    r->sq_tail = (unsigned*)(sq + prm.sq_off.tail);
+    r->sq_mask = (unsigned*)(sq + prm.sq_off.ring_mask);
+    r->sq_array = (unsigned*)(sq + prm.sq_off.array);
+    r->cq_head = (unsigned*)(cq + prm.cq_off.head);
+    r->cq_tail = (unsigned*)(cq + prm.cq_off.tail);
+    r->cq_mask = (unsigned*)(cq + prm.cq_off.ring_mask);
+    r->cqes = (struct io_uring_cqe*)(cq + prm.cq_off.cqes);
+    return 0;
+
+fail:
+    pipe_uring_close(r);
+    return -4;
+}
+
+/**
+ * @brief SQE 하나를 채워 제출 대기열에 넣음 (실제 제출은 pipe_uring_enter)
+ * @details 동시에 진행하는 요청 수가 링 크기보다 작게 잡혀 있어 SQ가 넘치지 않음
+ */
+static void pipe_uring_prep(pipe_uring_t* r, int op, int fd, void* addr, size_t len, uint64_t off, uint64_t user) {
+    unsigned tail = *r->sq_tail;
+    unsigned idx = tail & *r->sq_mask;
+    struct io_uring_sqe* sqe = &r->sqes[idx];
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = (uint8_t)op;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)addr;
+    sqe->len = (uint32_t)len;
+    sqe->off = off;
+    sqe->user_data = user;
+    r->sq_array[idx] = idx;
+    __atomic_store_n(r->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    r->to_submit++;
+}
+
+/**
+ * @brief 쌓인 SQE를 제출하고 완료가 하나 이상 생길 때까지 기다림
+ * @return 성공 시 0, 실패 시 -4
+ */
+static int pipe_uring_enter(pipe_uring_t* r) {
+    for (;;) {
+        long n = syscall(__NR_io_uring_enter, r->fd, r->to_submit, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+        if (n >= 0) {
+            r->to_submit -= (unsigned)n;   /* 일부만 제출되면 나머지는 다음 호출에서 제출 */
+            return 0;
+        }
+        if (errno == EINTR) continue;
+        if (errno == EAGAIN || errno == EBUSY) return 0;   /* 완료 큐를 먼저 비워야 함 */
+        return -4;
+    }
+}
+
+/* 완료 하나를 꺼냄, 없으면 0 */
+static int pipe_uring_reap(pipe_uring_t* r, uint64_t* user, int* res) {
+    unsigned head = *r->cq_head;
+    if (head == __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE)) return 0;
+    struct io_uring_cqe* cqe = &r->cqes[head & *r->cq_mask];
+    *user = cqe->user_data;
+    *res = cqe->res;
+    __atomic_store_n(r->cq_head, head + 1, __ATOMIC_RELEASE);
+    return 1;
+}
+
+#define PIPE_EVENT_USER 0   /* eventfd 읽기 완료 (슬롯 포인터는 0이 될 수 없음) */
+
+static void pipe_uring_submit_slot(file_pipe_t* p, pipe_uring_t* r, pipe_slot_t* s) {
+    if (s->writing) {
+        pipe_uring_prep(r, IORING_OP_WRITE, p->out_fd, s->buf + s->done, s->io_len - s->done,
+                        pipe_out_offset(p, s), (uint64_t)(uintptr_t)s);
+    } else {
+        pipe_uring_prep(r, IORING_OP_READ, p->in_fd, s->buf + s->done, s->io_len - s->done,
+                        pipe_in_offset(p, s), (uint64_t)(uintptr_t)s);
+    }
+}
+
+/**
+ * @brief io_uring 방식 본체: 호출 스레드가 모든 읽기/쓰기를 제출하고 완료를 처리함
+ * @details 워커가 쓸 청크를 넘기면 eventfd에 쓰고, 그 eventfd에 걸어 둔 READ가 완료되어
+ *          링 대기에서 깨어남 (대기 지점이 io_uring_enter 하나뿐)
+ */
+static int pipe_run_uring(file_pipe_t* p, pipe_uring_t* r) {
+    uint64_t next = 0, ev_value = 0;
+    int ev_armed = 1, finishing = 0;
+
+    pipe_uring_prep(r, IORING_OP_READ, p->efd, &ev_value, sizeof(ev_value), 0, PIPE_EVENT_USER);
+
+    for (;;) {
+        pthread_mutex_lock(&p->lock);
+        if (p->result == 0 && next < p->info->chunk_count && p->free_list == NULL) p->buffer_waits++;
+        while (p->result == 0 && next < p->info->chunk_count && p->free_list != NULL) {
+            pipe_slot_t* s = p->free_list;
+            p->free_list = s->next;
+            p->scheduled++;
+            pipe_slot_assign(p, s, next++);
+            pipe_uring_submit_slot(p, r, s);
+        }
+        pipe_slot_t* w;
+        while ((w = pipe_pop(&p->write_head, &p->write_tail)) != NULL) {
+            if (p->result != 0) {
+                pipe_retire(p, w);
+                continue;
+            }
+            pipe_slot_begin_write(p, w);
+            pipe_uring_submit_slot(p, r, w);
+        }
+        int all_done = (p->retired == p->scheduled && (next == p->info->chunk_count || p->result != 0));
+        pthread_mutex_unlock(&p->lock);
+
+        if (all_done && !finishing) {
+            /* 걸어 둔 eventfd READ를 직접 완료시킨 뒤 거둬야 ev_value를 안전하게 버릴 수 있음 */
+            static const uint64_t one = 1;
+            finishing = 1;
+            if (write(p->efd, &one, sizeof(one)) < 0) { /* 카운터가 넘칠 일은 없음 */ }
+        }
+        if (finishing && !ev_armed) break;
+
+        if (pipe_uring_enter(r) != 0) {
+            /* 제출한 요청이 버퍼를 쓰고 있을 수 있으므로 링을 닫아(취소) 정리함 */
+            pthread_mutex_lock(&p->lock);
+            pipe_fail(p, -4);
+            pthread_mutex_unlock(&p->lock);
+            return -4;
+        }
+
+        uint64_t user;
+        int res;
+        while (pipe_uring_reap(r, &user, &res)) {
+            if (user == PIPE_EVENT_USER) {
+                ev_armed = 0;
+                if (!finishing) {
+                    pipe_uring_prep(r, IORING_OP_READ, p->efd, &ev_value, sizeof(ev_value), 0, PIPE_EVENT_USER);
+                    ev_armed = 1;
+                }
+                continue;
+            }
+
+            pipe_slot_t* s = (pipe_slot_t*)(uintptr_t)user;
+            int rc = (res == -EINTR || res == -EAGAIN) ? 0 : pipe_slot_advance(s, res);
+            if (rc == 0) {
+                pipe_uring_submit_slot(p, r, s);
+                continue;
+            }
+
+            pthread_mutex_lock(&p->lock);
+            if (rc < 0) {
+                pipe_fail(p, rc);
+                pipe_retire(p, s);
+            } else if (s->writing) {
+                pipe_retire(p, s);
+            } else {
+                pipe_enqueue_work(p, s);
+            }
+            pthread_mutex_unlock(&p->lock);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 버퍼와 워커를 준비해 입출력 방식에 맞는 본체를 실행함
+ * @return 모든 청크 성공 시 0, 실패 시 음수
+ */
+static int file_pipe_run(file_pipe_t* p, const AES256_FILE_PIPE_CONFIG* cfg, AES256_FILE_PIPE_STATS* stats) {
+    int nworkers = (cfg != NULL && cfg->nthreads > 0) ? cfg->nthreads : file_default_threads();
+    if (nworkers > FILE_MAX_THREADS) nworkers = FILE_MAX_THREADS;
+    int depth = (cfg != NULL && cfg->depth > 0) ? cfg->depth : nworkers * 2 + 2;
+    if (depth < 4) depth = 4;
+    if (depth > PIPE_MAX_DEPTH) depth = PIPE_MAX_DEPTH;
+    if ((uint64_t)depth > p->info->chunk_count) depth = (int)p->info->chunk_count;
+    if (depth < 1) depth = 1;
+    if (nworkers > depth) nworkers = depth;
+    aes256_file_io_t io = (cfg != NULL) ? cfg->io : AES256_FILE_IO_AUTO;
+
+    pipe_uring_t ring;
+    memset(&ring, 0, sizeof(ring));
+    ring.fd = -1;
+    p->efd = -1;
+    if (io != AES256_FILE_IO_THREADS) {
+        if (pipe_uring_init(&ring, (unsigned)depth + 1) == 0) {
+            p->efd = eventfd(0, EFD_CLOEXEC);
+            if (p->efd < 0) pipe_uring_close(&ring);
+        }
+        if (p->efd < 0) {
+            if (io == AES256_FILE_IO_URING) return -4;
+            io = AES256_FILE_IO_THREADS;
+        } else {
+            io = AES256_FILE_IO_URING;
+        }
+    }
+
+    size_t buf_size = pipe_round_up(p->info->chunk_size);
+    pthread_t tids[FILE_MAX_THREADS];
+    int nstarted = 0, rc = 0;
+
+    p->slots = (pipe_slot_t*)calloc((size_t)depth, sizeof(pipe_slot_t));
+    p->nslots = 0;
+    if (p->slots == NULL) rc = -4;
+    for (int i = 0; rc == 0 && i < depth; i++) {
+        void* buf;
+        if (posix_memalign(&buf, PIPE_ALIGN, buf_size) != 0) {
+            rc = -4;
+            break;
+        }
+        p->slots[i].buf = (uint8_t*)buf;
+        p->slots[i].next = p->free_list;
+        p->free_list = &p->slots[i];
+        p->nslots++;
+    }
+
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->slot_cond, NULL);
+    pthread_cond_init(&p->work_cond, NULL);
+    pthread_cond_init(&p->write_cond, NULL);
+    for (int i = 0; rc == 0 && i < nworkers; i++) {
+        if (pthread_create(&tids[i], NULL, pipe_worker, p) != 0) break;
+        nstarted++;
+    }
+    if (rc == 0 && nstarted == 0) rc = -4;
+    p->nworkers = nstarted;
+
+    if (rc == 0) rc = (io == AES256_FILE_IO_URING) ? pipe_run_uring(p, &ring) : pipe_run_threads(p);
+
+    pthread_mutex_lock(&p->lock);
+    p->stop = 1;
+    pthread_cond_broadcast(&p->work_cond);
+    pthread_mutex_unlock(&p->lock);
+    for (int i = 0; i < nstarted; i++) pthread_join(tids[i], NULL);
+    /* io_uring 오류로 빠져나온 경우 링을 닫아 남은 요청을 취소한 뒤에 버퍼를 해제함 */
+    pipe_uring_close(&ring);
+    if (p->efd >= 0) close(p->efd);
+
+    if (rc == 0) rc = p->result;
+    if (stats != NULL) {
+        stats->io = io;
+        stats->direct = p->encrypt ? p->in_direct : p->out_direct;
+        stats->depth = p->nslots;
+        stats->nthreads = p->nworkers;
+        stats->buffer_waits = p->buffer_waits;
+        stats->crypto_waits = p->crypto_waits;
+    }
+
+    for (int i = 0; i < p->nslots; i++) {
+        file_wipe(p->slots[i].buf, buf_size);
+        free(p->slots[i].buf);
+    }
+    free(p->slots);
+    pthread_cond_destroy(&p->write_cond);
+    pthread_cond_destroy(&p->work_cond);
+    pthread_cond_destroy(&p->slot_cond);
+    pthread_mutex_destroy(&p->lock);
+    return rc;
+}
+
+/**
+ * @brief O_DIRECT를 요청받았고 청크가 정렬 단위의 배수이면 O_DIRECT로 열어 봄
+ * @details 파일 시스템이 O_DIRECT를 지원하지 않으면(EINVAL) 일반 입출력으로 다시 엶
+ */
+static int pipe_open(const char* path, int flags, int want_direct, int* direct) {
+    *direct = 0;
+    if (want_direct) {
+        int fd = open(path, flags | O_DIRECT | O_CLOEXEC, 0600);
+        if (fd >= 0) {
+            *direct = 1;
+            return fd;
+        }
+        if (errno != EINVAL) return -1;
+    }
+    return open(path, flags | O_CLOEXEC, 0600);
+}
+
+static int pipe_pwrite_all(int fd, const uint8_t* buf, size_t len, uint64_t off) {
+    while (len > 0) {
+        ssize_t n = pwrite(fd, buf, len, (off_t)off);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return -4;
+        buf += n;
+        len -= (size_t)n;
+        off += (uint64_t)n;
+    }
+    return 0;
+}
+
+static int pipe_pread_all(int fd, uint8_t* buf, size_t len, uint64_t off) {
+    while (len > 0) {
+        ssize_t n = pread(fd, buf, len, (off_t)off);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return -4;
+        buf += n;
+        len -= (size_t)n;
+        off += (uint64_t)n;
+    }
+    return 0;
+}
+
+/**
+ * @brief 평문 파일을 읽기/암호화/쓰기를 겹쳐 진행하며 컨테이너로 암호화함 (형식은 AES256_FileEncrypt와 같음)
+ * @param cfg   NULL이면 모두 기본값
+ * @param stats [Out] 실제로 쓴 입출력 방식과 대기 횟수 (NULL 가능)
+ * @return 성공 시 0, 실패 시 음수 (입력이 일반 파일이 아니면 -1)
+ */
+int AES256_FileEncryptPipe(const char* in_path, const char* out_path, const uint8_t* Key,
+                           const AES256_FILE_PIPE_CONFIG* cfg, AES256_FILE_PIPE_STATS* stats) {
+    if (in_path == NULL || out_path == NULL || Key == NULL) return -1;
+    if (stats != NULL) memset(stats, 0, sizeof(*stats));
+    uint32_t chunk_size = (cfg != NULL && cfg->chunk_size != 0) ? cfg->chunk_size : AES256_FILE_DEFAULT_CHUNK;
+    if (chunk_size < AES256_FILE_MIN_CHUNK || chunk_size > AES256_FILE_MAX_CHUNK) return -1;
+
+    file_pipe_t p;
+    memset(&p, 0, sizeof(p));
+    p.encrypt = 1;
+    p.out_base = AES256_FILE_HEADER_SIZE;
+
+    int want_direct = (cfg != NULL && cfg->direct && chunk_size % PIPE_ALIGN == 0);
+    p.in_fd = pipe_open(in_path, O_RDONLY, want_direct, &p.in_direct);
+    if (p.in_fd < 0) return -4;
+
+    /* 헤더에 평문 크기가 들어가므로 크기를 미리 알 수 있는 일반 파일만 받음 */
+    struct stat st;
+    int rc = (fstat(p.in_fd, &st) != 0) ? -4 : (S_ISREG(st.st_mode) ? 0 : -1);
+    if (rc != 0) {
+        close(p.in_fd);
+        return rc;
+    }
+
+    AES256_FILE_INFO info;
+    info.chunk_size = chunk_size;
+    info.plain_size = (uint64_t)st.st_size;
+    info.chunk_count = (info.plain_size + chunk_size - 1) / chunk_size;
+    info.index_offset = AES256_FILE_HEADER_SIZE + info.plain_size;
+    if (info.chunk_count > UINT32_MAX) {
+        close(p.in_fd);
+        return -1;
+    }
+    if (getrandom(info.file_id, sizeof(info.file_id), 0) != (ssize_t)sizeof(info.file_id)) {
+        close(p.in_fd);
+        return -4;
+    }
+
+    uint8_t header[AES256_FILE_HEADER_SIZE];
+    uint8_t RoundKey[AES256_ROUNDKEY_SIZE];
+    size_t index_len = (size_t)info.chunk_count * AES256_FILE_INDEX_ENTRY;
+
+    file_build_header(header, &info);
+    p.info = &info;
+    p.header = header;
+    p.RoundKey = RoundKey;
+    p.index = (uint8_t*)malloc(index_len > 0 ? index_len : 1);
+    p.out_fd = open(out_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    if (p.index == NULL || p.out_fd < 0) rc = -4;
+    if (rc == 0 && (ftruncate(p.out_fd, (off_t)(info.index_offset + index_len)) != 0 ||
+                    pipe_pwrite_all(p.out_fd, header, sizeof(header), 0) != 0)) rc = -4;
+
+    KeyExpansion(RoundKey, Key);
+    if (rc == 0 && info.chunk_count > 0) rc = file_pipe_run(&p, cfg, stats);
+    if (rc == 0) rc = pipe_pwrite_all(p.out_fd, p.index, index_len, info.index_offset);
+
+    file_wipe(RoundKey, sizeof(RoundKey));
+    free(p.index);
+    close(p.in_fd);
+    if (p.out_fd >= 0) close(p.out_fd);
+    if (rc != 0 && p.out_fd >= 0) unlink(out_path);
+    return rc;
+}
+
+/**
+ * @brief 컨테이너를 읽기/복호화/쓰기를 겹쳐 진행하며 평문 파일로 복호화함
+ * @details 인증에 실패한 청크가 하나라도 있으면 -3을 반환하고 출력 파일을 지움
+ * @return 성공 시 0, 실패 시 음수
+ */
+int AES256_FileDecryptPipe(const char* in_path, const char* out_path, const uint8_t* Key,
+                           const AES256_FILE_PIPE_CONFIG* cfg, AES256_FILE_PIPE_STATS* stats) {
+    if (in_path == NULL || out_path == NULL || Key == NULL) return -1;
+    if (stats != NULL) memset(stats, 0, sizeof(*stats));
+
+    file_pipe_t p;
+    memset(&p, 0, sizeof(p));
+    p.in_base = AES256_FILE_HEADER_SIZE;
+    p.in_fd = open(in_path, O_RDONLY | O_CLOEXEC);
+    if (p.in_fd < 0) return -4;
+
+    struct stat st;
+    uint8_t header[AES256_FILE_HEADER_SIZE];
+    AES256_FILE_INFO info;
+    int rc = (fstat(p.in_fd, &st) == 0) ? 0 : -4;
+    if (rc == 0 && (uint64_t)st.st_size < AES256_FILE_HEADER_SIZE) rc = -2;
+    if (rc == 0) rc = pipe_pread_all(p.in_fd, header, sizeof(header), 0);
+    if (rc == 0) rc = file_parse_header(header, (uint64_t)st.st_size, &info);
+
+    size_t index_len = 0;
+    if (rc == 0) {
+        index_len = (size_t)info.chunk_count * AES256_FILE_INDEX_ENTRY;
+        p.index = (uint8_t*)malloc(index_len > 0 ? index_len : 1);
+        rc = (p.index != NULL) ? pipe_pread_all(p.in_fd, p.index, index_len, info.index_offset) : -4;
+    }
+    if (rc != 0) {
+        free(p.index);
+        close(p.in_fd);
+        return rc;
+    }
+
+    int want_direct = (cfg != NULL && cfg->direct && info.chunk_size % PIPE_ALIGN == 0);
+    p.out_fd = pipe_open(out_path, O_WRONLY | O_CREAT | O_TRUNC, want_direct, &p.out_direct);
+    if (p.out_fd < 0) {
+        free(p.index);
+        close(p.in_fd);
+        return -4;
+    }
+
+    uint8_t RoundKey[AES256_ROUNDKEY_SIZE];
+    KeyExpansion(RoundKey, Key);
+    p.info = &info;
+    p.header = header;
+    p.RoundKey = RoundKey;
+    if (info.chunk_count > 0) rc = file_pipe_run(&p, cfg, stats);
+    /* O_DIRECT로 정렬 길이만큼 쓴 마지막 청크의 0 채움을 잘라 냄 */
+    if (rc == 0 && ftruncate(p.out_fd, (off_t)info.plain_size) != 0) rc = -4;
+
+    file_wipe(RoundKey, sizeof(RoundKey));
+    free(p.index);
+    close(p.in_fd);
+    close(p.out_fd);
+    if (rc != 0) unlink(out_path);
+    return rc;
+}
+
+/* ---------------- 임의 위치 읽기 ---------------- */
+
+struct AES256_FILE_READER {
+    file_map_t map;
+    AES256_FILE_INFO info;
+    uint8_t RoundKey[AES256_ROUNDKEY_SIZE];
+    uint8_t* chunk;        /* 마지막으로 복호화한 청크 (연속된 작은 읽기를 위해 보관) */
+    uint64_t cached;       /* chunk에 들어 있는 청크 번호, 없으면 UINT64_MAX */
+};
+
+/**
+ * @brief 컨테이너를 열고 헤더를 검증함 (청크는 읽을 때 복호화)
+ * @param err [Out] 실패 시 오류 코드 (NULL 가능)
+ * @return 성공 시 Reader, 실패 시 NULL
+ */
+AES256_FILE_READER* AES256_FileOpen(const char* path, const uint8_t* Key, int* err) {
+    int rc = -1;
+    AES256_FILE_READER* r = NULL;
+
+    if (path == NULL || Key == NULL) goto fail;
+
+    r = (AES256_FILE_READER*)calloc(1, sizeof(*r));
+    if (r == NULL) {
+        rc = -4;
+        goto fail;
+    }
+    r->map.fd = -1;
+
+    rc = file_map_read(path, &r->map);
+    if (rc != 0) goto fail;
+    rc = (r->map.map != NULL) ? file_parse_header(r->map.map, r->map.size, &r->info) : -2;
+    if (rc != 0) goto fail;
+
+    r->chunk = (uint8_t*)malloc(r->info.chunk_size);
+    if (r->chunk == NULL) {
+        rc = -4;
+        goto fail;
+    }
+    r->cached = UINT64_MAX;
+    KeyExpansion(r->RoundKey, Key);
+
+    if (err != NULL) *err = 0;
+    return r;
+
+fail:
+    if (r != NULL) AES256_FileClose(r);
+    if (err != NULL) *err = rc;
+    return NULL;
+}
+
+uint64_t AES256_FileSize(const AES256_FILE_READER* r) {
+    return (r != NULL) ? r->info.plain_size : 0;
+}
+
+/**
+ * @brief 청크 하나를 Reader의 버퍼로 복사하여 복호화/검증함
+ */
+static int file_load_chunk(AES256_FILE_READER* r, uint64_t c) {
+    if (r->cached == c) return 0;
+
+    const AES256_FILE_INFO* info = &r->info;
+    const uint8_t* entry = r->map.map + info->index_offset + c * AES256_FILE_INDEX_ENTRY;
+    uint64_t start = c * info->chunk_size;
+    uint64_t remain = info->plain_size - start;
+    size_t len = (remain < info->chunk_size) ? (size_t)remain : info->chunk_size;
+    uint8_t nonce[12];
+
+    int rc = file_check_index(entry, info, c);
+    if (rc != 0) return rc;
+
+    r->cached = UINT64_MAX;
+    memcpy(r->chunk, r->map.map + AES256_FILE_HEADER_SIZE + start, len);
+    file_chunk_nonce(nonce, info->file_id, c);
+    rc = AES256_GCM_Decrypt(r->chunk, len, r->map.map, AES256_FILE_HEADER_SIZE,
+                            r->RoundKey, nonce, sizeof(nonce), entry + 16);
+    if (rc != 0) return rc;
+
+    r->cached = c;
+    return 0;
+}
+
+/**
+ * @brief 평문 기준 offset부터 len바이트를 읽음 (걸쳐 있는 청크만 복호화)
+ * @return 읽은 바이트 수 (파일 끝을 넘으면 잘림, offset이 끝 이상이면 0), 실패 시 음수
+ */
+long long AES256_FileRead(AES256_FILE_READER* r, uint64_t offset, uint8_t* out, size_t len) {
+    if (r == NULL || (out == NULL && len > 0)) return -1;
+    if (offset >= r->info.plain_size || len == 0) return 0;
+
+    if ((uint64_t)len > r->info.plain_size - offset) len = (size_t)(r->info.plain_size - offset);
+
+    size_t done = 0;
+    while (done < len) {
+        uint64_t pos = offset + done;
+        uint64_t c = pos / r->info.chunk_size;
+        size_t in_chunk = (size_t)(pos % r->info.chunk_size);
+        size_t n = r->info.chunk_size - in_chunk;
+        if (n > len - done) n = len - done;
+
+        int rc = file_load_chunk(r, c);
+        if (rc != 0) return rc;
+        memcpy(out + done, r->chunk + in_chunk, n);
+        done += n;
+    }
+    return (long long)done;
+}
+
+/**
+ * @brief Reader를 닫고 키와 복호화 버퍼를 지움
+ */
+void AES256_FileClose(AES256_FILE_READER* r) {
+    if (r == NULL) return;
+    if (r->chunk != NULL) {
+        file_wipe(r->chunk, r->info.chunk_size);
+        free(r->chunk);
+    }
+    file_wipe(r->RoundKey, sizeof(r->RoundKey));
+    file_unmap(&r->map);
+    free(r);
+}
@@ -0,0 +1,95 @@
+/*
+ * ase256_file.h
+ * - 임의 위치 읽기가 가능한 청크 단위 암호화 파일(컨테이너) 형식
+ *
+ * 파일 구조 (정수는 모두 빅엔디언):
+ *   [헤더 64바이트][청크 0 암호문][청크 1 암호문]...[마지막 청크 암호문][청크 인덱스]
+ * - 평문을 chunk_size 단위로 나누어 청크마다 AES-256-GCM으로 독립 암호화/인증합니다.
+ *   암호문은 평문과 길이가 같으므로 청크 i는 항상 64 + i * chunk_size 위치에 있습니다.
+ * - GCM nonce = 파일 ID(8바이트, 암호화 시 난수) || 청크 번호(32비트),
+ *   AAD = 헤더 64바이트 (헤더 변조, 청크 순서 바꾸기, 잘라내기를 모두 감지)
+ * - 청크 인덱스: 청크마다 32바이트 (오프셋 u64, 평문 길이 u32, 예약 u32, GCM 태그 16바이트)
+ *
+ * 사용 방법:
+ * - 파일 전체 변환은 AES256_FileEncrypt/AES256_FileDecrypt (mmap + 청크 병렬 처리)
+ * - 일부만 읽을 때는 AES256_FileOpen 후 AES256_FileRead: 요청 구간에 걸친 청크만 복호화합니다.
+ *   Reader 하나를 여러 스레드가 동시에 쓰면 안 됩니다 (스레드마다 따로 열 것).
+ * - 메모리보다 큰 파일은 AES256_FileEncryptPipe/AES256_FileDecryptPipe: 정렬된 버퍼 몇 개를
+ *   돌려 쓰면서 읽기, 암복호화, 쓰기를 겹쳐 진행합니다 (io_uring 또는 스레드, O_DIRECT 선택).
+ *   만들어지는 컨테이너는 AES256_FileEncrypt의 결과와 형식이 같습니다.
+ *
+ * 반환값: 0(또는 읽은 바이트 수) 성공, -1 인자 오류, -2 형식 오류, -3 인증 실패(변조), -4 입출력 오류
+ */
+
+#ifndef ASE256_FILE_H
+#define ASE256_FILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define AES256_FILE_HEADER_SIZE   64
+#define AES256_FILE_INDEX_ENTRY   32
+#define AES256_FILE_DEFAULT_CHUNK (1024 * 1024)
+#define AES256_FILE_MIN_CHUNK     4096
+#define AES256_FILE_MAX_CHUNK     (256 * 1024 * 1024)
+
+/* 헤더 내용 (AES256_FileInfo로 조회) */
+typedef struct {
+    uint32_t chunk_size;
+    uint64_t plain_size;
+    uint64_t chunk_count;
+    uint64_t index_offset;
+    uint8_t file_id[8];
+} AES256_FILE_INFO;
+
+typedef struct AES256_FILE_READER AES256_FILE_READER;
+
+/* 파이프라인 변환의 입출력 방식 */
+typedef enum {
+    AES256_FILE_IO_AUTO = 0,    /* io_uring을 쓸 수 있으면 io_uring, 아니면 스레드 */
+    AES256_FILE_IO_URING,       /* io_uring만 (쓸 수 없으면 -4) */
+    AES256_FILE_IO_THREADS,     /* 읽기는 호출 스레드, 쓰기는 별도 스레드 (pread/pwrite) */
+} aes256_file_io_t;
+
+/* 파이프라인 설정 (0인 항목은 기본값 사용) */
+typedef struct {
+    uint32_t chunk_size;        /* 암호화만: 청크 크기 (기본 1MB) */
+    int nthreads;               /* 암복호화 워커 수 (기본: CPU 수) */
+    int depth;                  /* 돌려 쓸 버퍼 수 = 동시에 진행하는 청크 수 (기본: 워커 수 * 2 + 2, 최소 4) */
+    int direct;                 /* 1이면 평문 쪽 파일을 O_DIRECT로 엶 (청크가 4KB 배수일 때만, 파일 시스템이
+                                   지원하지 않으면 일반 입출력). 컨테이너 쪽은 항상 페이지 캐시를 거침 */
+    aes256_file_io_t io;
+} AES256_FILE_PIPE_CONFIG;
+
+/* 파이프라인 실행 결과 (병목 확인용) */
+typedef struct {
+    aes256_file_io_t io;        /* 실제로 쓴 방식 */
+    int direct;                 /* O_DIRECT를 실제로 썼는지 */
+    int depth;
+    int nthreads;
+    uint64_t buffer_waits;      /* 빈 버퍼가 없어 읽기를 미룬 횟수 (많으면 암복호화나 쓰기가 병목) */
+    uint64_t crypto_waits;      /* 워커가 읽기를 기다린 횟수 (많으면 입출력이 병목) */
+} AES256_FILE_PIPE_STATS;
+
+/* chunk_size 0이면 기본값(1MB), nthreads 0이면 CPU 수만큼 사용 */
+int AES256_FileEncrypt(const char* in_path, const char* out_path, const uint8_t* Key,
+                       uint32_t chunk_size, int nthreads);
+/* 인증에 실패한 청크가 하나라도 있으면 -3을 반환하고 출력 파일을 지움 */
+int AES256_FileDecrypt(const char* in_path, const char* out_path, const uint8_t* Key, int nthreads);
+
+/* cfg, stats는 NULL 가능. 입력은 크기를 알 수 있는 일반 파일이어야 함 */
+int AES256_FileEncryptPipe(const char* in_path, const char* out_path, const uint8_t* Key,
+                           const AES256_FILE_PIPE_CONFIG* cfg, AES256_FILE_PIPE_STATS* stats);
+/* 인증에 실패한 청크가 하나라도 있으면 -3을 반환하고 출력 파일을 지움 */
+int AES256_FileDecryptPipe(const char* in_path, const char* out_path, const uint8_t* Key,
+                           const AES256_FILE_PIPE_CONFIG* cfg, AES256_FILE_PIPE_STATS* stats);
+
+int AES256_FileInfo(const char* path, AES256_FILE_INFO* info);
+
+AES256_FILE_READER* AES256_FileOpen(const char* path, const uint8_t* Key, int* err);
+uint64_t AES256_FileSize(const AES256_FILE_READER* r);
+/* offset부터 최대 len바이트를 복호화하여 out에 씀. 읽은 바이트 수(파일 끝이면 0) 또는 음수 반환 */
+long long AES256_FileRead(AES256_FILE_READER* r, uint64_t offset, uint8_t* out, size_t len);
+void AES256_FileClose(AES256_FILE_READER* r);
+
+#endif // ASE256_FILE_H
@@ -0,0 +1,369 @@
+/*
+ * ase256_tune.c
+ * - 백엔드/교차 폭/스레드 수/분할 크기 자동 조정과 결과 캐시 (동작 방식은 ase256_tune.h 참고)
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE /* secure_getenv */
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "ase256.h"
+#include "ase256_tune.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+#define TUNE_MAGIC       "ase256-tune 1"
+#define TUNE_BLOCK_LEN   (16 * 1024)        /* 백엔드/교차 폭 비교용 버퍼 (L1/L2에 들어가는 크기) */
+#define TUNE_THREAD_LEN  (4 * 1024 * 1024)  /* 스레드 수 비교용 버퍼 */
+#define TUNE_TRIAL_NS    500000.0           /* 시행 하나의 목표 시간 */
+#define TUNE_TRIALS      5
+#define TUNE_MAX_THREADS 64
+#define TUNE_GAIN        0.9                /* 더 많은 스레드/작은 분할을 고르려면 10% 이상 빨라야 함 (잡음 방지) */
+
+static const int tune_interleaves[] = {1, 2, 4, 8};
+
+typedef struct {
+    uint8_t* buf;
+    size_t len;
+    uint8_t RoundKey[AES256_ROUNDKEY_SIZE];
+    uint8_t iv[16];
+    int threads;
+} tune_ctx_t;
+
+static double tune_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void tune_run_ctr(tune_ctx_t* c) {
+    AES256_CTR_Crypt(c->buf, c->len, c->RoundKey, c->iv, 0);
+}
+
+static void tune_run_cbc_dec(tune_ctx_t* c) {
+    AES256_CBC_Decrypt_MT(c->buf, c->len, c->RoundKey, c->iv, c->threads);
+}
+
+static void tune_run_cbc_enc(tune_ctx_t* c) {
+    AES256_CBC_Encrypt(c->buf, c->len, c->RoundKey, c->iv);
+}
+
+/**
+ * @brief fn 1회 실행 시간(ns)을 측정함
+ * @details 한 시행이 TUNE_TRIAL_NS 이상 걸리도록 반복 횟수를 정하고, TUNE_TRIALS번 중 최솟값을 씀
+ *          (다른 프로세스의 간섭은 시간을 늘리기만 하므로 최솟값이 가장 안정적임)
+ */
+static double tune_measure(void (*fn)(tune_ctx_t*), tune_ctx_t* c) {
+    fn(c);
+    double t0 = tune_now_ns();
+    fn(c);
+    double one = tune_now_ns() - t0;
+
+    double reps_f = (one > 0) ? TUNE_TRIAL_NS / one : 1000.0;
+    unsigned reps = (reps_f < 1.0) ? 1 : (reps_f > 10000.0) ? 10000 : (unsigned)reps_f;
+    double best = 0;
+    for (int t = 0; t < TUNE_TRIALS; t++) {
+        double start = tune_now_ns();
+        for (unsigned r = 0; r < reps; r++) fn(c);
+        double per = (tune_now_ns() - start) / reps;
+        if (t == 0 || per < best) best = per;
+    }
+    return best;
+}
+
+/**
+ * @brief 캐시가 같은 머신에서 만들어졌는지 확인할 CPU 식별 문자열 (x86: 브랜드 문자열과 CPUID 1.EAX)
+ */
+static void tune_cpu_signature(char* out, size_t n) {
+    char brand[49] = "generic";
+    unsigned int sig = 0;
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) sig = eax;
+    if (__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) && eax >= 0x80000004) {
+        unsigned int* w = (unsigned int*)brand;
+        for (unsigned int leaf = 0; leaf < 3; leaf++) {
+            __get_cpuid(0x80000002 + leaf, &w[leaf * 4], &w[leaf * 4 + 1], &w[leaf * 4 + 2], &w[leaf * 4 + 3]);
+        }
+        brand[48] = '\0';
+    }
+#endif
+    /* 앞뒤 공백을 잘라 내고 줄바꿈이 섞이지 않게 함 */
+    char* b = brand;
+    while (*b == ' ') b++;
+    size_t len = strlen(b);
+    while (len > 0 && b[len - 1] == ' ') b[--len] = '\0';
+    for (size_t i = 0; i < len; i++) {
+        if (b[i] == '\n' || b[i] == '\r') b[i] = ' ';
+    }
+    snprintf(out, n, "%s|%08x", b, sig);
+}
+
+static int tune_online_cpus(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n < 1) return 1;
+    return (n > TUNE_MAX_THREADS) ? TUNE_MAX_THREADS : (int)n;
+}
+
+static int tune_is_table_impl(aes256_impl_t impl) {
+    return impl == AES256_IMPL_TTABLE || impl == AES256_IMPL_REF;
+}
+
+/**
+ * @brief cache_path가 NULL일 때 쓸 기본 캐시 파일 경로를 정함 (필요하면 상위 디렉터리를 만듦)
+ * @return 성공 시 0, 정할 수 없으면 -1
+ */
+static int tune_default_path(char* out, size_t n) {
+    const char* env = secure_getenv("ASE256_TUNE_FILE");
+    if (env != NULL && env[0] != '\0') {
+        return (snprintf(out, n, "%s", env) < (int)n) ? 0 : -1;
+    }
+
+    const char* dir = secure_getenv("XDG_CACHE_HOME");
+    char buf[4096];
+    if (dir == NULL || dir[0] == '\0') {
+        const char* home = secure_getenv("HOME");
+        if (home == NULL || home[0] == '\0') return -1;
+        if (snprintf(buf, sizeof(buf), "%s/.cache", home) >= (int)sizeof(buf)) return -1;
+        dir = buf;
+    }
+    if (mkdir(dir, 0700) != 0 && errno != EEXIST) return -1;
+    return (snprintf(out, n, "%s/ase256-tune", dir) < (int)n) ? 0 : -1;
+}
+
+/**
+ * @brief 캐시 파일을 읽어 현재 머신/옵션과 맞는지 검증함
+ * @return 유효하면 0, 없거나 맞지 않으면 -1
+ */
+static int tune_load(const char* path, int flags, AES256_TUNE* t) {
+    FILE* fp = fopen(path, "r");
+    if (fp == NULL) return -1;
+
+    char line[256], sig[256], cpu[256] = "";
+    int ncpu = -1, tables = -1, have = 0;
+    char impl_name[32] = "";
+
+    if (fgets(line, sizeof(line), fp) == NULL || strncmp(line, TUNE_MAGIC, strlen(TUNE_MAGIC)) != 0) {
+        fclose(fp);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        line[strcspn(line, "\r\n")] = '\0';
+        unsigned long long v;
+        if (strncmp(line, "cpu ", 4) == 0) {
+            snprintf(cpu, sizeof(cpu), "%s", line + 4);
+        } else if (sscanf(line, "impl %31s", impl_name) == 1) {
+            have |= 1;
+        } else if (sscanf(line, "interleave %d", &t->interleave) == 1) {
+            have |= 2;
+        } else if (sscanf(line, "threads %d", &t->threads) == 1) {
+            have |= 4;
+        } else if (sscanf(line, "split %llu", &v) == 1) {
+            t->split_bytes = (size_t)v;
+            have |= 8;
+        } else if (sscanf(line, "ncpu %d", &ncpu) != 1 && sscanf(line, "tables %d", &tables) != 1) {
+            sscanf(line, "mbps %lf", &t->mbps);     /* 참고용, 없어도 됨 */
+        }
+    }
+    fclose(fp);
+
+    tune_cpu_signature(sig, sizeof(sig));
+    if (have != 15 || strcmp(cpu, sig) != 0 || ncpu != tune_online_cpus()) return -1;
+    if (tables != ((flags & AES256_TUNE_ALLOW_TABLES) ? 1 : 0)) return -1;
+
+    t->impl = AES256_IMPL_AUTO;
+    for (int i = AES256_IMPL_AUTO + 1; i < AES256_IMPL_COUNT; i++) {
+        if (strcmp(impl_name, AES256_ImplName((aes256_impl_t)i)) == 0) t->impl = (aes256_impl_t)i;
+    }
+    if (t->impl == AES256_IMPL_AUTO || !AES256_ImplAvailable(t->impl)) return -1;
+    if (tune_is_table_impl(t->impl) && !(flags & AES256_TUNE_ALLOW_TABLES)) return -1;
+    if (t->threads < 1 || t->threads > TUNE_MAX_THREADS) return -1;
+    if (t->interleave != 1 && t->interleave != 2 && t->interleave != 4 && t->interleave != 8) return -1;
+    if (t->split_bytes < 16 * 1024 || t->split_bytes > 64 * 1024 * 1024) return -1;
+    return 0;
+}
+
+/**
+ * @brief 결과를 임시 파일에 쓴 뒤 rename으로 바꿔 넣음 (읽는 쪽은 항상 완전한 파일을 봄)
+ * @return 성공 시 0, 실패 시 -4
+ */
+static int tune_save(const char* path, int flags, const AES256_TUNE* t) {
+    char tmp[4200], sig[256];
+    if (snprintf(tmp, sizeof(tmp), "%s.%ld.tmp", path, (long)getpid()) >= (int)sizeof(tmp)) return -4;
+
+    FILE* fp = fopen(tmp, "w");
+    if (fp == NULL) return -4;
+    tune_cpu_signature(sig, sizeof(sig));
+    fprintf(fp, "%s\n", TUNE_MAGIC);
+    fprintf(fp, "cpu %s\n", sig);
+    fprintf(fp, "ncpu %d\n", tune_online_cpus());
+    fprintf(fp, "tables %d\n", (flags & AES256_TUNE_ALLOW_TABLES) ? 1 : 0);
+    fprintf(fp, "impl %s\n", AES256_ImplName(t->impl));
+    fprintf(fp, "interleave %d\n", t->interleave);
+    fprintf(fp, "threads %d\n", t->threads);
+    fprintf(fp, "split %llu\n", (unsigned long long)t->split_bytes);
+    fprintf(fp, "mbps %.1f\n", t->mbps);
+
+    int ok = (fflush(fp) == 0);
+    ok = (fclose(fp) == 0) && ok;
+    if (!ok || rename(tmp, path) != 0) {
+        unlink(tmp);
+        return -4;
+    }
+    return 0;
+}
+
+/**
+ * @brief 후보 백엔드 x 교차 폭을 측정하여 가장 빠른 조합을 고름
+ * @details 점수 = 교차 폭에 영향을 받는 CTR + CBC 복호화 중 가장 빠른 조합 + CBC 암호화 (직렬이라 교차 폭 무관)
+ */
+static void tune_pick_backend(tune_ctx_t* c, int flags, AES256_TUNE* t) {
+    double best = 0;
+
+    c->threads = 1;
+    for (int i = AES256_IMPL_AUTO + 1; i < AES256_IMPL_COUNT; i++) {
+        aes256_impl_t impl = (aes256_impl_t)i;
+        if (tune_is_table_impl(impl) && !(flags & AES256_TUNE_ALLOW_TABLES)) continue;
+        if (AES256_SetImpl(impl) != 0) continue;
+
+        double enc = tune_measure(tune_run_cbc_enc, c);
+        for (size_t k = 0; k < sizeof(tune_interleaves) / sizeof(tune_interleaves[0]); k++) {
+            AES256_SetInterleave(tune_interleaves[k]);
+            double par = tune_measure(tune_run_ctr, c) + tune_measure(tune_run_cbc_dec, c);
+            if (best == 0 || par + enc < best) {
+                best = par + enc;
+                t->impl = impl;
+                t->interleave = tune_interleaves[k];
+                t->mbps = (double)(2 * c->len) / par * 1e3;
+            }
+        }
+    }
+    AES256_SetImpl(t->impl);
+    AES256_SetInterleave(t->interleave);
+}
+
+/**
+ * @brief CBC 병렬 복호화로 스레드 수와 스레드당 분할 크기를 고름 (CPU가 하나면 측정하지 않음)
+ */
+static void tune_pick_threads(tune_ctx_t* c, AES256_TUNE* t) {
+    int ncpu = tune_online_cpus();
+    t->threads = 1;
+    t->split_bytes = AES256_GetSplitSize();
+    if (ncpu < 2) return;
+
+    uint8_t* small = c->buf;
+    size_t small_len = c->len;
+    c->buf = (uint8_t*)calloc(1, TUNE_THREAD_LEN);
+    if (c->buf == NULL) {
+        c->buf = small;
+        return;
+    }
+
+    /* 스레드 수: 1, 2, 4, ... 와 CPU 수 */
+    c->len = TUNE_THREAD_LEN;
+    c->threads = 1;
+    double best = tune_measure(tune_run_cbc_dec, c);
+    for (int n = 2;; n *= 2) {
+        if (n > ncpu) n = ncpu;
+        c->threads = n;
+        double d = tune_measure(tune_run_cbc_dec, c);
+        if (d < best * TUNE_GAIN) {
+            best = d;
+            t->threads = n;
+        }
+        if (n == ncpu) break;
+    }
+
+    /* 분할 크기: 두 스레드로 나눈 것이 한 스레드보다 확실히 빨라지는 가장 작은 구간 크기 */
+    if (t->threads > 1) {
+        for (size_t split = 32 * 1024; split <= TUNE_THREAD_LEN / 2; split *= 2) {
+            c->len = 2 * split;
+            c->threads = 1;
+            double one = tune_measure(tune_run_cbc_dec, c);
+            c->threads = 2;
+            double two = tune_measure(tune_run_cbc_dec, c);
+            if (two < one * TUNE_GAIN) {
+                t->split_bytes = split;
+                break;
+            }
+        }
+    }
+
+    free(c->buf);
+    c->buf = small;
+    c->len = small_len;
+}
+
+static void tune_apply(const AES256_TUNE* t) {
+    AES256_SetImpl(t->impl);
+    AES256_SetInterleave(t->interleave);
+    AES256_SetThreads(t->threads);
+    AES256_SetSplitSize(t->split_bytes);
+}
+
+/**
+ * @brief 캐시가 유효하면 그 설정을, 아니면 측정한 설정을 프로세스 전역으로 적용함
+ * @details 전역 설정을 바꾸므로 다른 스레드가 암복호화를 시작하기 전에 호출할 것
+ * @return 성공 시 0, 인자 오류 -1, 설정은 적용했으나 캐시를 쓰지 못하면 -4
+ */
+int AES256_Autotune(const char* cache_path, int flags, AES256_TUNE* result) {
+    if (flags & ~(AES256_TUNE_FORCE | AES256_TUNE_ALLOW_TABLES | AES256_TUNE_NO_SAVE)) return -1;
+
+    char path[4096];
+    int have_path = 1;
+    if (cache_path != NULL) {
+        if (snprintf(path, sizeof(path), "%s", cache_path) >= (int)sizeof(path)) return -1;
+    } else if (tune_default_path(path, sizeof(path)) != 0) {
+        have_path = 0;
+    }
+
+    AES256_TUNE t;
+    memset(&t, 0, sizeof(t));
+    if (have_path && !(flags & AES256_TUNE_FORCE) && tune_load(path, flags, &t) == 0) {
+        t.from_cache = 1;
+        tune_apply(&t);
+        if (result != NULL) *result = t;
+        return 0;
+    }
+
+    /* 측정 (키와 데이터 내용은 속도에 영향이 없으므로 고정값) */
+    tune_ctx_t c;
+    memset(&c, 0, sizeof(c));
+    c.len = TUNE_BLOCK_LEN;
+    c.buf = (uint8_t*)calloc(1, TUNE_BLOCK_LEN);
+    if (c.buf == NULL) return -4;
+    uint8_t key[32];
+    for (int i = 0; i < 32; i++) key[i] = (uint8_t)(i * 7 + 1);
+    KeyExpansion(c.RoundKey, key);
+
+    double start = tune_now_ns();
+    tune_pick_backend(&c, flags, &t);
+    tune_pick_threads(&c, &t);
+    t.tune_ms = (tune_now_ns() - start) / 1e6;
+    free(c.buf);
+
+    tune_apply(&t);
+    if (result != NULL) *result = t;
+    if (flags & AES256_TUNE_NO_SAVE) return 0;
+    return have_path ? tune_save(path, flags, &t) : -4;
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+/**
+ * @brief ASE256_AUTOTUNE=1이면 시작 시 자동 조정 (ase256.c의 기본 백엔드 선택 이후에 실행됨)
+ */
+__attribute__((constructor))
+static void aes256_tune_at_start(void) {
+    const char* v = secure_getenv("ASE256_AUTOTUNE");
+    if (v != NULL && strcmp(v, "1") == 0) AES256_Autotune(NULL, 0, NULL);
+}
+#endif
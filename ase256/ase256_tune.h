@@ -0,0 +1,46 @@
+/*
+ * ase256_tune.h
+ * - 실행 중인 머신에서 백엔드, 교차 폭, 스레드 수, 스레드당 분할 크기를 짧게 측정해 고르는 자동 조정
+ *
+ * 동작 방식:
+ * - 캐시 파일이 있고 같은 CPU(CPUID 이름/모델, 온라인 CPU 수)에서 만든 것이면 측정 없이 바로 적용합니다.
+ * - 없거나 맞지 않으면 사용 가능한 백엔드를 측정(약 0.1~0.5초)하여 가장 빠른 설정을 적용하고
+ *   캐시 파일에 저장합니다 (임시 파일에 쓴 뒤 rename하므로 동시에 여러 프로세스가 써도 안전).
+ * - 기본 후보는 블록 암호와 키 스케줄이 상수 시간인 구현(AES-NI, 비트슬라이스)뿐입니다.
+ *   비트슬라이스는 키 스케줄의 SubWord/InvMixColumns도 논리 회로로 계산합니다.
+ *   테이블 조회 구현(T-table, 참조)은 캐시 타이밍 공격에 취약하므로 AES256_TUNE_ALLOW_TABLES를 줄 때만 후보에 넣습니다.
+ * - 설정은 원자적으로 바뀌므로 다른 스레드가 암복호화 중이어도 호출할 수 있습니다.
+ *   측정하는 동안 백엔드가 잠시 바뀌지만, 각 호출은 시작할 때 읽은 백엔드로 끝까지 처리합니다.
+ * - 환경 변수 ASE256_AUTOTUNE=1이면 프로그램 시작 시 자동으로 AES256_Autotune(NULL, 0, NULL)을 호출합니다.
+ *
+ * 캐시 파일 위치 (cache_path가 NULL일 때): $ASE256_TUNE_FILE, $XDG_CACHE_HOME/ase256-tune,
+ * $HOME/.cache/ase256-tune 순서
+ *
+ * 반환값: 0 성공, -1 인자 오류, -4 설정은 적용했으나 캐시 파일을 쓰지 못함
+ */
+
+#ifndef ASE256_TUNE_H
+#define ASE256_TUNE_H
+
+#include <stddef.h>
+#include "ase256.h"
+
+#define AES256_TUNE_FORCE        1  /* 캐시를 무시하고 다시 측정 */
+#define AES256_TUNE_ALLOW_TABLES 2  /* 상수 시간이 아닌 T-table/참조 구현도 후보에 넣음 */
+#define AES256_TUNE_NO_SAVE      4  /* 측정 결과를 캐시 파일에 쓰지 않음 */
+
+/* 적용된 설정과 측정 정보 */
+typedef struct {
+    aes256_impl_t impl;
+    int interleave;
+    int threads;
+    size_t split_bytes;
+    int from_cache;         /* 1이면 캐시 파일에서 읽음 (측정 안 함) */
+    double tune_ms;         /* 측정에 걸린 시간 (캐시 적중이면 0) */
+    double mbps;            /* 선택된 백엔드/교차 폭의 단일 스레드 처리량 (CTR + CBC 복호화 평균) */
+} AES256_TUNE;
+
+/* result는 NULL 가능 */
+int AES256_Autotune(const char* cache_path, int flags, AES256_TUNE* result);
+
+#endif // ASE256_TUNE_H
@@ -0,0 +1,804 @@
+/*
+ * bench_ase256.c
+ * - AES-256 백엔드/운영 모드별 성능 측정 도구 (make bench)
+ *
+ * 사용 방법:
+ *   bench_ase256 [--backend 이름,...] [--mode 이름,...] [--sizes 크기,...] [--max-size 크기]
+ *                [--threads 수,...] [--trials 수] [--budget 초] [--json 파일]
+ *
+ * - 크기는 바이트 단위이며 K/M/G 접미사를 허용 (기본: 16B부터 4배씩 --max-size까지)
+ * - 설정마다 워밍업 후 반복 횟수를 보정하여 한 시행이 수 ms 이상 걸리게 만들고,
+ *   시행을 여러 번 반복해 중앙값과 p99를 구함 (시행당 ns/op → MB/s, cycles/byte)
+ * - cycles는 x86의 TSC 값으로, 실제 코어 클럭이 아닌 TSC 기준 주파수의 사이클 수임
+ * - --json을 지정하면 빌드 정보와 전체 결과를 JSON으로 저장 (빌드 간 비교/회귀 확인용)
+ * - ASan 없이 최적화 옵션으로 빌드해야 의미 있는 수치가 나옴 (Makefile의 bench 대상)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/random.h>
+#include "ase256.h"
+#include "ase256_async.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+static inline unsigned long long bench_cycles(void) { return __rdtsc(); }
+#else
+#define BENCH_HAVE_TSC 0
+static inline unsigned long long bench_cycles(void) { return 0; }
+#endif
+
+#ifndef BENCH_BUILD_FLAGS
+#define BENCH_BUILD_FLAGS ""
+#endif
+
+#define BENCH_MAX_TRIALS   1000
+#define BENCH_MAX_LIST     32
+#define BENCH_MULTI_MSG    64          /* cbc-multi의 메시지 하나 크기 */
+#define BENCH_XTS_SECTOR   4096        /* XTS 섹터 크기 (메시지가 더 작으면 메시지 전체가 섹터 하나) */
+
+static const uint8_t bench_key[32] = {
+    0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe, 0x2b, 0x73, 0xae, 0xf0, 0x85, 0x7d, 0x77, 0x81,
+    0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61, 0x08, 0xd7, 0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4
+};
+static const uint8_t bench_iv[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+
+/* 측정 중인 설정 하나의 상태 (모드의 setup/run/teardown이 공유) */
+typedef struct {
+    uint8_t* buf;               /* 측정 대상 데이터 (size바이트) */
+    size_t size;
+    int threads;
+    uint8_t round_key[AES256_ROUNDKEY_SIZE];
+    uint8_t round_key2[AES256_ROUNDKEY_SIZE]; /* XTS tweak 키 / CMAC 키 */
+    uint8_t tags[2][16];        /* gcm-dec용: 암호문/평문 양쪽 방향의 태그 */
+    unsigned long long count;   /* run 호출 횟수 (gcm-dec 방향 전환용) */
+    AES256_KEY key;             /* *-key 모드용 (복호화 라운드 키 포함) */
+    AES256_KEY_CACHE* cache;
+    AES256_CBC_JOB* jobs;
+    size_t njobs;
+    AES256_ASYNC* async;        /* async 모드의 서비스와 작업 배열 */
+    AES256_ASYNC_JOB* async_jobs;
+    uint8_t* out;               /* iovec 모드의 별도 출력 버퍼 */
+    struct iovec iov[3];
+    int error;                  /* run이 실패를 보고하면 1 */
+} bench_state_t;
+
+/* 측정 모드 (새 운영 모드를 추가할 때는 bench_modes 표에 한 줄 추가) */
+typedef struct {
+    const char* name;
+    size_t unit;                /* 0이면 데이터 크기와 무관한 측정 (키 설정 등), 아니면 크기가 이 값의 배수여야 함 */
+    size_t max_size;            /* 0이면 제한 없음 */
+    int threaded;               /* 스레드 수 목록을 적용할지 여부 */
+    int (*setup)(bench_state_t* st);
+    void (*run)(bench_state_t* st);
+    void (*teardown)(bench_state_t* st);
+} bench_mode_t;
+
+/* 측정 결과 한 건 */
+typedef struct {
+    const char* backend;
+    const char* mode;
+    size_t size;
+    int threads;
+    unsigned long long reps;    /* 시행당 run 호출 횟수 */
+    int trials;
+    double median_ns;           /* run 1회당 */
+    double p99_ns;
+    double min_ns;
+    double median_cycles;       /* run 1회당, TSC가 없으면 0 */
+} bench_result_t;
+
+typedef struct {
+    const char* backends[BENCH_MAX_LIST];
+    int nbackends;
+    const char* modes[BENCH_MAX_LIST];
+    int nmodes;
+    size_t sizes[BENCH_MAX_LIST];
+    int nsizes;
+    size_t max_size;
+    int threads[BENCH_MAX_LIST];
+    int nthreads;
+    int trials;
+    double budget;              /* 설정 하나에 쓸 측정 시간 (초), 최소 3회 시행은 보장 */
+    const char* json_path;
+} bench_opts_t;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* ---------------------------------------------------------------------------
+ * 측정 모드
+ * ------------------------------------------------------------------------- */
+
+static int setup_key(bench_state_t* st) {
+    return KeyExpansion(st->round_key, bench_key);
+}
+
+static void run_keysetup_enc(bench_state_t* st) {
+    if (KeyExpansion(st->round_key, bench_key) != 0) st->error = 1;
+}
+
+/* 복호화 키 설정 = 라운드 키 확장 + 역 라운드 키 변환 (스트리밍 복호화 초기화 비용) */
+static void run_keysetup_dec(bench_state_t* st) {
+    AES256_CBC_CTX ctx;
+    if (AES256_CBC_DecryptInit(&ctx, bench_key, bench_iv) != 0) st->error = 1;
+    AES256_CBC_Cleanup(&ctx);
+}
+
+/* 캐시 적중 시 키 조회 비용 (키 ID 64개를 돌아가며 조회) */
+static int setup_keycache(bench_state_t* st) {
+    st->cache = AES256_KeyCacheCreate(64);
+    if (st->cache == NULL) return -1;
+    for (uint64_t id = 0; id < 64; id++) {
+        AES256_KeyCacheRelease(st->cache, AES256_KeyCacheAcquire(st->cache, id, bench_key));
+    }
+    st->count = 0;
+    return 0;
+}
+
+static void run_keycache_hit(bench_state_t* st) {
+    const AES256_KEY* k = AES256_KeyCacheAcquire(st->cache, st->count++ & 63, bench_key);
+    if (k == NULL) st->error = 1;
+    AES256_KeyCacheRelease(st->cache, k);
+}
+
+static void teardown_keycache(bench_state_t* st) {
+    AES256_KeyCacheDestroy(st->cache);
+    st->cache = NULL;
+}
+
+static int setup_key_sched(bench_state_t* st) {
+    return AES256_KeyInit(&st->key, bench_key);
+}
+
+/* 블록 단위 API를 블록마다 호출 (호출 오버헤드를 포함한 단일 블록 처리 속도) */
+static void run_block_enc(bench_state_t* st) {
+    for (size_t off = 0; off < st->size; off += 16) AES256_EncryptBlock(st->buf + off, st->round_key);
+}
+
+static void run_block_dec(bench_state_t* st) {
+    for (size_t off = 0; off < st->size; off += 16) AES256_DecryptBlock(st->buf + off, st->round_key);
+}
+
+static void run_block_dec_key(bench_state_t* st) {
+    for (size_t off = 0; off < st->size; off += 16) AES256_DecryptBlock_Key(st->buf + off, &st->key);
+}
+
+static void run_cbc_enc(bench_state_t* st) {
+    if (AES256_CBC_Encrypt(st->buf, st->size, st->round_key, bench_iv) != 0) st->error = 1;
+}
+
+static void run_cbc_dec(bench_state_t* st) {
+    if (AES256_CBC_Decrypt_MT(st->buf, st->size, st->round_key, bench_iv, st->threads) != 0) st->error = 1;
+}
+
+static void run_cbc_dec_key(bench_state_t* st) {
+    if (AES256_CBC_Decrypt_Key(st->buf, st->size, &st->key, bench_iv) != 0) st->error = 1;
+}
+
+static void run_ctr(bench_state_t* st) {
+    if (AES256_CTR_Crypt(st->buf, st->size, st->round_key, bench_iv, 0) != 0) st->error = 1;
+}
+
+static void run_gcm_enc(bench_state_t* st) {
+    if (AES256_GCM_Encrypt(st->buf, st->size, NULL, 0, st->round_key, bench_iv, 12, st->tags[0]) != 0) st->error = 1;
+}
+
+/*
+ * 헤더(13바이트)/본문/트레일러(19바이트) 세 조각으로 된 메시지를 별도 버퍼로 암호화:
+ * cbc-gather는 한 버퍼로 모은 뒤 암호화, cbc-enc-iov는 AES256_CBC_EncryptV로 바로 처리
+ */
+static int setup_iov(bench_state_t* st) {
+    if (setup_key(st) != 0) return -1;
+    st->out = (uint8_t*)malloc(st->size);
+    if (st->out == NULL) return -1;
+    st->iov[0] = (struct iovec){ st->buf, 13 };
+    st->iov[1] = (struct iovec){ st->buf + 13, st->size - 32 };
+    st->iov[2] = (struct iovec){ st->buf + st->size - 19, 19 };
+    return 0;
+}
+
+static void run_cbc_gather(bench_state_t* st) {
+    size_t pos = 0;
+    for (int i = 0; i < 3; i++) {
+        memcpy(st->out + pos, st->iov[i].iov_base, st->iov[i].iov_len);
+        pos += st->iov[i].iov_len;
+    }
+    if (AES256_CBC_Encrypt(st->out, st->size, st->round_key, bench_iv) != 0) st->error = 1;
+}
+
+static void run_cbc_enc_iov(bench_state_t* st) {
+    struct iovec dst = { st->out, st->size };
+    if (AES256_CBC_EncryptV(st->iov, 3, &dst, 1, st->round_key, bench_iv) != 0) st->error = 1;
+}
+
+static void teardown_iov(bench_state_t* st) {
+    free(st->out);
+    st->out = NULL;
+}
+
+/*
+ * 암호화 + MAC: cbc+cmac/ctr+cmac는 암호화 후 AES256_CMAC으로 한 번 더 읽는 2패스,
+ * ctr-cmac은 AES256_CTR_CMAC_Encrypt 한 패스 (round_key2 = MAC 키)
+ */
+static void run_cbc_cmac(bench_state_t* st) {
+    if (AES256_CBC_Encrypt(st->buf, st->size, st->round_key, bench_iv) != 0 ||
+        AES256_CMAC(st->buf, st->size, st->round_key2, st->tags[0]) != 0) {
+        st->error = 1;
+    }
+}
+
+static void run_ctr_cmac_2pass(bench_state_t* st) {
+    if (AES256_CTR_Crypt(st->buf, st->size, st->round_key, bench_iv, 0) != 0 ||
+        AES256_CMAC(st->buf, st->size, st->round_key2, st->tags[0]) != 0) {
+        st->error = 1;
+    }
+}
+
+static void run_ctr_cmac(bench_state_t* st) {
+    if (AES256_CTR_CMAC_Encrypt(st->buf, st->size, st->round_key, st->round_key2, bench_iv, st->tags[0]) != 0) {
+        st->error = 1;
+    }
+}
+
+/*
+ * IV 생성: rand-ivs는 AES256_RandomIVs 한 번으로 size / 16개, rand-iv1은 IV마다 한 번씩 호출,
+ * getrandom-iv1은 IV마다 시스템 호출을 하는 기존 방식 (비교 기준)
+ */
+static void run_rand_ivs(bench_state_t* st) {
+    if (AES256_RandomIVs(st->buf, st->size / 16) != 0) st->error = 1;
+}
+
+static void run_rand_iv1(bench_state_t* st) {
+    for (size_t off = 0; off < st->size; off += 16) {
+        if (AES256_RandomIVs(st->buf + off, 1) != 0) st->error = 1;
+    }
+}
+
+static void run_getrandom_iv1(bench_state_t* st) {
+    for (size_t off = 0; off < st->size; off += 16) {
+        if (getrandom(st->buf + off, 16, 0) != 16) st->error = 1;
+    }
+}
+
+/* XTS: 메시지를 4KB 섹터로 나누어 스레드 수 목록에 따라 병렬 처리 */
+static int setup_xts(bench_state_t* st) {
+    uint8_t key2[32];
+    for (int i = 0; i < 32; i++) key2[i] = (uint8_t)(bench_key[i] ^ 0x5a);
+    if (setup_key(st) != 0) return -1;
+    return KeyExpansion(st->round_key2, key2);
+}
+
+static void run_xts(bench_state_t* st, int encrypt) {
+    size_t sector = (st->size < BENCH_XTS_SECTOR) ? st->size : BENCH_XTS_SECTOR;
+    int rc = encrypt ? AES256_XTS_EncryptSectors(st->buf, sector, st->size / sector, st->round_key,
+                                                 st->round_key2, 0, st->threads)
+                     : AES256_XTS_DecryptSectors(st->buf, sector, st->size / sector, st->round_key,
+                                                 st->round_key2, 0, st->threads);
+    if (rc != 0) st->error = 1;
+}
+
+static void run_xts_enc(bench_state_t* st) { run_xts(st, 1); }
+static void run_xts_dec(bench_state_t* st) { run_xts(st, 0); }
+
+/*
+ * GCM 복호화는 같은 버퍼를 반복해서 처리하면 두 번째부터 인증 실패 경로를 타므로,
+ * CTR이 자기 역함수라는 점을 이용해 C → P → C로 방향을 바꾸어 가며 매번 올바른 태그를 넘김
+ */
+static int setup_gcm_dec(bench_state_t* st) {
+    if (setup_key(st) != 0) return -1;
+    /* buf = P 에서 시작: P를 암호화하면 C와 C의 태그, C를 다시 암호화하면 P와 P의 태그 */
+    AES256_GCM_Encrypt(st->buf, st->size, NULL, 0, st->round_key, bench_iv, 12, st->tags[0]);
+    AES256_GCM_Encrypt(st->buf, st->size, NULL, 0, st->round_key, bench_iv, 12, st->tags[1]);
+    /* 다시 C로 되돌림 (P를 암호화하면 C) */
+    AES256_GCM_Encrypt(st->buf, st->size, NULL, 0, st->round_key, bench_iv, 12, st->tags[0]);
+    st->count = 0;
+    return 0;
+}
+
+static void run_gcm_dec(bench_state_t* st) {
+    const uint8_t* tag = st->tags[st->count++ & 1];
+    if (AES256_GCM_Decrypt(st->buf, st->size, NULL, 0, st->round_key, bench_iv, 12, tag) != 0) st->error = 1;
+}
+
+/* 64바이트 메시지 여러 개를 다중 버퍼 API 한 번으로 암호화 */
+static int setup_cbc_multi(bench_state_t* st) {
+    if (setup_key(st) != 0) return -1;
+    st->njobs = st->size / BENCH_MULTI_MSG;
+    st->jobs = (AES256_CBC_JOB*)malloc(st->njobs * sizeof(AES256_CBC_JOB));
+    if (st->jobs == NULL) return -1;
+    for (size_t j = 0; j < st->njobs; j++) {
+        st->jobs[j] = (AES256_CBC_JOB){ .buf = st->buf + j * BENCH_MULTI_MSG, .len = BENCH_MULTI_MSG,
+                                        .RoundKey = st->round_key, .iv = bench_iv };
+    }
+    return 0;
+}
+
+static void run_cbc_multi(bench_state_t* st) {
+    if (AES256_CBC_Encrypt_Multi(st->jobs, st->njobs) != 0) st->error = 1;
+}
+
+/* 비교 기준: 같은 메시지들을 메시지마다 AES256_CBC_Encrypt로 처리 */
+static void run_cbc_single(bench_state_t* st) {
+    for (size_t off = 0; off + BENCH_MULTI_MSG <= st->size; off += BENCH_MULTI_MSG) {
+        AES256_CBC_Encrypt(st->buf + off, BENCH_MULTI_MSG, st->round_key, bench_iv);
+    }
+}
+
+static void teardown_cbc_multi(bench_state_t* st) {
+    free(st->jobs);
+    st->jobs = NULL;
+    st->njobs = 0;
+}
+
+/* 같은 64바이트 메시지들을 비동기 서비스에 모두 제출한 뒤 완료를 기다림 (워커 수 = 스레드 수) */
+static int setup_async_cbc(bench_state_t* st) {
+    if (setup_key(st) != 0) return -1;
+    AES256_ASYNC_CONFIG cfg = { .workers = st->threads };
+    st->njobs = st->size / BENCH_MULTI_MSG;
+    st->async = AES256_AsyncCreate(&cfg);
+    if (st->async == NULL) goto fail;
+    st->async_jobs = (AES256_ASYNC_JOB*)calloc(st->njobs, sizeof(AES256_ASYNC_JOB));
+    if (st->async_jobs == NULL) goto fail;
+    for (size_t j = 0; j < st->njobs; j++) {
+        AES256_ASYNC_JOB* job = &st->async_jobs[j];
+        job->op = AES256_ASYNC_CBC_ENCRYPT;
+        job->buf = st->buf + j * BENCH_MULTI_MSG;
+        job->len = BENCH_MULTI_MSG;
+        job->RoundKey = st->round_key;
+        memcpy(job->iv, bench_iv, 16);
+    }
+    return 0;
+
+fail:
+    /* 준비 실패 시 bench_measure가 teardown을 부르지 않으므로 여기서 모두 해제 */
+    AES256_AsyncDestroy(st->async);
+    free(st->async_jobs);
+    st->async = NULL;
+    st->async_jobs = NULL;
+    st->njobs = 0;
+    return -1;
+}
+
+static void run_async_cbc(bench_state_t* st) {
+    for (size_t j = 0; j < st->njobs; j++) {
+        if (AES256_AsyncSubmit(st->async, &st->async_jobs[j]) != 0) st->error = 1;
+    }
+    AES256_AsyncDrain(st->async);
+}
+
+static void teardown_async_cbc(bench_state_t* st) {
+    AES256_AsyncDestroy(st->async);
+    free(st->async_jobs);
+    st->async = NULL;
+    st->async_jobs = NULL;
+    st->njobs = 0;
+}
+
+static const bench_mode_t bench_modes[] = {
+    { "keysetup-enc",  0,                0,                  0, NULL,             run_keysetup_enc,   NULL },
+    { "keysetup-dec",  0,                0,                  0, NULL,             run_keysetup_dec,   NULL },
+    { "keycache-hit",  0,                0,                  0, setup_keycache,   run_keycache_hit,   teardown_keycache },
+    { "block-enc",     16,               0,                  0, setup_key,        run_block_enc,      NULL },
+    { "block-dec",     16,               0,                  0, setup_key,        run_block_dec,      NULL },
+    { "block-dec-key", 16,               0,                  0, setup_key_sched,  run_block_dec_key,  NULL },
+    { "cbc-enc",       16,               0,                  0, setup_key,        run_cbc_enc,        NULL },
+    { "cbc-dec",       16,               0,                  1, setup_key,        run_cbc_dec,        NULL },
+    { "cbc-dec-key",   16,               0,                  0, setup_key_sched,  run_cbc_dec_key,    NULL },
+    { "cbc-gather",    64,               0,                  0, setup_iov,        run_cbc_gather,     teardown_iov },
+    { "cbc-enc-iov",   64,               0,                  0, setup_iov,        run_cbc_enc_iov,    teardown_iov },
+    { "ctr",           1,                0,                  0, setup_key,        run_ctr,            NULL },
+    { "gcm-enc",       1,                0,                  0, setup_key,        run_gcm_enc,        NULL },
+    { "gcm-dec",       1,                0,                  0, setup_gcm_dec,    run_gcm_dec,        NULL },
+    { "cbc+cmac",      16,               0,                  0, setup_xts,        run_cbc_cmac,       NULL },
+    { "ctr+cmac",      1,                0,                  0, setup_xts,        run_ctr_cmac_2pass, NULL },
+    { "ctr-cmac",      1,                0,                  0, setup_xts,        run_ctr_cmac,       NULL },
+    { "rand-ivs",      16,               0,                  0, NULL,             run_rand_ivs,       NULL },
+    { "rand-iv1",      16,               0,                  0, NULL,             run_rand_iv1,       NULL },
+    { "getrandom-iv1", 16,               1024 * 1024,        0, NULL,             run_getrandom_iv1,  NULL },
+    { "xts-enc",       16,               0,                  1, setup_xts,        run_xts_enc,        NULL },
+    { "xts-dec",       16,               0,                  1, setup_xts,        run_xts_dec,        NULL },
+    { "cbc-single64",  BENCH_MULTI_MSG,  64 * 1024 * 1024,   0, setup_key,        run_cbc_single,     NULL },
+    { "cbc-multi64",   BENCH_MULTI_MSG,  64 * 1024 * 1024,   0, setup_cbc_multi,  run_cbc_multi,      teardown_cbc_multi },
+    { "async-cbc64",   BENCH_MULTI_MSG,  64 * 1024 * 1024,   1, setup_async_cbc,  run_async_cbc,      teardown_async_cbc },
+};
+
+#define BENCH_NMODES (sizeof(bench_modes) / sizeof(bench_modes[0]))
+
+/* ---------------------------------------------------------------------------
+ * 측정 루프
+ * ------------------------------------------------------------------------- */
+
+static int cmp_double(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/* 정렬된 표본에서 nearest-rank 방식의 백분위수 */
+static double percentile(const double* sorted, int n, double p) {
+    int rank = (int)(p / 100.0 * n + 0.999999);
+    if (rank < 1) rank = 1;
+    if (rank > n) rank = n;
+    return sorted[rank - 1];
+}
+
+/**
+ * @brief 설정 하나를 워밍업, 반복 횟수 보정, 반복 시행 순서로 측정함
+ * @return 성공 시 0, 준비 실패나 API 오류 시 -1
+ */
+static int bench_measure(const bench_mode_t* m, bench_state_t* st, const bench_opts_t* o, bench_result_t* r) {
+    static double ns[BENCH_MAX_TRIALS], cyc[BENCH_MAX_TRIALS];
+    const double trial_target = 2e6;     /* 시행 하나의 목표 시간 (2ms) */
+    const double warmup_target = 20e6;   /* 워밍업 시간 (20ms) */
+
+    st->error = 0;
+    if (m->setup != NULL && m->setup(st) != 0) return -1;
+
+    /* 워밍업: 캐시/TLB/분기 예측기와 CPU 클럭을 안정시킴 (최소 1회) */
+    double t0 = now_ns(), elapsed;
+    unsigned long long runs = 0;
+    do {
+        m->run(st);
+        runs++;
+        elapsed = now_ns() - t0;
+    } while (elapsed < warmup_target);
+
+    /* 시행 하나가 trial_target 이상 걸리도록 반복 횟수를 정함 */
+    double per_run = elapsed / (double)runs;
+    unsigned long long reps = (unsigned long long)(trial_target / per_run) + 1;
+
+    int trials = 0;
+    double start = now_ns();
+    while (trials < o->trials && trials < BENCH_MAX_TRIALS) {
+        unsigned long long c0 = bench_cycles();
+        double a = now_ns();
+        for (unsigned long long i = 0; i < reps; i++) m->run(st);
+        double b = now_ns();
+        unsigned long long c1 = bench_cycles();
+
+        ns[trials] = (b - a) / (double)reps;
+        cyc[trials] = (double)(c1 - c0) / (double)reps;
+        trials++;
+        if (trials >= 3 && b - start > o->budget * 1e9) break;
+    }
+
+    if (m->teardown != NULL) m->teardown(st);
+    if (st->error) return -1;
+
+    qsort(ns, (size_t)trials, sizeof(double), cmp_double);
+    qsort(cyc, (size_t)trials, sizeof(double), cmp_double);
+    r->reps = reps;
+    r->trials = trials;
+    r->median_ns = percentile(ns, trials, 50.0);
+    r->p99_ns = percentile(ns, trials, 99.0);
+    r->min_ns = ns[0];
+    r->median_cycles = BENCH_HAVE_TSC ? percentile(cyc, trials, 50.0) : 0.0;
+    return 0;
+}
+
+/* ---------------------------------------------------------------------------
+ * 출력
+ * ------------------------------------------------------------------------- */
+
+static void format_size(char* out, size_t cap, size_t size) {
+    if (size >= (1u << 30) && size % (1u << 30) == 0) snprintf(out, cap, "%zuG", size >> 30);
+    else if (size >= (1u << 20) && size % (1u << 20) == 0) snprintf(out, cap, "%zuM", size >> 20);
+    else if (size >= (1u << 10) && size % (1u << 10) == 0) snprintf(out, cap, "%zuK", size >> 10);
+    else snprintf(out, cap, "%zu", size);
+}
+
+static void print_result(const bench_result_t* r) {
+    char sz[32];
+    if (r->size == 0) {
+        /* 크기와 무관한 측정은 1회당 시간/사이클로 표시 */
+        printf("%-9s %-13s %6s %3d %12.1f %12.1f %10s %10.0f cyc/op\n", r->backend, r->mode, "-", r->threads,
+               r->median_ns, r->p99_ns, "-", r->median_cycles);
+        return;
+    }
+    format_size(sz, sizeof(sz), r->size);
+    double mbps = (double)r->size / r->median_ns * 1e3;
+    printf("%-9s %-13s %6s %3d %12.1f %12.1f %10.1f", r->backend, r->mode, sz, r->threads,
+           r->median_ns, r->p99_ns, mbps);
+    if (BENCH_HAVE_TSC) printf(" %10.2f cyc/B\n", r->median_cycles / (double)r->size);
+    else printf(" %10s\n", "-");
+}
+
+static void json_string(FILE* fp, const char* s) {
+    fputc('"', fp);
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') fputc('\\', fp);
+        if ((unsigned char)*s < 0x20) continue;
+        fputc(*s, fp);
+    }
+    fputc('"', fp);
+}
+
+static void cpu_model(char* out, size_t cap) {
+    snprintf(out, cap, "unknown");
+    FILE* fp = fopen("/proc/cpuinfo", "r");
+    if (fp == NULL) return;
+    char line[256];
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        if (strncmp(line, "model name", 10) == 0) {
+            char* p = strchr(line, ':');
+            if (p != NULL) {
+                p++;
+                while (*p == ' ') p++;
+                p[strcspn(p, "\n")] = '\0';
+                snprintf(out, cap, "%s", p);
+            }
+            break;
+        }
+    }
+    fclose(fp);
+}
+
+/**
+ * @brief 빌드/실행 환경과 측정 결과 전체를 JSON 파일로 저장함
+ * @return 성공 시 0, 파일 오류 시 -1
+ */
+static int write_json(const char* path, const bench_result_t* res, size_t nres) {
+    FILE* fp = fopen(path, "w");
+    if (fp == NULL) return -1;
+
+    char cpu[200], date[64];
+    time_t now = time(NULL);
+    struct tm tm;
+    gmtime_r(&now, &tm);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", &tm);
+    cpu_model(cpu, sizeof(cpu));
+
+    fprintf(fp, "{\n  \"meta\": {\n    \"date\": ");
+    json_string(fp, date);
+    fprintf(fp, ",\n    \"compiler\": ");
+#ifdef __VERSION__
+    json_string(fp, __VERSION__);
+#else
+    json_string(fp, "unknown");
+#endif
+    fprintf(fp, ",\n    \"cflags\": ");
+    json_string(fp, BENCH_BUILD_FLAGS);
+    fprintf(fp, ",\n    \"cpu\": ");
+    json_string(fp, cpu);
+    fprintf(fp, ",\n    \"online_cpus\": %ld,\n    \"cycle_counter\": \"%s\",\n    \"default_backend\": ",
+            sysconf(_SC_NPROCESSORS_ONLN), BENCH_HAVE_TSC ? "tsc" : "none");
+    json_string(fp, AES256_ImplName(AES256_GetImpl()));
+    fprintf(fp, ",\n    \"mb\": 1000000\n  },\n  \"results\": [\n");
+
+    for (size_t i = 0; i < nres; i++) {
+        const bench_result_t* r = &res[i];
+        fprintf(fp, "    {\"backend\": ");
+        json_string(fp, r->backend);
+        fprintf(fp, ", \"mode\": ");
+        json_string(fp, r->mode);
+        fprintf(fp, ", \"size\": %zu, \"threads\": %d, \"reps\": %llu, \"trials\": %d, "
+                    "\"median_ns\": %.3f, \"p99_ns\": %.3f, \"min_ns\": %.3f, ",
+                r->size, r->threads, r->reps, r->trials, r->median_ns, r->p99_ns, r->min_ns);
+        if (r->size > 0) fprintf(fp, "\"mb_per_s\": %.3f, ", (double)r->size / r->median_ns * 1e3);
+        else fprintf(fp, "\"mb_per_s\": null, ");
+        if (!BENCH_HAVE_TSC) fprintf(fp, "\"cycles_per_op\": null, \"cycles_per_byte\": null}");
+        else if (r->size > 0) fprintf(fp, "\"cycles_per_op\": %.1f, \"cycles_per_byte\": %.4f}",
+                                      r->median_cycles, r->median_cycles / (double)r->size);
+        else fprintf(fp, "\"cycles_per_op\": %.1f, \"cycles_per_byte\": null}", r->median_cycles);
+        fprintf(fp, "%s\n", i + 1 < nres ? "," : "");
+    }
+    fprintf(fp, "  ]\n}\n");
+    return fclose(fp) == 0 ? 0 : -1;
+}
+
+/* ---------------------------------------------------------------------------
+ * 명령행 처리
+ * ------------------------------------------------------------------------- */
+
+static void usage(void) {
+    fprintf(stderr,
+            "사용법: bench_ase256 [옵션]\n"
+            "  --backend 이름,...   측정할 백엔드 (ref, ttable, aesni, bitslice / 기본: 사용 가능한 전체)\n"
+            "  --mode 이름,...      측정할 모드 (기본: 전체)\n"
+            "  --sizes 크기,...     메시지 크기 목록 (K/M/G 접미사 허용)\n"
+            "  --max-size 크기      기본 크기 목록(16B부터 4배씩)의 상한 (기본 64M, 최대 1G)\n"
+            "  --threads 수,...     cbc-dec/xts/async에 적용할 스레드 수 목록 (기본: 1부터 2배씩 CPU 수까지)\n"
+            "  --trials 수          설정마다 최대 시행 횟수 (기본 31)\n"
+            "  --budget 초          설정마다 쓸 측정 시간, 최소 3회 시행은 보장 (기본 0.3)\n"
+            "  --json 파일          결과를 JSON으로 저장\n"
+            "모드:");
+    for (size_t i = 0; i < BENCH_NMODES; i++) fprintf(stderr, " %s", bench_modes[i].name);
+    fprintf(stderr, "\n");
+}
+
+static int parse_size(const char* s, size_t* out) {
+    char* end;
+    unsigned long long v = strtoull(s, &end, 10);
+    if (end == s) return -1;
+    if (*end == 'K' || *end == 'k') { v <<= 10; end++; }
+    else if (*end == 'M' || *end == 'm') { v <<= 20; end++; }
+    else if (*end == 'G' || *end == 'g') { v <<= 30; end++; }
+    if (*end != '\0' || v == 0 || v > (1ULL << 30)) return -1;
+    *out = (size_t)v;
+    return 0;
+}
+
+/* 쉼표로 구분된 목록을 잘라 items에 담음 (arg 문자열을 직접 수정함) */
+static int split_list(char* arg, const char** items, int cap) {
+    int n = 0;
+    for (char* tok = strtok(arg, ","); tok != NULL; tok = strtok(NULL, ",")) {
+        if (n == cap) return -1;
+        items[n++] = tok;
+    }
+    return n > 0 ? n : -1;
+}
+
+static int parse_args(int argc, char* argv[], bench_opts_t* o) {
+    const char* items[BENCH_MAX_LIST];
+    memset(o, 0, sizeof(*o));
+    o->max_size = 64u << 20;
+    o->trials = 31;
+    o->budget = 0.3;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc) return -1;
+        char* val = argv[++i];
+        const char* opt = argv[i - 1];
+        int n;
+        if (strcmp(opt, "--backend") == 0) {
+            if ((o->nbackends = split_list(val, o->backends, BENCH_MAX_LIST)) < 0) return -1;
+        } else if (strcmp(opt, "--mode") == 0) {
+            if ((o->nmodes = split_list(val, o->modes, BENCH_MAX_LIST)) < 0) return -1;
+        } else if (strcmp(opt, "--sizes") == 0) {
+            if ((n = split_list(val, items, BENCH_MAX_LIST)) < 0) return -1;
+            for (o->nsizes = 0; o->nsizes < n; o->nsizes++) {
+                if (parse_size(items[o->nsizes], &o->sizes[o->nsizes]) != 0) return -1;
+            }
+        } else if (strcmp(opt, "--max-size") == 0) {
+            if (parse_size(val, &o->max_size) != 0) return -1;
+        } else if (strcmp(opt, "--threads") == 0) {
+            if ((n = split_list(val, items, BENCH_MAX_LIST)) < 0) return -1;
+            for (o->nthreads = 0; o->nthreads < n; o->nthreads++) {
+                int t = atoi(items[o->nthreads]);
+                if (t < 1 || t > 64) return -1;
+                o->threads[o->nthreads] = t;
+            }
+        } else if (strcmp(opt, "--trials") == 0) {
+            o->trials = atoi(val);
+            if (o->trials < 3 || o->trials > BENCH_MAX_TRIALS) return -1;
+        } else if (strcmp(opt, "--budget") == 0) {
+            o->budget = atof(val);
+            if (o->budget <= 0.0) return -1;
+        } else if (strcmp(opt, "--json") == 0) {
+            o->json_path = val;
+        } else {
+            return -1;
+        }
+    }
+
+    if (o->nsizes == 0) {
+        for (size_t s = 16; s <= o->max_size && o->nsizes < BENCH_MAX_LIST; s *= 4) o->sizes[o->nsizes++] = s;
+    }
+    if (o->nthreads == 0) {
+        long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+        for (int t = 1; t <= ncpu && t <= 64 && o->nthreads < BENCH_MAX_LIST; t *= 2) o->threads[o->nthreads++] = t;
+        if (o->nthreads == 0) o->threads[o->nthreads++] = 1;
+    }
+    return 0;
+}
+
+static int name_selected(const char* name, const char* const* list, int n) {
+    if (n == 0) return 1;
+    for (int i = 0; i < n; i++) {
+        if (strcmp(name, list[i]) == 0) return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    bench_opts_t opts;
+    if (parse_args(argc, argv, &opts) != 0) {
+        usage();
+        return 1;
+    }
+    for (int i = 0; i < opts.nmodes; i++) {
+        int found = 0;
+        for (size_t m = 0; m < BENCH_NMODES; m++) found |= (strcmp(opts.modes[i], bench_modes[m].name) == 0);
+        if (!found) {
+            fprintf(stderr, "알 수 없는 모드: %s\n", opts.modes[i]);
+            usage();
+            return 1;
+        }
+    }
+
+    size_t buf_size = 16;
+    for (int i = 0; i < opts.nsizes; i++) {
+        if (opts.sizes[i] > buf_size) buf_size = opts.sizes[i];
+    }
+    uint8_t* buf = NULL;
+    if (posix_memalign((void**)&buf, 64, buf_size) != 0) {
+        fprintf(stderr, "메모리 할당 실패 (%zu 바이트)\n", buf_size);
+        return 1;
+    }
+    for (size_t i = 0; i < buf_size; i++) buf[i] = (uint8_t)i;
+
+    size_t cap = 256, nres = 0;
+    bench_result_t* res = (bench_result_t*)malloc(cap * sizeof(bench_result_t));
+    if (res == NULL) {
+        free(buf);
+        return 1;
+    }
+
+    aes256_impl_t default_impl = AES256_GetImpl();
+    int fails = 0;
+    printf("%-9s %-13s %6s %3s %12s %12s %10s %10s\n", "backend", "mode", "size", "thr", "median(ns)", "p99(ns)",
+           "MB/s", BENCH_HAVE_TSC ? "cycles" : "");
+
+    for (int impl = AES256_IMPL_AUTO + 1; impl < AES256_IMPL_COUNT; impl++) {
+        const char* bname = AES256_ImplName((aes256_impl_t)impl);
+        if (!name_selected(bname, opts.backends, opts.nbackends)) continue;
+        if (AES256_SetImpl((aes256_impl_t)impl) != 0) {
+            printf("%-9s (이 CPU에서 사용 불가, 건너뜀)\n", bname);
+            continue;
+        }
+
+        for (size_t m = 0; m < BENCH_NMODES; m++) {
+            const bench_mode_t* mode = &bench_modes[m];
+            if (!name_selected(mode->name, opts.modes, opts.nmodes)) continue;
+
+            int nsizes = (mode->unit == 0) ? 1 : opts.nsizes;
+            for (int si = 0; si < nsizes; si++) {
+                size_t size = (mode->unit == 0) ? 0 : opts.sizes[si];
+                if (mode->unit != 0 && (size % mode->unit != 0 || size < mode->unit)) continue;
+                if (mode->max_size != 0 && size > mode->max_size) continue;
+
+                int nthr = mode->threaded ? opts.nthreads : 1;
+                for (int ti = 0; ti < nthr; ti++) {
+                    bench_state_t st;
+                    memset(&st, 0, sizeof(st));
+                    st.buf = buf;
+                    st.size = size;
+                    st.threads = mode->threaded ? opts.threads[ti] : 1;
+
+                    bench_result_t r = { .backend = bname, .mode = mode->name, .size = size, .threads = st.threads };
+                    if (bench_measure(mode, &st, &opts, &r) != 0) {
+                        printf("%-9s %-13s %6zu: 측정 실패\n", bname, mode->name, size);
+                        fails++;
+                        continue;
+                    }
+                    print_result(&r);
+                    fflush(stdout);
+
+                    if (nres == cap) {
+                        bench_result_t* grown = (bench_result_t*)realloc(res, cap * 2 * sizeof(bench_result_t));
+                        if (grown == NULL) {
+                            fails++;
+                            continue;
+                        }
+                        res = grown;
+                        cap *= 2;
+                    }
+                    res[nres++] = r;
+                }
+            }
+        }
+    }
+    AES256_SetImpl(default_impl);
+
+    if (opts.json_path != NULL) {
+        if (write_json(opts.json_path, res, nres) != 0) {
+            fprintf(stderr, "%s: JSON 저장 실패\n", opts.json_path);
+            fails++;
+        } else {
+            printf("\n결과 %zu건을 %s에 저장했습니다.\n", nres, opts.json_path);
+        }
+    }
+
+    free(res);
+    free(buf);
+    return fails == 0 ? 0 : 1;
+}
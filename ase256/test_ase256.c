@@ -1,9 +1,14 @@
+#define _GNU_SOURCE /* ase256_async.c: sched_getcpu, pthread_setaffinity_np */
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
 #include <stdlib.h>
-#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
 #include "ase256.c"
+#include "ase256_file.c"
+#include "ase256_async.c"
+#include "ase256_tune.c"
 
 /**
  * @brief 데이터를 16진수 형식으로 출력함
@@ -16,79 +21,1672 @@ void print_hex(const char* label, const uint8_t* buf, size_t len) {
     printf("\n");
 }
 
-int main() {
-    /* NIST AES-256 테스트 벡터 기반 설정 */
-    uint8_t key[32] = {
-        0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe,
-        0x2b, 0x73, 0xae, 0xf0, 0x85, 0x7d, 0x77, 0x81,
-        0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61, 0x08, 0xd7,
-        0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4
-    };
-    uint8_t iv[16] = {
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
-    };
+/* NIST SP 800-38A F.2.5 (CBC-AES256) 테스트 벡터 */
+static const uint8_t nist_key[32] = {
+    0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe,
+    0x2b, 0x73, 0xae, 0xf0, 0x85, 0x7d, 0x77, 0x81,
+    0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61, 0x08, 0xd7,
+    0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4
+};
+static const uint8_t nist_iv[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const uint8_t nist_cbc_pt[64] = {
+    0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+    0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+    0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+    0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10
+};
+static const uint8_t nist_cbc_ct[64] = {
+    0xf5, 0x8c, 0x4c, 0x04, 0xd6, 0xe5, 0xf1, 0xba, 0x77, 0x9e, 0xab, 0xfb, 0x5f, 0x7b, 0xfb, 0xd6,
+    0x9c, 0xfc, 0x4e, 0x96, 0x7e, 0xdb, 0x80, 0x8d, 0x67, 0x9f, 0x77, 0x7b, 0xc6, 0x70, 0x2c, 0x7d,
+    0x39, 0xf2, 0x33, 0x69, 0xa9, 0xd9, 0xba, 0xcf, 0xa5, 0x30, 0xe2, 0x63, 0x04, 0x23, 0x14, 0x61,
+    0xb2, 0xeb, 0x05, 0xe2, 0xc3, 0x9b, 0xe9, 0xfc, 0xda, 0x6c, 0x19, 0x07, 0x8c, 0x6a, 0x9d, 0x1b
+};
+
+/* NIST SP 800-38A F.5.5 (CTR-AES256) 테스트 벡터: 평문은 nist_cbc_pt와 같음 */
+static const uint8_t nist_ctr_iv[16] = {
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+static const uint8_t nist_ctr_ct[64] = {
+    0x60, 0x1e, 0xc3, 0x13, 0x77, 0x57, 0x89, 0xa5, 0xb7, 0xa7, 0xf5, 0x04, 0xbb, 0xf3, 0xd2, 0x28,
+    0xf4, 0x43, 0xe3, 0xca, 0x4d, 0x62, 0xb5, 0x9a, 0xca, 0x84, 0xe9, 0x90, 0xca, 0xca, 0xf5, 0xc5,
+    0x2b, 0x09, 0x30, 0xda, 0xa2, 0x3d, 0xe9, 0x4c, 0xe8, 0x70, 0x17, 0xba, 0x2d, 0x84, 0x98, 0x8d,
+    0xdf, 0xc9, 0xc5, 0x8d, 0xb6, 0x7a, 0xad, 0xa6, 0x13, 0xc2, 0xdd, 0x08, 0x45, 0x79, 0x41, 0xa6
+};
+
+/* FIPS-197 부록 C.3 (AES-256) 테스트 벡터 */
+static const uint8_t fips_pt[16] = {
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+};
+static const uint8_t fips_ct[16] = {
+    0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf, 0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89
+};
+
+/**
+ * @brief 검증 결과를 출력하고 실패 횟수를 누적함
+ */
+static int check(const char* name, const uint8_t* got, const uint8_t* expect, size_t len) {
+    int ok = (memcmp(got, expect, len) == 0);
+    printf("  [%s] %s\n", ok ? "PASS" : "FAIL", name);
+    if (!ok) {
+        print_hex("    기대값", expect, len);
+        print_hex("    결과값", got, len);
+    }
+    return ok ? 0 : 1;
+}
+
+/**
+ * @brief 현재 백엔드로 NIST/FIPS 알려진 답(KAT) 검증을 수행함
+ * @return 실패한 항목 수
+ */
+static int run_known_answer_tests(void) {
     uint8_t round_key[240];
+    uint8_t key[32];
+    uint8_t buf[64];
+    int fails = 0;
+
+    /* FIPS-197 C.3: 키 00 01 02 ... 1f */
+    for (int i = 0; i < 32; i++) key[i] = (uint8_t)i;
+    KeyExpansion(round_key, key);
+
+    memcpy(buf, fips_pt, 16);
+    AES256_EncryptBlock(buf, round_key);
+    fails += check("FIPS-197 C.3 블록 암호화", buf, fips_ct, 16);
+    AES256_DecryptBlock(buf, round_key);
+    fails += check("FIPS-197 C.3 블록 복호화", buf, fips_pt, 16);
+
+    /* 스레드별로 보관한 복호화 키가 다른 키로 바뀌었을 때 다시 계산되는지 확인 */
+    uint8_t other_key[240];
+    uint8_t other[16];
+    KeyExpansion(other_key, nist_key);
+    memcpy(other, fips_pt, 16);
+    AES256_EncryptBlock(other, other_key);
+    AES256_DecryptBlock(other, other_key);
+    memcpy(buf, fips_ct, 16);
+    AES256_DecryptBlock(buf, round_key);
+    fails += check("블록 복호화 키 교체 (다른 키 -> 원래 키)", buf, fips_pt, 16);
+    fails += check("블록 복호화 키 교체 (다른 키)", other, fips_pt, 16);
+    secure_memzero(other_key, sizeof(other_key));
+
+    /* SP 800-38A F.2.5 / F.2.6 */
+    KeyExpansion(round_key, nist_key);
+
+    memcpy(buf, nist_cbc_pt, 64);
+    AES256_CBC_Encrypt(buf, 64, round_key, nist_iv);
+    fails += check("SP 800-38A F.2.5 CBC 암호화", buf, nist_cbc_ct, 64);
+    AES256_CBC_Decrypt(buf, 64, round_key, nist_iv);
+    fails += check("SP 800-38A F.2.6 CBC 복호화", buf, nist_cbc_pt, 64);
 
-    /* 성능 테스트를 위한 10MB 데이터 할당 */
-    const size_t test_size = 10 * 1024 * 1024; // 10MB
-    uint8_t* plaintext = (uint8_t*)malloc(test_size);
-    uint8_t* data = (uint8_t*)malloc(test_size);
+    memcpy(buf, nist_cbc_pt, 64);
+    AES256_CTR_Crypt(buf, 64, round_key, nist_ctr_iv, 0);
+    fails += check("SP 800-38A F.5.5 CTR 암호화", buf, nist_ctr_ct, 64);
+    AES256_CTR_Crypt(buf, 64, round_key, nist_ctr_iv, 0);
+    fails += check("SP 800-38A F.5.6 CTR 복호화", buf, nist_cbc_pt, 64);
 
-    if (plaintext == NULL || data == NULL) {
+    secure_memzero(round_key, sizeof(round_key));
+    return fails;
+}
+
+/**
+ * @brief 교차 처리 폭과 스레드 수를 바꿔 가며 CBC 복호화 결과가 같은지 확인함
+ * @return 실패한 항목 수
+ */
+static int run_parallel_cbc_tests(void) {
+    static const int widths[] = {1, 2, 4, 8};
+    static const int threads[] = {1, 2, 3, 7};
+    const size_t len = 1001 * 16; /* 교차 폭과 스레드 수로 나누어떨어지지 않는 블록 수 */
+    uint8_t round_key[240];
+    uint8_t* plain = (uint8_t*)malloc(len);
+    uint8_t* cipher = (uint8_t*)malloc(len);
+    uint8_t* work = (uint8_t*)malloc(len);
+    int saved_width = AES256_GetInterleave();
+    int fails = 0;
+
+    if (plain == NULL || cipher == NULL || work == NULL) {
         printf("메모리 할당 실패!\n");
-        if (plaintext) free(plaintext);
-        if (data) free(data);
+        free(plain); free(cipher); free(work);
         return 1;
     }
 
-    /* 평문 데이터 초기화 (패턴 입력) */
-    for (size_t i = 0; i < test_size; i++) {
-        plaintext[i] = (uint8_t)(i % 256);
+    for (size_t i = 0; i < len; i++) plain[i] = (uint8_t)(i * 7 + 3);
+    KeyExpansion(round_key, nist_key);
+    memcpy(cipher, plain, len);
+    AES256_CBC_Encrypt(cipher, len, round_key, nist_iv);
+
+    for (size_t w = 0; w < sizeof(widths) / sizeof(widths[0]); w++) {
+        AES256_SetInterleave(widths[w]);
+        for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+            memcpy(work, cipher, len);
+            AES256_CBC_Decrypt_MT(work, len, round_key, nist_iv, threads[t]);
+            if (memcmp(work, plain, len) != 0) {
+                printf("  [FAIL] CBC 병렬 복호화 (교차 %d, 스레드 %d)\n", widths[w], threads[t]);
+                fails++;
+            }
+        }
+    }
+    if (fails == 0) printf("  [PASS] CBC 병렬 복호화 (교차 1/2/4/8 x 스레드 1/2/3/7)\n");
+
+    AES256_SetInterleave(saved_width);
+    secure_memzero(round_key, sizeof(round_key));
+    free(plain); free(cipher); free(work);
+    return fails;
+}
+
+/**
+ * @brief CTR 모드를 임의 오프셋/길이로 나누어 처리해도 한 번에 처리한 결과와 같은지 확인함
+ * @return 실패한 항목 수
+ */
+static int run_ctr_offset_tests(void) {
+    const size_t len = 1000;
+    uint8_t round_key[240];
+    uint8_t whole[1000], pieces[1000];
+    uint8_t wrap_iv[16];
+    int fails = 0;
+
+    KeyExpansion(round_key, nist_key);
+    for (size_t i = 0; i < len; i++) whole[i] = (uint8_t)(i * 13 + 1);
+    memcpy(pieces, whole, len);
+
+    /* 하위 64비트가 넘치는 카운터: 128비트 올림이 일어나야 함 */
+    memset(wrap_iv, 0xff, sizeof(wrap_iv));
+    wrap_iv[0] = 0x00;
+    wrap_iv[15] = 0xfd;
+
+    AES256_CTR_Crypt(whole, len, round_key, wrap_iv, 0);
+
+    /* 블록 경계와 어긋난 조각 단위로 처리 */
+    size_t pos = 0, step = 1;
+    while (pos < len) {
+        size_t n = (len - pos < step) ? (len - pos) : step;
+        AES256_CTR_Crypt(pieces + pos, n, round_key, wrap_iv, pos);
+        pos += n;
+        step = step * 3 + 2;
+    }
+    fails += check("CTR 오프셋 분할 처리 = 일괄 처리", pieces, whole, len);
+
+    /* 네 번째 블록(offset 48)의 카운터는 iv+3으로, 128비트 올림이 일어난 값이어야 함 */
+    uint8_t block[16];
+    uint8_t expect[16] = {0};
+    expect[0] = 0x01; /* 0x00ff..fd + 3 = 0x0100..00 */
+    memcpy(block, expect, 16);
+    AES256_EncryptBlock(block, round_key);
+    uint8_t got[16] = {0};
+    AES256_CTR_Crypt(got, 16, round_key, wrap_iv, 48);
+    fails += check("CTR 128비트 카운터 올림", got, block, 16);
+
+    secure_memzero(round_key, sizeof(round_key));
+    return fails;
+}
+
+/**
+ * @brief 다중 버퍼 CBC 결과를 작업별 AES256_CBC_Encrypt 결과와 비교함
+ * @details 길이/키/IV가 제각각인 작업 40개 (잘못된 길이 1개 포함), 교차 폭 1/2/4/8
+ * @return 실패한 항목 수
+ */
+static int run_cbc_multi_tests(void) {
+    enum { NJOBS = 40, MAXLEN = 512 };
+    static uint8_t msgs[NJOBS][MAXLEN], ref[NJOBS][MAXLEN];
+    uint8_t keys[3][240], ivs[NJOBS][16];
+    AES256_CBC_JOB jobs[NJOBS];
+    const int widths[] = {1, 2, 4, 8};
+    int fails = 0;
+
+    for (int k = 0; k < 3; k++) {
+        uint8_t key[32];
+        for (int i = 0; i < 32; i++) key[i] = (uint8_t)(nist_key[i] + k * 17);
+        KeyExpansion(keys[k], key);
+    }
+
+    for (size_t w = 0; w < sizeof(widths) / sizeof(widths[0]); w++) {
+        AES256_SetInterleave(widths[w]);
+
+        for (int j = 0; j < NJOBS; j++) {
+            size_t len = (j == 13) ? 15 : (size_t)((j * 7) % 32 + 1) * 16;
+            for (size_t i = 0; i < len; i++) msgs[j][i] = (uint8_t)(i * 3 + j);
+            for (int i = 0; i < 16; i++) ivs[j][i] = (uint8_t)(nist_iv[i] ^ j);
+            memcpy(ref[j], msgs[j], len);
+            if (len % 16 == 0) AES256_CBC_Encrypt(ref[j], len, keys[j % 3], ivs[j]);
+            jobs[j] = (AES256_CBC_JOB){ .buf = msgs[j], .len = len, .RoundKey = keys[j % 3], .iv = ivs[j] };
+        }
+
+        int rc = AES256_CBC_Encrypt_Multi(jobs, NJOBS);
+        int ok = (rc == -2 && jobs[13].result == -2);
+        for (int j = 0; j < NJOBS; j++) {
+            if (j == 13) continue;
+            if (jobs[j].result != 0 || memcmp(msgs[j], ref[j], jobs[j].len) != 0) ok = 0;
+        }
+
+        char label[64];
+        snprintf(label, sizeof(label), "다중 버퍼 CBC (작업 %d개, 교차 폭 %d)", NJOBS, widths[w]);
+        printf("  [%s] %s\n", ok ? "PASS" : "FAIL", label);
+        if (!ok) fails++;
+    }
+    AES256_SetInterleave(8);
+
+    for (int k = 0; k < 3; k++) secure_memzero(keys[k], sizeof(keys[k]));
+    return fails;
+}
+
+/**
+ * @brief iovec 배열을 seg 길이 목록대로 buf 위에 나누어 만듦 (테스트 보조)
+ * @return 세그먼트 수
+ */
+static int make_iov(struct iovec* v, uint8_t* buf, const size_t* seg, int nseg) {
+    size_t pos = 0;
+    for (int i = 0; i < nseg; i++) {
+        v[i].iov_base = buf + pos;
+        v[i].iov_len = seg[i];
+        pos += seg[i];
+    }
+    return nseg;
+}
+
+/**
+ * @brief CBC 분산/수집: 세그먼트에 걸친 블록, 제자리/별도 출력, 긴 구간, 오류 처리를 연속 버퍼 결과와 비교함
+ * @return 실패한 항목 수
+ */
+static int run_cbc_iov_tests(void) {
+    enum { LEN = 40000 };   /* 16의 배수, 출력 복사 단위(16KB)보다 큼 */
+    static uint8_t plain[LEN], ref[LEN], in[LEN], out[LEN + 64];
+    uint8_t round_key[240];
+    struct iovec vin[8], vout[8];
+    int fails = 0;
+
+    KeyExpansion(round_key, nist_key);
+    for (size_t i = 0; i < LEN; i++) plain[i] = (uint8_t)(i * 11 + (i >> 7));
+    memcpy(ref, plain, LEN);
+    AES256_CBC_Encrypt(ref, LEN, round_key, nist_iv);
+
+    /* 헤더 5바이트, 빈 세그먼트, 27바이트, 정렬된 16바이트, 1바이트, 큰 본문, 트레일러 */
+    const size_t seg_in[] = { 5, 0, 27, 16, 1, 20001, LEN - 5 - 27 - 16 - 1 - 20001 };
+    const size_t seg_out[] = { 3, 33, 1000, 17, LEN - 3 - 33 - 1000 - 17 + 64 };
+    int nin = make_iov(vin, in, seg_in, 7);
+    int nout = make_iov(vout, out, seg_out, 5);
+
+    /* 제자리 */
+    memcpy(in, plain, LEN);
+    int ok = (AES256_CBC_EncryptV(vin, nin, NULL, 0, round_key, nist_iv) == 0 && memcmp(in, ref, LEN) == 0);
+    ok = ok && (AES256_CBC_DecryptV(vin, nin, NULL, 0, round_key, nist_iv) == 0 && memcmp(in, plain, LEN) == 0);
+    printf("  [%s] CBC iovec 제자리 암복호화 (세그먼트 7개, 경계에 걸친 블록 포함)\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    /* 입력과 배치가 다른 출력 세그먼트 (출력이 64바이트 더 큼) */
+    memcpy(in, plain, LEN);
+    memset(out, 0xee, sizeof(out));
+    ok = (AES256_CBC_EncryptV(vin, nin, vout, nout, round_key, nist_iv) == 0 && memcmp(out, ref, LEN) == 0 &&
+          memcmp(in, plain, LEN) == 0 && out[LEN] == 0xee);
+    memset(in, 0, LEN);
+    ok = ok && (AES256_CBC_DecryptV(vout, nout - 1, vin, nin, round_key, nist_iv) == -2);
+    struct iovec tail_fix[5];
+    memcpy(tail_fix, vout, sizeof(tail_fix));
+    tail_fix[4].iov_len -= 64;
+    ok = ok && (AES256_CBC_DecryptV(tail_fix, 5, vin, nin, round_key, nist_iv) == 0 && memcmp(in, plain, LEN) == 0);
+    printf("  [%s] CBC iovec 별도 출력 (입출력 세그먼트 배치가 다름)\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    /* 세그먼트마다 따로 할당한 버퍼 (한 배열을 자른 경우와 달리 세그먼트 끝 너머를 건드리면 ASan이 잡음).
+       16의 배수 길이 세그먼트가 이어지는 경우와 경계에 걸친 블록이 섞인 경우 */
+    const size_t seg_sep[] = { 32, 32, 48, 7, 25, 16, 4096 - 160 };
+    enum { NSEP = 7 };
+    struct iovec vsep[NSEP], vsep_out[NSEP];
+    ok = 1;
+    for (int i = 0; i < NSEP; i++) {
+        vsep[i].iov_base = malloc(seg_sep[i]);
+        vsep[i].iov_len = seg_sep[i];
+        vsep_out[NSEP - 1 - i].iov_base = malloc(seg_sep[i]);
+        vsep_out[NSEP - 1 - i].iov_len = seg_sep[i];
+        if (vsep[i].iov_base == NULL || vsep_out[NSEP - 1 - i].iov_base == NULL) ok = 0;
+    }
+    for (int pass = 0; ok && pass < 2; pass++) {
+        /* pass 0: 제자리, pass 1: 배치가 다른 별도 출력 */
+        size_t pos = 0;
+        for (int i = 0; i < NSEP; i++) {
+            memcpy(vsep[i].iov_base, plain + pos, seg_sep[i]);
+            pos += seg_sep[i];
+        }
+        const struct iovec* o = pass ? vsep_out : NULL;
+        const struct iovec* r = pass ? vsep_out : vsep;
+        ok = (AES256_CBC_EncryptV(vsep, NSEP, o, pass ? NSEP : 0, round_key, nist_iv) == 0);
+        pos = 0;
+        for (int i = 0; ok && i < NSEP; i++) {
+            ok = memcmp(r[i].iov_base, ref + pos, r[i].iov_len) == 0;
+            pos += r[i].iov_len;
+        }
+        ok = ok && (AES256_CBC_DecryptV(r, NSEP, NULL, 0, round_key, nist_iv) == 0);
+        pos = 0;
+        for (int i = 0; ok && i < NSEP; i++) {
+            ok = memcmp(r[i].iov_base, plain + pos, r[i].iov_len) == 0;
+            pos += r[i].iov_len;
+        }
     }
+    for (int i = 0; i < NSEP; i++) {
+        free(vsep[i].iov_base);
+        free(vsep_out[i].iov_base);
+    }
+    printf("  [%s] CBC iovec 따로 할당한 세그먼트 (제자리/별도 출력)\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    /* 길이/인자 오류 */
+    struct iovec bad[2] = { { in, 10 }, { NULL, 6 } };
+    struct iovec odd[1] = { { in, 24 } };
+    ok = (AES256_CBC_EncryptV(bad, 2, NULL, 0, round_key, nist_iv) == -1 &&
+          AES256_CBC_EncryptV(odd, 1, NULL, 0, round_key, nist_iv) == -2 &&
+          AES256_CBC_EncryptV(vin, 0, NULL, 0, round_key, nist_iv) == -2 &&
+          AES256_CBC_EncryptV(vin, nin, vout, 1, round_key, nist_iv) == -2);
+    printf("  [%s] CBC iovec 잘못된 인자/길이 거부\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
 
-    printf("--- AES-256 CBC 성능 벤치마크 (크기: %zu MB) ---\n", test_size / (1024 * 1024));
-    
-    /* 1. 키 확장 성능 측정 */
-    if (KeyExpansion(round_key, key) != 0) {
-        printf("키 확장 실패!\n");
-        free(plaintext);
+    secure_memzero(round_key, sizeof(round_key));
+    return fails;
+}
+
+/**
+ * @brief 키 스케줄 객체의 복호화 결과와 캐시의 LRU/고정/키 교체/소거 동작을 확인함
+ * @return 실패한 항목 수
+ */
+static int run_key_cache_tests(void) {
+    uint8_t round_key[240], buf[64], ref[64];
+    AES256_KEY key;
+    int fails = 0;
+
+    /* 캐시된 복호화 라운드 키로 푼 결과가 기존 API와 같아야 함 */
+    KeyExpansion(round_key, nist_key);
+    AES256_KeyInit(&key, nist_key);
+    memcpy(buf, nist_cbc_ct, 64);
+    AES256_CBC_Decrypt_Key(buf, 64, &key, nist_iv);
+    fails += check("키 스케줄 객체 CBC 복호화 (F.2.6)", buf, nist_cbc_pt, 64);
+    fails += check("키 스케줄 객체 암호화 라운드 키", key.RoundKey, round_key, 240);
+
+    uint8_t fips_key[32];
+    for (int i = 0; i < 32; i++) fips_key[i] = (uint8_t)i;
+    AES256_KeyInit(&key, fips_key);
+    memcpy(buf, fips_ct, 16);
+    AES256_DecryptBlock_Key(buf, &key);
+    fails += check("키 스케줄 객체 블록 복호화 (FIPS-197 C.3)", buf, fips_pt, 16);
+
+    AES256_KEY_CACHE* cache = AES256_KeyCacheCreate(3);
+    if (cache == NULL) {
+        printf("  [FAIL] 키 캐시 생성 실패\n");
+        return fails + 1;
+    }
+
+    /* ID 1~3을 채운 뒤 1을 다시 쓰면 가장 오래된 것은 2 → ID 4가 2를 밀어냄 */
+    uint8_t keys[5][32];
+    for (int k = 0; k < 5; k++) {
+        for (int i = 0; i < 32; i++) keys[k][i] = (uint8_t)(nist_key[i] + k * 29);
+    }
+    for (int k = 1; k <= 3; k++) AES256_KeyCacheRelease(cache, AES256_KeyCacheAcquire(cache, k, keys[k]));
+    AES256_KeyCacheRelease(cache, AES256_KeyCacheAcquire(cache, 1, keys[1]));
+    const AES256_KEY* k4 = AES256_KeyCacheAcquire(cache, 4, keys[4]);
+    AES256_KEY_CACHE_STATS st;
+    AES256_KeyCacheStats(cache, &st);
+    int ok = (k4 != NULL && st.hits == 1 && st.misses == 4 && st.evictions == 1 && st.entries == 3 &&
+              AES256_KeyCacheAcquire(cache, 2, NULL) == NULL);
+    const AES256_KEY* k1 = AES256_KeyCacheAcquire(cache, 1, NULL);
+    ok = ok && (k1 != NULL && memcmp(k1->RoundKey, keys[1], 32) == 0);
+    printf("  [%s] 키 캐시 LRU 교체 순서 및 통계\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    /* 사용 중인 항목(1, 4)은 밀려나지 않고, 전부 사용 중이면 NULL */
+    const AES256_KEY* k3 = AES256_KeyCacheAcquire(cache, 3, keys[3]);
+    ok = (k3 != NULL && AES256_KeyCacheAcquire(cache, 5, keys[0]) == NULL);
+    AES256_KeyCacheRelease(cache, k3);
+    const AES256_KEY* k5 = AES256_KeyCacheAcquire(cache, 5, keys[0]);
+    ok = ok && (k5 == k3 && AES256_KeyCacheAcquire(cache, 3, NULL) == NULL);
+    AES256_KeyCacheRelease(cache, k5);
+    printf("  [%s] 키 캐시 사용 중 항목 보호\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    /* 사용 중에 키가 교체/제거되면 기존 스케줄은 Release 때 소거되고, 새 키는 다른 슬롯에 들어감 */
+    const key_cache_entry_t* e1 = (const key_cache_entry_t*)k1;
+    const AES256_KEY* k1b = AES256_KeyCacheAcquire(cache, 1, keys[2]);
+    ok = (k1b != NULL && k1b != k1 && memcmp(k1b->RoundKey, keys[2], 32) == 0);
+    ok = ok && (e1->state == KEY_SLOT_DEAD && memcmp(k1->RoundKey, keys[1], 32) == 0);
+    ok = ok && (AES256_KeyCacheAcquire(cache, 1, NULL) == k1b);
+    AES256_KeyCacheRelease(cache, k1b);
+    AES256_KeyCacheRelease(cache, k1);
+    uint8_t zero[sizeof(AES256_KEY)] = {0};
+    ok = ok && (e1->state == KEY_SLOT_FREE && memcmp(&e1->key, zero, sizeof(zero)) == 0);
+    AES256_KeyCacheRelease(cache, k1b);
+    ok = ok && (AES256_KeyCacheRemove(cache, 1) == 0 && AES256_KeyCacheRemove(cache, 1) == -1 &&
+                memcmp(&((const key_cache_entry_t*)k1b)->key, zero, sizeof(zero)) == 0);
+    AES256_KeyCacheRelease(cache, k4);
+    printf("  [%s] 키 캐시 키 교체/제거 시 소거\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    /* 정렬: 모든 항목이 캐시 라인 경계에서 시작 */
+    ok = ((uintptr_t)k4 % 64 == 0 && (uintptr_t)k5 % 64 == 0);
+    memcpy(ref, nist_cbc_pt, 64);
+    memcpy(buf, nist_cbc_pt, 64);
+    const AES256_KEY* k = AES256_KeyCacheAcquire(cache, 9, nist_key);
+    AES256_CBC_Encrypt(buf, 64, k->RoundKey, nist_iv);
+    AES256_CBC_Decrypt_Key(buf, 64, k, nist_iv);
+    ok = ok && memcmp(buf, ref, 64) == 0;
+    AES256_KeyCacheRelease(cache, k);
+    printf("  [%s] 키 캐시 항목 64바이트 정렬 및 CBC 왕복\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    AES256_KeyCacheDestroy(cache);
+    AES256_KeyClear(&key);
+    secure_memzero(keys, sizeof(keys));
+    secure_memzero(round_key, sizeof(round_key));
+    return fails;
+}
+
+/**
+ * @brief 파일 전체를 읽어 새로 할당한 버퍼로 반환함 (테스트 보조)
+ */
+static uint8_t* read_whole_file(const char* path, size_t* len) {
+    FILE* fp = fopen(path, "rb");
+    if (fp == NULL) return NULL;
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    uint8_t* buf = (uint8_t*)malloc((size_t)size + 1);
+    if (buf != NULL) *len = fread(buf, 1, (size_t)size, fp);
+    fclose(fp);
+    return buf;
+}
+
+/**
+ * @brief 청크 컨테이너: 병렬 암복호화 왕복, 청크 경계에 걸친 임의 위치 읽기, 변조 감지
+ * @return 실패한 항목 수
+ */
+static int run_file_tests(void) {
+    char plain_path[] = "/tmp/ase256_plain_XXXXXX";
+    char enc_path[] = "/tmp/ase256_enc_XXXXXX";
+    char dec_path[] = "/tmp/ase256_dec_XXXXXX";
+    const size_t size = 300 * 1000 + 77;    /* 청크 4KB 기준 74개 + 자투리 */
+    int fails = 0;
+
+    int fds[3] = { mkstemp(plain_path), mkstemp(enc_path), mkstemp(dec_path) };
+    uint8_t* plain = (uint8_t*)malloc(size);
+    if (fds[0] < 0 || fds[1] < 0 || fds[2] < 0 || plain == NULL) {
+        printf("  [FAIL] 임시 파일 준비 실패\n");
+        free(plain);
+        return 1;
+    }
+    for (int i = 0; i < 3; i++) close(fds[i]);
+    for (size_t i = 0; i < size; i++) plain[i] = (uint8_t)((i * 31) ^ (i >> 8));
+    FILE* fp = fopen(plain_path, "wb");
+    fwrite(plain, 1, size, fp);
+    fclose(fp);
+
+    /* 1. 병렬 왕복 */
+    int rc_enc = AES256_FileEncrypt(plain_path, enc_path, nist_key, AES256_FILE_MIN_CHUNK, 3);
+    int rc_dec = AES256_FileDecrypt(enc_path, dec_path, nist_key, 4);
+    size_t dec_len = 0;
+    uint8_t* dec = read_whole_file(dec_path, &dec_len);
+    int ok = (rc_enc == 0 && rc_dec == 0 && dec != NULL && dec_len == size && memcmp(dec, plain, size) == 0);
+    printf("  [%s] 컨테이너 암복호화 왕복 (청크 4KB, 스레드 3/4)\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+    free(dec);
+
+    /* 2. 임의 위치 읽기: 청크 중간, 청크 경계 걸침, 파일 끝 넘김 */
+    static const uint64_t offsets[] = {0, 4095, 8190, 150000, 299990, 300077, 400000};
+    static const size_t lens[] = {10, 2, 9000, 1, 500, 10, 10};
+    uint8_t out[9000];
+    int rc_open;
+    AES256_FILE_READER* r = AES256_FileOpen(enc_path, nist_key, &rc_open);
+    ok = (r != NULL && AES256_FileSize(r) == size);
+    for (size_t t = 0; ok && t < sizeof(offsets) / sizeof(offsets[0]); t++) {
+        size_t expect = (offsets[t] >= size) ? 0 :
+                        (offsets[t] + lens[t] > size ? size - offsets[t] : lens[t]);
+        long long got = AES256_FileRead(r, offsets[t], out, lens[t]);
+        if (got != (long long)expect || memcmp(out, plain + (expect ? offsets[t] : 0), expect) != 0) ok = 0;
+    }
+    printf("  [%s] 컨테이너 임의 위치 읽기 (청크 경계 및 파일 끝)\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+    AES256_FileClose(r);
+
+    /* 3. 암호문 1비트 변조: 해당 청크 읽기와 전체 복호화는 실패, 다른 청크 읽기는 성공 */
+    fp = fopen(enc_path, "r+b");
+    fseek(fp, AES256_FILE_HEADER_SIZE + 5 * AES256_FILE_MIN_CHUNK + 100, SEEK_SET);
+    int c = fgetc(fp);
+    fseek(fp, -1, SEEK_CUR);
+    fputc(c ^ 0x01, fp);
+    fclose(fp);
+
+    r = AES256_FileOpen(enc_path, nist_key, &rc_open);
+    long long bad = AES256_FileRead(r, 5 * AES256_FILE_MIN_CHUNK, out, 16);
+    long long good = AES256_FileRead(r, 7 * AES256_FILE_MIN_CHUNK, out, 16);
+    AES256_FileClose(r);
+    rc_dec = AES256_FileDecrypt(enc_path, dec_path, nist_key, 2);
+    ok = (bad == -3 && good == 16 && rc_dec == -3 && access(dec_path, F_OK) != 0);
+    printf("  [%s] 컨테이너 변조 감지 (변조된 청크만 거부, 복호화 결과 파일 삭제)\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    /* 4. 다른 키와 깨진 헤더 */
+    uint8_t wrong_key[32];
+    memcpy(wrong_key, nist_key, 32);
+    wrong_key[0] ^= 0x80;
+    r = AES256_FileOpen(enc_path, wrong_key, &rc_open);
+    long long wrong = AES256_FileRead(r, 0, out, 16);
+    AES256_FileClose(r);
+    r = AES256_FileOpen(plain_path, nist_key, &rc_open);
+    ok = (wrong == -3 && r == NULL && rc_open == -2);
+    printf("  [%s] 컨테이너 잘못된 키/형식 거부\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    unlink(plain_path);
+    unlink(enc_path);
+    unlink(dec_path);
+    free(plain);
+    return fails;
+}
+
+/**
+ * @brief 파이프라인 변환: 입출력 방식/O_DIRECT/크기별로 기존 mmap 경로와 결과가 호환되는지 확인
+ * @return 실패한 항목 수
+ */
+static int run_file_pipe_tests(void) {
+    char plain_path[] = "/tmp/ase256_pplain_XXXXXX";
+    char enc_path[] = "/tmp/ase256_penc_XXXXXX";
+    char dec_path[] = "/tmp/ase256_pdec_XXXXXX";
+    static const size_t sizes[] = {0, 1, 4095, 4096, 300 * 1000 + 77};
+    static const aes256_file_io_t ios[] = {AES256_FILE_IO_AUTO, AES256_FILE_IO_THREADS};
+    const size_t max_size = 300 * 1000 + 77;
+    int fails = 0;
+
+    int fds[3] = { mkstemp(plain_path), mkstemp(enc_path), mkstemp(dec_path) };
+    uint8_t* plain = (uint8_t*)malloc(max_size);
+    if (fds[0] < 0 || fds[1] < 0 || fds[2] < 0 || plain == NULL) {
+        printf("  [FAIL] 임시 파일 준비 실패\n");
+        free(plain);
+        return 1;
+    }
+    for (int i = 0; i < 3; i++) close(fds[i]);
+    for (size_t i = 0; i < max_size; i++) plain[i] = (uint8_t)((i * 7) ^ (i >> 9));
+
+    /* 방식 x O_DIRECT x 청크(4KB 정렬 / 비정렬) x 크기: 파이프 암호화 → mmap 복호화, mmap 암호화 → 파이프 복호화 */
+    for (int m = 0; m < 2; m++) {
+        for (int direct = 0; direct < 2; direct++) {
+            AES256_FILE_PIPE_STATS st;
+            int ok = 1, used_direct = 0;
+            aes256_file_io_t used = ios[m];
+            for (size_t z = 0; ok && z < sizeof(sizes) / sizeof(sizes[0]); z++) {
+                for (uint32_t chunk = 4096; ok && chunk <= 5000; chunk += 904) {
+                    AES256_FILE_PIPE_CONFIG cfg = { chunk, 1 + (int)z % 3, 4, direct, ios[m] };
+                    FILE* fp = fopen(plain_path, "wb");
+                    fwrite(plain, 1, sizes[z], fp);
+                    fclose(fp);
+
+                    size_t len = 0;
+                    uint8_t* dec = NULL;
+                    int rc1 = AES256_FileEncryptPipe(plain_path, enc_path, nist_key, &cfg, &st);
+                    int rc2 = AES256_FileDecrypt(enc_path, dec_path, nist_key, 2);
+                    if (rc1 == 0 && rc2 == 0) dec = read_whole_file(dec_path, &len);
+                    if (dec == NULL || len != sizes[z] || memcmp(dec, plain, len) != 0) ok = 0;
+                    free(dec);
+                    dec = NULL;
+                    if (sizes[z] > 0) {
+                        used = st.io;
+                        used_direct |= st.direct;
+                    }
+
+                    rc1 = AES256_FileEncrypt(plain_path, enc_path, nist_key, chunk, 2);
+                    rc2 = AES256_FileDecryptPipe(enc_path, dec_path, nist_key, &cfg, &st);
+                    if (rc1 == 0 && rc2 == 0) dec = read_whole_file(dec_path, &len);
+                    if (dec == NULL || len != sizes[z] || memcmp(dec, plain, len) != 0) ok = 0;
+                    free(dec);
+                    if (sizes[z] > 0) used_direct |= st.direct;
+                }
+            }
+            printf("  [%s] 파이프라인 왕복 (%s, O_DIRECT %s, 0~300KB, 청크 4096/5000)\n", ok ? "PASS" : "FAIL",
+                   used == AES256_FILE_IO_URING ? "io_uring" : "스레드",
+                   direct ? (used_direct ? "사용" : "요청했으나 미지원") : "끔");
+            if (!ok) fails++;
+        }
+    }
+
+    /* 변조된 청크 → -3, 결과 파일 삭제 (두 방식 모두) */
+    int ok = 1;
+    for (int m = 0; m < 2; m++) {
+        AES256_FILE_PIPE_CONFIG cfg = { 4096, 2, 4, 0, ios[m] };
+        FILE* fp = fopen(plain_path, "wb");
+        fwrite(plain, 1, max_size, fp);
+        fclose(fp);
+        ok = ok && AES256_FileEncryptPipe(plain_path, enc_path, nist_key, &cfg, NULL) == 0;
+        fp = fopen(enc_path, "r+b");
+        fseek(fp, AES256_FILE_HEADER_SIZE + 40 * 4096 + 7, SEEK_SET);
+        int c = fgetc(fp);
+        fseek(fp, -1, SEEK_CUR);
+        fputc(c ^ 0x10, fp);
+        fclose(fp);
+        ok = ok && AES256_FileDecryptPipe(enc_path, dec_path, nist_key, &cfg, NULL) == -3 && access(dec_path, F_OK) != 0;
+    }
+    printf("  [%s] 파이프라인 변조 감지 (복호화 결과 파일 삭제)\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    ok = (AES256_FileEncryptPipe("/dev/null", enc_path, nist_key, NULL, NULL) == -1 &&
+          AES256_FileDecryptPipe(plain_path, dec_path, nist_key, NULL, NULL) == -2 &&
+          AES256_FileEncryptPipe(NULL, enc_path, nist_key, NULL, NULL) == -1);
+    printf("  [%s] 파이프라인 잘못된 입력 거부 (일반 파일 아님, 형식 오류)\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    unlink(plain_path);
+    unlink(enc_path);
+    unlink(dec_path);
+    free(plain);
+    return fails;
+}
+
+/* 비동기 서비스 테스트용 콜백: 완료 수를 세고, 결과를 기록함 */
+typedef struct {
+    pthread_mutex_t lock;
+    int count;
+    int failed;
+} async_counter_t;
+
+static void async_test_callback(AES256_ASYNC_JOB* job, void* arg) {
+    async_counter_t* c = (async_counter_t*)arg;
+    pthread_mutex_lock(&c->lock);
+    c->count++;
+    if (job->result != 0) c->failed++;
+    pthread_mutex_unlock(&c->lock);
+}
+
+/**
+ * @brief 비동기 서비스: 작은 작업 묶음 처리, 큰 작업 분할, 콜백/대기 완료 통지, 통계, 인자 검사
+ * @return 실패한 항목 수
+ */
+static int run_async_tests(void) {
+    enum { NSMALL = 300 };
+    const size_t big = 1024 * 1024 + 48;    /* 조각 64KB 기준 17개 */
+    uint8_t rk[240];
+    int fails = 0;
+
+    KeyExpansion(rk, nist_key);
+    AES256_ASYNC_CONFIG cfg = { .workers = 3, .batch_max = 8, .split_bytes = 64 * 1024 };
+    AES256_ASYNC* svc = AES256_AsyncCreate(&cfg);
+    AES256_ASYNC_JOB* jobs = (AES256_ASYNC_JOB*)calloc(NSMALL + 2, sizeof(AES256_ASYNC_JOB));
+    uint8_t* data = (uint8_t*)malloc(NSMALL * 256 + 2 * big);
+    uint8_t* expect = (uint8_t*)malloc(NSMALL * 256 + 2 * big);
+    if (svc == NULL || jobs == NULL || data == NULL || expect == NULL) {
+        printf("  [FAIL] 비동기 서비스 준비 실패\n");
+        AES256_AsyncDestroy(svc);
+        free(jobs);
         free(data);
+        free(expect);
         return 1;
     }
+    for (size_t i = 0; i < NSMALL * 256 + 2 * big; i++) data[i] = (uint8_t)((i * 7) ^ (i >> 10));
+    memcpy(expect, data, NSMALL * 256 + 2 * big);
+
+    /* 1. 작은 작업 300개 (CBC 암호화/복호화/CTR, 16~256바이트): 짝수는 콜백, 홀수는 대기 */
+    async_counter_t counter = { .count = 0, .failed = 0 };
+    pthread_mutex_init(&counter.lock, NULL);
+    int ok = 1;
+    for (int j = 0; j < NSMALL; j++) {
+        AES256_ASYNC_JOB* job = &jobs[j];
+        job->op = (aes256_async_op_t)(j % 3);
+        job->buf = data + (size_t)j * 256;
+        job->len = (job->op == AES256_ASYNC_CTR) ? (size_t)(j % 256) + 1 : (size_t)(j % 16 + 1) * 16;
+        job->RoundKey = rk;
+        memcpy(job->iv, nist_iv, 16);
+        job->iv[15] = (uint8_t)j;
+        job->callback = (j % 2 == 0) ? async_test_callback : NULL;
+        job->arg = &counter;
+
+        uint8_t* ref = expect + (size_t)j * 256;
+        if (job->op == AES256_ASYNC_CBC_ENCRYPT) AES256_CBC_Encrypt(ref, job->len, rk, job->iv);
+        else if (job->op == AES256_ASYNC_CBC_DECRYPT) AES256_CBC_Decrypt(ref, job->len, rk, job->iv);
+        else AES256_CTR_Crypt(ref, job->len, rk, job->iv, 0);
 
-    /* 2. 암호화 성능 측정 */
-    memcpy(data, plaintext, test_size);
-    clock_t start = clock();
-    if (AES256_CBC_Encrypt(data, test_size, round_key, iv) != 0) {
-        printf("암호화 실패!\n");
-    } else {
-        clock_t end = clock();
-        double enc_time = (double)(end - start) / CLOCKS_PER_SEC;
-        printf("암호화 소요 시간: %.4f 초 (속도: %.2f MB/s)\n", enc_time, (test_size / (1024.0 * 1024.0)) / enc_time);
+        if (AES256_AsyncSubmit(svc, job) != 0) ok = 0;
     }
 
-    /* 3. 복호화 성능 측정 */
-    start = clock();
-    if (AES256_CBC_Decrypt(data, test_size, round_key, iv) != 0) {
-        printf("복호화 실패!\n");
-    } else {
-        clock_t end = clock();
-        double dec_time = (double)(end - start) / CLOCKS_PER_SEC;
-        printf("복호화 소요 시간: %.4f 초 (속도: %.2f MB/s)\n", dec_time, (test_size / (1024.0 * 1024.0)) / dec_time);
+    /* 2. 큰 작업 (CBC 복호화, CTR): 조각으로 나뉘어 여러 워커가 처리 */
+    for (int j = NSMALL; j < NSMALL + 2; j++) {
+        AES256_ASYNC_JOB* job = &jobs[j];
+        size_t off = NSMALL * 256 + (size_t)(j - NSMALL) * big;
+        job->op = (j == NSMALL) ? AES256_ASYNC_CBC_DECRYPT : AES256_ASYNC_CTR;
+        job->buf = data + off;
+        job->len = (j == NSMALL) ? big : big - 5;
+        job->RoundKey = rk;
+        memcpy(job->iv, nist_ctr_iv, 16);
+        if (j == NSMALL) AES256_CBC_Decrypt(expect + off, job->len, rk, job->iv);
+        else AES256_CTR_Crypt(expect + off, job->len, rk, job->iv, 0);
+        if (AES256_AsyncSubmit(svc, job) != 0) ok = 0;
     }
 
-    /* 4. 무결성 검증 (원본 평문과 복호화 결과 비교) */
-    if (memcmp(plaintext, data, test_size) == 0) {
-        printf("\n결과: 검증 성공 (데이터 무결성 확인됨)\n");
-    } else {
-        printf("\n결과: 검증 실패 (데이터 오염 감지됨)\n");
+    for (int j = 1; j < NSMALL + 2; j++) {
+        if (jobs[j].callback == NULL && AES256_AsyncWait(&jobs[j]) != 0) ok = 0;
     }
+    AES256_AsyncDrain(svc);
+    for (int j = 1; j < NSMALL + 2; j++) {
+        if (jobs[j].callback == NULL && !AES256_AsyncPoll(&jobs[j])) ok = 0;
+    }
+    ok = ok && counter.count == NSMALL / 2 && counter.failed == 0 &&
+         memcmp(data, expect, NSMALL * 256 + 2 * big) == 0;
+    printf("  [%s] 비동기 작은 작업 %d개 + 큰 작업 2개 (콜백/대기, 결과 = 동기 API)\n", ok ? "PASS" : "FAIL", NSMALL);
+    if (!ok) fails++;
+
+    /* 3. 통계: 모두 완료, 대기열 비어 있음, 큰 작업은 분할, 지연 히스토그램 합 = 완료 수 */
+    AES256_ASYNC_STATS st;
+    AES256_AsyncStats(svc, &st);
+    uint64_t hist = 0;
+    for (int i = 0; i < AES256_ASYNC_LAT_BUCKETS; i++) hist += st.latency_hist[i];
+    ok = (st.workers == 3 && st.submitted == NSMALL + 2 && st.completed == NSMALL + 2 && st.failed == 0 &&
+          st.split_jobs == 2 && st.tasks == NSMALL + 17 + 17 && st.queue_depth == 0 && st.batches > 0 &&
+          st.max_batch <= 8 && hist == st.completed && st.latency_max_ns >= jobs[NSMALL].latency_ns &&
+          jobs[NSMALL].latency_ns >= jobs[NSMALL].queue_ns);
+    printf("  [%s] 비동기 통계 (묶음 %llu개, 최대 묶음 %llu, 가져가기 %llu, 최대 대기열 깊이 %llu)\n",
+           ok ? "PASS" : "FAIL", (unsigned long long)st.batches, (unsigned long long)st.max_batch,
+           (unsigned long long)st.steals, (unsigned long long)st.max_queue_depth);
+    if (!ok) fails++;
 
-    /* 5. 자원 해제 및 보안 소거 */
-    free(plaintext);
+    /* 4. 인자 검사: 길이 오류는 제출되지 않고, 종료 후 제출은 거부 */
+    AES256_ASYNC_JOB bad = { .op = AES256_ASYNC_CBC_ENCRYPT, .buf = data, .len = 15, .RoundKey = rk };
+    ok = (AES256_AsyncSubmit(svc, &bad) == -2);
+    bad.len = 16;
+    bad.RoundKey = NULL;
+    ok = ok && AES256_AsyncSubmit(svc, &bad) == -1;
+    AES256_AsyncDestroy(svc);
+    AES256_ASYNC_CONFIG too_many = { .workers = AES256_ASYNC_MAX_WORKERS + 1 };
+    ok = ok && AES256_AsyncCreate(&too_many) == NULL;
+    printf("  [%s] 비동기 잘못된 인자 거부\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    pthread_mutex_destroy(&counter.lock);
+    free(jobs);
     free(data);
+    free(expect);
+    secure_memzero(rk, sizeof(rk));
+    return fails;
+}
+
+#ifdef AES256_HAVE_BITSLICE
+/**
+ * @brief 비트슬라이스 S-box/역 S-box 회로를 256개 입력 전체에 대해 sbox/rsbox 표와 비교함
+ * @return 실패한 항목 수
+ */
+static int run_bitslice_sbox_test(void) {
+    uint8_t in[8 * 16], out[8 * 16];
+    int bad_fwd = 0, bad_inv = 0;
+
+    for (int base = 0; base < 256; base += 128) {
+        bs_vec q[8];
+        for (int i = 0; i < 128; i++) in[i] = (uint8_t)(base + i);
+
+        bs_load(q, in, 8);
+        bs_sbox(q);
+        bs_store(out, q, 8);
+        for (int i = 0; i < 128; i++) bad_fwd += (out[i] != sbox[in[i]]);
+
+        bs_load(q, in, 8);
+        bs_inv_sbox(q);
+        bs_store(out, q, 8);
+        for (int i = 0; i < 128; i++) bad_inv += (out[i] != rsbox[in[i]]);
+    }
+
+    printf("  [%s] 비트슬라이스 S-box 전수 비교 (256개)\n", bad_fwd == 0 ? "PASS" : "FAIL");
+    printf("  [%s] 비트슬라이스 역 S-box 전수 비교 (256개)\n", bad_inv == 0 ? "PASS" : "FAIL");
+    return (bad_fwd != 0) + (bad_inv != 0);
+}
+
+/**
+ * @brief 비트슬라이스 키 스케줄(암호화/복호화)을 소프트웨어 구현 결과와 비교함
+ * @return 실패한 항목 수
+ */
+static int run_bitslice_key_schedule_test(void) {
+    uint8_t key[32], rk_soft[240], rk_bs[240], dk_soft[240], dk_bs[240];
+    int bad_enc = 0, bad_dec = 0;
+
+    for (int t = 0; t < 64; t++) {
+        for (int i = 0; i < 32; i++) key[i] = (uint8_t)(t * 37 + i * 11 + (t == 1 ? 0xff : 0));
+        if (t == 0) memset(key, 0, sizeof(key));
+
+        soft_key_expansion(rk_soft, key);
+        bitslice_key_expansion(rk_bs, key);
+        bad_enc += (memcmp(rk_soft, rk_bs, sizeof(rk_soft)) != 0);
+
+        soft_inv_key_expansion(dk_soft, rk_soft);
+        bitslice_inv_key_expansion(dk_bs, rk_soft);
+        bad_dec += (memcmp(dk_soft, dk_bs, sizeof(dk_soft)) != 0);
+    }
+
+    printf("  [%s] 비트슬라이스 키 스케줄 비교 (64개 키)\n", bad_enc == 0 ? "PASS" : "FAIL");
+    printf("  [%s] 비트슬라이스 복호화 키 스케줄 비교 (64개 키)\n", bad_dec == 0 ? "PASS" : "FAIL");
+    return (bad_enc != 0) + (bad_dec != 0);
+}
+#endif
+
+/**
+ * @brief 스트리밍 CBC를 여러 조각 크기로 돌려 한 번에 처리한 결과와 비교함
+ * @details 기준값은 직접 PKCS#7 패딩을 붙인 뒤 AES256_CBC_Encrypt로 만든 암호문
+ * @return 실패한 항목 수
+ */
+static int run_cbc_stream_tests(void) {
+    static const size_t msg_lens[] = {0, 1, 15, 16, 17, 64, 1000, 4096};
+    static const size_t chunk_sizes[] = {1, 7, 16, 33, 4096};
+    uint8_t round_key[240];
+    uint8_t msg[4096], ref[4096 + 16], out[4096 + 16 + 16], back[4096 + 16 + 16];
+    int fails = 0;
+
+    KeyExpansion(round_key, nist_key);
+    for (size_t i = 0; i < sizeof(msg); i++) msg[i] = (uint8_t)(i * 13 + 5);
+
+    for (size_t m = 0; m < sizeof(msg_lens) / sizeof(msg_lens[0]); m++) {
+        size_t len = msg_lens[m];
+        size_t padded = (len / 16 + 1) * 16;
+
+        memcpy(ref, msg, len);
+        memset(ref + len, (int)(padded - len), padded - len);
+        AES256_CBC_Encrypt(ref, padded, round_key, nist_iv);
+
+        for (size_t c = 0; c < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); c++) {
+            size_t chunk = chunk_sizes[c];
+            AES256_CBC_CTX ctx;
+            size_t total = 0, n;
+            int ok = 1;
+
+            /* 암호화 */
+            AES256_CBC_EncryptInit(&ctx, nist_key, nist_iv);
+            for (size_t pos = 0; pos < len; pos += chunk) {
+                size_t take = (len - pos < chunk) ? len - pos : chunk;
+                if (AES256_CBC_Update(&ctx, msg + pos, take, out + total, &n) != 0) ok = 0;
+                total += n;
+            }
+            if (AES256_CBC_Final(&ctx, out + total, &n) != 0) ok = 0;
+            total += n;
+            if (!ok || total != padded || memcmp(out, ref, padded) != 0) ok = 0;
+
+            /* 복호화 (다른 조각 크기로 나누어 경계가 어긋나게 함) */
+            size_t dchunk = chunk_sizes[(c + 1) % (sizeof(chunk_sizes) / sizeof(chunk_sizes[0]))];
+            size_t dtotal = 0;
+            AES256_CBC_DecryptInit(&ctx, nist_key, nist_iv);
+            for (size_t pos = 0; pos < padded; pos += dchunk) {
+                size_t take = (padded - pos < dchunk) ? padded - pos : dchunk;
+                if (AES256_CBC_Update(&ctx, ref + pos, take, back + dtotal, &n) != 0) ok = 0;
+                dtotal += n;
+            }
+            if (AES256_CBC_Final(&ctx, back + dtotal, &n) != 0) ok = 0;
+            dtotal += n;
+            if (dtotal != len || memcmp(back, msg, len) != 0) ok = 0;
+
+            if (!ok) {
+                printf("  [FAIL] CBC 스트리밍 (메시지 %zu바이트, 조각 %zu/%zu바이트)\n", len, chunk, dchunk);
+                fails++;
+            }
+        }
+    }
+    if (fails == 0) printf("  [PASS] CBC 스트리밍 암복호화 (조각 크기 5종 x 메시지 8종)\n");
+
+    /* 잘못된 패딩과 블록 단위가 아닌 암호문은 거부되어야 함 */
+    AES256_CBC_CTX ctx;
+    size_t n;
+    uint8_t bad[32];
+    memcpy(bad, nist_cbc_pt, 32);
+    AES256_CBC_Encrypt(bad, 32, round_key, nist_iv); /* 마지막 평문 바이트 0x51은 올바른 패딩이 아님 */
+    AES256_CBC_DecryptInit(&ctx, nist_key, nist_iv);
+    AES256_CBC_Update(&ctx, bad, 32, out, &n);
+    int rc_pad = AES256_CBC_Final(&ctx, out + n, &n);
+
+    AES256_CBC_DecryptInit(&ctx, nist_key, nist_iv);
+    AES256_CBC_Update(&ctx, bad, 20, out, &n);
+    int rc_len = AES256_CBC_Final(&ctx, out + n, &n);
+
+    int rejected = (rc_pad == -3 && rc_len == -2);
+    printf("  [%s] CBC 스트리밍 패딩 오류 감지\n", rejected ? "PASS" : "FAIL");
+    if (!rejected) fails++;
+
+    secure_memzero(round_key, sizeof(round_key));
+    return fails;
+}
+
+/* GCM 명세(McGrew & Viega) AES-256 테스트 케이스 13~17에서 사용하는 값 */
+static const uint8_t gcm_key2[32] = {
+    0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+    0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08
+};
+static const uint8_t gcm_iv2[12] = {
+    0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88
+};
+static const uint8_t gcm_aad2[20] = {
+    0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef, 0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+    0xab, 0xad, 0xda, 0xd2
+};
+static const uint8_t gcm_pt2[64] = {
+    0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5, 0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+    0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda, 0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+    0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53, 0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+    0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57, 0xba, 0x63, 0x7b, 0x39, 0x1a, 0xaf, 0xd2, 0x55
+};
+static const uint8_t gcm_ct2[64] = {
+    0x52, 0x2d, 0xc1, 0xf0, 0x99, 0x56, 0x7d, 0x07, 0xf4, 0x7f, 0x37, 0xa3, 0x2a, 0x84, 0x42, 0x7d,
+    0x64, 0x3a, 0x8c, 0xdc, 0xbf, 0xe5, 0xc0, 0xc9, 0x75, 0x98, 0xa2, 0xbd, 0x25, 0x55, 0xd1, 0xaa,
+    0x8c, 0xb0, 0x8e, 0x48, 0x59, 0x0d, 0xbb, 0x3d, 0xa7, 0xb0, 0x8b, 0x10, 0x56, 0x82, 0x88, 0x38,
+    0xc5, 0xf6, 0x1e, 0x63, 0x93, 0xba, 0x7a, 0x0a, 0xbc, 0xc9, 0xf6, 0x62, 0x89, 0x80, 0x15, 0xad
+};
+
+/**
+ * @brief GCM 한 건을 암호화/복호화하여 암호문과 태그를 검증함
+ * @return 실패한 항목 수
+ */
+static int check_gcm(const char* name, const uint8_t* key, const uint8_t* iv, size_t iv_len,
+                     const uint8_t* aad, size_t aad_len, const uint8_t* pt, const uint8_t* ct, size_t len,
+                     const uint8_t* expect_tag) {
+    uint8_t round_key[240];
+    uint8_t buf[64], tag[16];
+    char label[96];
+    int fails = 0;
+
+    KeyExpansion(round_key, key);
+    memcpy(buf, pt, len);
+    AES256_GCM_Encrypt(buf, len, aad, aad_len, round_key, iv, iv_len, tag);
+    snprintf(label, sizeof(label), "%s 암호문", name);
+    if (len > 0) fails += check(label, buf, ct, len);
+    snprintf(label, sizeof(label), "%s 태그", name);
+    fails += check(label, tag, expect_tag, 16);
+
+    snprintf(label, sizeof(label), "%s 복호화/검증", name);
+    int rc = AES256_GCM_Decrypt(buf, len, aad, aad_len, round_key, iv, iv_len, tag);
+    fails += check(label, rc == 0 ? buf : (const uint8_t*)"", pt, rc == 0 ? len : 1);
+
     secure_memzero(round_key, sizeof(round_key));
+    return fails;
+}
+
+/**
+ * @brief GCM 알려진 답 검증 + 위변조 감지 확인
+ * @return 실패한 항목 수
+ */
+static int run_gcm_tests(void) {
+    static const uint8_t zero_key[32] = {0}, zero_iv[12] = {0}, zero_block[16] = {0};
+    static const uint8_t tc13_tag[16] = {
+        0x53, 0x0f, 0x8a, 0xfb, 0xc7, 0x45, 0x36, 0xb9, 0xa9, 0x63, 0xb4, 0xf1, 0xc4, 0xcb, 0x73, 0x8b
+    };
+    static const uint8_t tc14_ct[16] = {
+        0xce, 0xa7, 0x40, 0x3d, 0x4d, 0x60, 0x6b, 0x6e, 0x07, 0x4e, 0xc5, 0xd3, 0xba, 0xf3, 0x9d, 0x18
+    };
+    static const uint8_t tc14_tag[16] = {
+        0xd0, 0xd1, 0xc8, 0xa7, 0x99, 0x99, 0x6b, 0xf0, 0x26, 0x5b, 0x98, 0xb5, 0xd4, 0x8a, 0xb9, 0x19
+    };
+    static const uint8_t tc15_tag[16] = {
+        0xb0, 0x94, 0xda, 0xc5, 0xd9, 0x34, 0x71, 0xbd, 0xec, 0x1a, 0x50, 0x22, 0x70, 0xe3, 0xcc, 0x6c
+    };
+    static const uint8_t tc16_tag[16] = {
+        0x76, 0xfc, 0x6e, 0xce, 0x0f, 0x4e, 0x17, 0x68, 0xcd, 0xdf, 0x88, 0x53, 0xbb, 0x2d, 0x55, 0x1b
+    };
+    static const uint8_t tc17_ct[60] = {
+        0xc3, 0x76, 0x2d, 0xf1, 0xca, 0x78, 0x7d, 0x32, 0xae, 0x47, 0xc1, 0x3b, 0xf1, 0x98, 0x44, 0xcb,
+        0xaf, 0x1a, 0xe1, 0x4d, 0x0b, 0x97, 0x6a, 0xfa, 0xc5, 0x2f, 0xf7, 0xd7, 0x9b, 0xba, 0x9d, 0xe0,
+        0xfe, 0xb5, 0x82, 0xd3, 0x39, 0x34, 0xa4, 0xf0, 0x95, 0x4c, 0xc2, 0x36, 0x3b, 0xc7, 0x3f, 0x78,
+        0x62, 0xac, 0x43, 0x0e, 0x64, 0xab, 0xe4, 0x99, 0xf4, 0x7c, 0x9b, 0x1f
+    };
+    static const uint8_t tc17_tag[16] = {
+        0x3a, 0x33, 0x7d, 0xbf, 0x46, 0xa7, 0x92, 0xc4, 0x5e, 0x45, 0x49, 0x13, 0xfe, 0x2e, 0xa8, 0xf2
+    };
+    /* 1000바이트 평문: 배치(8블록) 경계와 16바이트 경계를 모두 넘는 경우 (OpenSSL로 생성한 태그) */
+    static const uint8_t long_tag[16] = {
+        0x04, 0xd5, 0xb1, 0x62, 0x70, 0x78, 0xc7, 0x98, 0x0c, 0x14, 0x18, 0x14, 0xd2, 0xd1, 0xf7, 0xc6
+    };
+    int fails = 0;
+
+    fails += check_gcm("GCM TC13 (빈 평문)", zero_key, zero_iv, 12, NULL, 0, NULL, NULL, 0, tc13_tag);
+    fails += check_gcm("GCM TC14", zero_key, zero_iv, 12, NULL, 0, zero_block, tc14_ct, 16, tc14_tag);
+    fails += check_gcm("GCM TC15", gcm_key2, gcm_iv2, 12, NULL, 0, gcm_pt2, gcm_ct2, 64, tc15_tag);
+    fails += check_gcm("GCM TC16 (AAD)", gcm_key2, gcm_iv2, 12, gcm_aad2, 20, gcm_pt2, gcm_ct2, 60, tc16_tag);
+    fails += check_gcm("GCM TC17 (8바이트 IV)", gcm_key2, gcm_iv2, 8, gcm_aad2, 20, gcm_pt2, tc17_ct, 60, tc17_tag);
+
+    /* 긴 평문 + 위변조 감지 */
+    uint8_t key[32], iv[12], aad[20], buf[1000], tag[16];
+    uint8_t round_key[240];
+    for (int i = 0; i < 32; i++) key[i] = (uint8_t)i;
+    for (int i = 0; i < 12; i++) iv[i] = (uint8_t)i;
+    for (int i = 0; i < 20; i++) aad[i] = (uint8_t)(i * 5 + 1);
+    for (int i = 0; i < 1000; i++) buf[i] = (uint8_t)(i * 7 + 3);
+    KeyExpansion(round_key, key);
+
+    AES256_GCM_Encrypt(buf, sizeof(buf), aad, sizeof(aad), round_key, iv, sizeof(iv), tag);
+    fails += check("GCM 1000바이트 태그", tag, long_tag, 16);
+
+    buf[500] ^= 0x01;
+    int rc = AES256_GCM_Decrypt(buf, sizeof(buf), aad, sizeof(aad), round_key, iv, sizeof(iv), tag);
+    int wiped = 1;
+    for (size_t i = 0; i < sizeof(buf); i++) wiped &= (buf[i] == 0);
+    printf("  [%s] GCM 위변조 감지 (-3 반환 및 평문 소거)\n", (rc == -3 && wiped) ? "PASS" : "FAIL");
+    if (rc != -3 || !wiped) fails++;
+
+    secure_memzero(round_key, sizeof(round_key));
+    return fails;
+}
+
+#if defined(AES256_HAVE_AESNI) && defined(AES256_HAVE_BITSLICE)
+/**
+ * @brief 비트슬라이스 백엔드에서 GCM이 PCLMULQDQ GHASH를 쓰는지, 결과가 4비트 테이블 경로와 같은지 확인함
+ * @return 실패한 항목 수
+ */
+static int run_gcm_clmul_backend_test(void) {
+    uint8_t key[32], iv[12], aad[20], pt[1000], buf_clmul[1000], buf_table[1000];
+    uint8_t tag_clmul[16], tag_table[16];
+    uint8_t round_key[240];
+    int saved = aes256_cpu_clmul;
+    int fails = 0;
+
+    if (!saved) {
+        printf("  [SKIP] 이 CPU는 PCLMULQDQ를 지원하지 않음\n");
+        return 0;
+    }
+    AES256_SetImpl(AES256_IMPL_BITSLICE);
+
+    /* PCLMULQDQ 경로로 알려진 답 확인 */
+    fails += run_gcm_tests();
+
+    /* 같은 입력을 PCLMULQDQ / 4비트 테이블 경로로 각각 처리하여 비교 */
+    for (int i = 0; i < 32; i++) key[i] = (uint8_t)(i * 3 + 1);
+    for (int i = 0; i < 12; i++) iv[i] = (uint8_t)(0xa0 + i);
+    for (int i = 0; i < 20; i++) aad[i] = (uint8_t)(i * 9);
+    for (int i = 0; i < 1000; i++) pt[i] = (uint8_t)(i * 13 + 5);
+    KeyExpansion(round_key, key);
+
+    memcpy(buf_clmul, pt, sizeof(pt));
+    AES256_GCM_Encrypt(buf_clmul, sizeof(pt), aad, sizeof(aad), round_key, iv, sizeof(iv), tag_clmul);
+    aes256_cpu_clmul = 0;
+    memcpy(buf_table, pt, sizeof(pt));
+    AES256_GCM_Encrypt(buf_table, sizeof(pt), aad, sizeof(aad), round_key, iv, sizeof(iv), tag_table);
+    aes256_cpu_clmul = saved;
+
+    fails += check("비트슬라이스 GCM 암호문 (PCLMULQDQ = 테이블)", buf_clmul, buf_table, sizeof(pt));
+    fails += check("비트슬라이스 GCM 태그 (PCLMULQDQ = 테이블)", tag_clmul, tag_table, 16);
+
+    AES256_SetImpl(AES256_IMPL_AUTO);
+    secure_memzero(round_key, sizeof(round_key));
+    return fails;
+}
+#endif
+
+/* IEEE 1619-2007 부록 B XTS-AES-256 벡터 10~14의 키 (Key1 || Key2), 평문은 00 01 ... ff를 두 번 */
+static const uint8_t xts_key1[32] = {
+    0x27, 0x18, 0x28, 0x18, 0x28, 0x45, 0x90, 0x45, 0x23, 0x53, 0x60, 0x28, 0x74, 0x71, 0x35, 0x26,
+    0x62, 0x49, 0x77, 0x57, 0x24, 0x70, 0x93, 0x69, 0x99, 0x59, 0x57, 0x49, 0x66, 0x96, 0x76, 0x27
+};
+static const uint8_t xts_key2[32] = {
+    0x31, 0x41, 0x59, 0x26, 0x53, 0x58, 0x97, 0x93, 0x23, 0x84, 0x62, 0x64, 0x33, 0x83, 0x27, 0x95,
+    0x02, 0x88, 0x41, 0x97, 0x16, 0x93, 0x99, 0x37, 0x51, 0x05, 0x82, 0x09, 0x74, 0x94, 0x45, 0x92
+};
+/* 벡터 10: 데이터 단위 번호 0xff */
+static const uint8_t xts_ct10[512] = {
+    0x1c, 0x3b, 0x3a, 0x10, 0x2f, 0x77, 0x03, 0x86, 0xe4, 0x83, 0x6c, 0x99, 0xe3, 0x70, 0xcf, 0x9b,
+    0xea, 0x00, 0x80, 0x3f, 0x5e, 0x48, 0x23, 0x57, 0xa4, 0xae, 0x12, 0xd4, 0x14, 0xa3, 0xe6, 0x3b,
+    0x5d, 0x31, 0xe2, 0x76, 0xf8, 0xfe, 0x4a, 0x8d, 0x66, 0xb3, 0x17, 0xf9, 0xac, 0x68, 0x3f, 0x44,
+    0x68, 0x0a, 0x86, 0xac, 0x35, 0xad, 0xfc, 0x33, 0x45, 0xbe, 0xfe, 0xcb, 0x4b, 0xb1, 0x88, 0xfd,
+    0x57, 0x76, 0x92, 0x6c, 0x49, 0xa3, 0x09, 0x5e, 0xb1, 0x08, 0xfd, 0x10, 0x98, 0xba, 0xec, 0x70,
+    0xaa, 0xa6, 0x69, 0x99, 0xa7, 0x2a, 0x82, 0xf2, 0x7d, 0x84, 0x8b, 0x21, 0xd4, 0xa7, 0x41, 0xb0,
+    0xc5, 0xcd, 0x4d, 0x5f, 0xff, 0x9d, 0xac, 0x89, 0xae, 0xba, 0x12, 0x29, 0x61, 0xd0, 0x3a, 0x75,
+    0x71, 0x23, 0xe9, 0x87, 0x0f, 0x8a, 0xcf, 0x10, 0x00, 0x02, 0x08, 0x87, 0x89, 0x14, 0x29, 0xca,
+    0x2a, 0x3e, 0x7a, 0x7d, 0x7d, 0xf7, 0xb1, 0x03, 0x55, 0x16, 0x5c, 0x8b, 0x9a, 0x6d, 0x0a, 0x7d,
+    0xe8, 0xb0, 0x62, 0xc4, 0x50, 0x0d, 0xc4, 0xcd, 0x12, 0x0c, 0x0f, 0x74, 0x18, 0xda, 0xe3, 0xd0,
+    0xb5, 0x78, 0x1c, 0x34, 0x80, 0x3f, 0xa7, 0x54, 0x21, 0xc7, 0x90, 0xdf, 0xe1, 0xde, 0x18, 0x34,
+    0xf2, 0x80, 0xd7, 0x66, 0x7b, 0x32, 0x7f, 0x6c, 0x8c, 0xd7, 0x55, 0x7e, 0x12, 0xac, 0x3a, 0x0f,
+    0x93, 0xec, 0x05, 0xc5, 0x2e, 0x04, 0x93, 0xef, 0x31, 0xa1, 0x2d, 0x3d, 0x92, 0x60, 0xf7, 0x9a,
+    0x28, 0x9d, 0x6a, 0x37, 0x9b, 0xc7, 0x0c, 0x50, 0x84, 0x14, 0x73, 0xd1, 0xa8, 0xcc, 0x81, 0xec,
+    0x58, 0x3e, 0x96, 0x45, 0xe0, 0x7b, 0x8d, 0x96, 0x70, 0x65, 0x5b, 0xa5, 0xbb, 0xcf, 0xec, 0xc6,
+    0xdc, 0x39, 0x66, 0x38, 0x0a, 0xd8, 0xfe, 0xcb, 0x17, 0xb6, 0xba, 0x02, 0x46, 0x9a, 0x02, 0x0a,
+    0x84, 0xe1, 0x8e, 0x8f, 0x84, 0x25, 0x20, 0x70, 0xc1, 0x3e, 0x9f, 0x1f, 0x28, 0x9b, 0xe5, 0x4f,
+    0xbc, 0x48, 0x14, 0x57, 0x77, 0x8f, 0x61, 0x60, 0x15, 0xe1, 0x32, 0x7a, 0x02, 0xb1, 0x40, 0xf1,
+    0x50, 0x5e, 0xb3, 0x09, 0x32, 0x6d, 0x68, 0x37, 0x8f, 0x83, 0x74, 0x59, 0x5c, 0x84, 0x9d, 0x84,
+    0xf4, 0xc3, 0x33, 0xec, 0x44, 0x23, 0x88, 0x51, 0x43, 0xcb, 0x47, 0xbd, 0x71, 0xc5, 0xed, 0xae,
+    0x9b, 0xe6, 0x9a, 0x2f, 0xfe, 0xce, 0xb1, 0xbe, 0xc9, 0xde, 0x24, 0x4f, 0xbe, 0x15, 0x99, 0x2b,
+    0x11, 0xb7, 0x7c, 0x04, 0x0f, 0x12, 0xbd, 0x8f, 0x6a, 0x97, 0x5a, 0x44, 0xa0, 0xf9, 0x0c, 0x29,
+    0xa9, 0xab, 0xc3, 0xd4, 0xd8, 0x93, 0x92, 0x72, 0x84, 0xc5, 0x87, 0x54, 0xcc, 0xe2, 0x94, 0x52,
+    0x9f, 0x86, 0x14, 0xdc, 0xd2, 0xab, 0xa9, 0x91, 0x92, 0x5f, 0xed, 0xc4, 0xae, 0x74, 0xff, 0xac,
+    0x6e, 0x33, 0x3b, 0x93, 0xeb, 0x4a, 0xff, 0x04, 0x79, 0xda, 0x9a, 0x41, 0x0e, 0x44, 0x50, 0xe0,
+    0xdd, 0x7a, 0xe4, 0xc6, 0xe2, 0x91, 0x09, 0x00, 0x57, 0x5d, 0xa4, 0x01, 0xfc, 0x07, 0x05, 0x9f,
+    0x64, 0x5e, 0x8b, 0x7e, 0x9b, 0xfd, 0xef, 0x33, 0x94, 0x30, 0x54, 0xff, 0x84, 0x01, 0x14, 0x93,
+    0xc2, 0x7b, 0x34, 0x29, 0xea, 0xed, 0xb4, 0xed, 0x53, 0x76, 0x44, 0x1a, 0x77, 0xed, 0x43, 0x85,
+    0x1a, 0xd7, 0x7f, 0x16, 0xf5, 0x41, 0xdf, 0xd2, 0x69, 0xd5, 0x0d, 0x6a, 0x5f, 0x14, 0xfb, 0x0a,
+    0xab, 0x1c, 0xbb, 0x4c, 0x15, 0x50, 0xbe, 0x97, 0xf7, 0xab, 0x40, 0x66, 0x19, 0x3c, 0x4c, 0xaa,
+    0x77, 0x3d, 0xad, 0x38, 0x01, 0x4b, 0xd2, 0x09, 0x2f, 0xa7, 0x55, 0xc8, 0x24, 0xbb, 0x5e, 0x54,
+    0xc4, 0xf3, 0x6f, 0xfd, 0xa9, 0xfc, 0xea, 0x70, 0xb9, 0xc6, 0xe6, 0x93, 0xe1, 0x48, 0xc1, 0x51,
+};
+/* 벡터 14: 데이터 단위 번호 0xffffffffff */
+static const uint8_t xts_ct14[512] = {
+    0x64, 0x49, 0x7e, 0x5a, 0x83, 0x1e, 0x4a, 0x93, 0x2c, 0x09, 0xbe, 0x3e, 0x53, 0x93, 0x37, 0x6d,
+    0xaa, 0x59, 0x95, 0x48, 0xb8, 0x16, 0x03, 0x1d, 0x22, 0x4b, 0xbf, 0x50, 0xa8, 0x18, 0xed, 0x23,
+    0x50, 0xea, 0xe7, 0xe9, 0x60, 0x87, 0xc8, 0xa0, 0xdb, 0x51, 0xad, 0x29, 0x0b, 0xd0, 0x0c, 0x1a,
+    0xc1, 0x62, 0x08, 0x57, 0x63, 0x5b, 0xf2, 0x46, 0xc1, 0x76, 0xab, 0x46, 0x3b, 0xe3, 0x0b, 0x80,
+    0x8d, 0xa5, 0x48, 0x08, 0x1a, 0xc8, 0x47, 0xb1, 0x58, 0xe1, 0x26, 0x4b, 0xe2, 0x5b, 0xb0, 0x91,
+    0x0b, 0xbc, 0x92, 0x64, 0x71, 0x08, 0x08, 0x94, 0x15, 0xd4, 0x5f, 0xab, 0x1b, 0x3d, 0x26, 0x04,
+    0xe8, 0xa8, 0xef, 0xf1, 0xae, 0x40, 0x20, 0xcf, 0xa3, 0x99, 0x36, 0xb6, 0x68, 0x27, 0xb2, 0x3f,
+    0x37, 0x1b, 0x92, 0x20, 0x0b, 0xe9, 0x02, 0x51, 0xe6, 0xd7, 0x3c, 0x5f, 0x86, 0xde, 0x5f, 0xd4,
+    0xa9, 0x50, 0x78, 0x19, 0x33, 0xd7, 0x9a, 0x28, 0x27, 0x2b, 0x78, 0x2a, 0x2e, 0xc3, 0x13, 0xef,
+    0xdf, 0xcc, 0x06, 0x28, 0xf4, 0x3d, 0x74, 0x4c, 0x2d, 0xc2, 0xff, 0x3d, 0xcb, 0x66, 0x99, 0x9b,
+    0x50, 0xc7, 0xca, 0x89, 0x5b, 0x0c, 0x64, 0x79, 0x1e, 0xea, 0xa5, 0xf2, 0x94, 0x99, 0xfb, 0x1c,
+    0x02, 0x6f, 0x84, 0xce, 0x5b, 0x5c, 0x72, 0xba, 0x10, 0x83, 0xcd, 0xdb, 0x5c, 0xe4, 0x54, 0x34,
+    0x63, 0x16, 0x65, 0xc3, 0x33, 0xb6, 0x0b, 0x11, 0x59, 0x3f, 0xb2, 0x53, 0xc5, 0x17, 0x9a, 0x2c,
+    0x8d, 0xb8, 0x13, 0x78, 0x2a, 0x00, 0x48, 0x56, 0xa1, 0x65, 0x30, 0x11, 0xe9, 0x3f, 0xb6, 0xd8,
+    0x76, 0xc1, 0x83, 0x66, 0xdd, 0x86, 0x83, 0xf5, 0x34, 0x12, 0xc0, 0xc1, 0x80, 0xf9, 0xc8, 0x48,
+    0x59, 0x2d, 0x59, 0x3f, 0x86, 0x09, 0xca, 0x73, 0x63, 0x17, 0xd3, 0x56, 0xe1, 0x3e, 0x2b, 0xff,
+    0x3a, 0x9f, 0x59, 0xcd, 0x9a, 0xeb, 0x19, 0xcd, 0x48, 0x25, 0x93, 0xd8, 0xc4, 0x61, 0x28, 0xbb,
+    0x32, 0x42, 0x3b, 0x37, 0xa9, 0xad, 0xfb, 0x48, 0x2b, 0x99, 0x45, 0x3f, 0xbe, 0x25, 0xa4, 0x1b,
+    0xf6, 0xfe, 0xb4, 0xaa, 0x0b, 0xef, 0x5e, 0xd2, 0x4b, 0xf7, 0x3c, 0x76, 0x29, 0x78, 0x02, 0x54,
+    0x82, 0xc1, 0x31, 0x15, 0xe4, 0x01, 0x5a, 0xac, 0x99, 0x2e, 0x56, 0x13, 0xa3, 0xb5, 0xc2, 0xf6,
+    0x85, 0xb8, 0x47, 0x95, 0xcb, 0x6e, 0x9b, 0x26, 0x56, 0xd8, 0xc8, 0x81, 0x57, 0xe5, 0x2c, 0x42,
+    0xf9, 0x78, 0xd8, 0x63, 0x4c, 0x43, 0xd0, 0x6f, 0xea, 0x92, 0x8f, 0x28, 0x22, 0xe4, 0x65, 0xaa,
+    0x65, 0x76, 0xe9, 0xbf, 0x41, 0x93, 0x84, 0x50, 0x6c, 0xc3, 0xce, 0x3c, 0x54, 0xac, 0x1a, 0x6f,
+    0x67, 0xdc, 0x66, 0xf3, 0xb3, 0x01, 0x91, 0xe6, 0x98, 0x38, 0x0b, 0xc9, 0x99, 0xb0, 0x5a, 0xbc,
+    0xe1, 0x9d, 0xc0, 0xc6, 0xdc, 0xc2, 0xdd, 0x00, 0x1e, 0xc5, 0x35, 0xba, 0x18, 0xde, 0xb2, 0xdf,
+    0x1a, 0x10, 0x10, 0x23, 0x10, 0x83, 0x18, 0xc7, 0x5d, 0xc9, 0x86, 0x11, 0xa0, 0x9d, 0xc4, 0x8a,
+    0x0a, 0xcd, 0xec, 0x67, 0x6f, 0xab, 0xdf, 0x22, 0x2f, 0x07, 0xe0, 0x26, 0xf0, 0x59, 0xb6, 0x72,
+    0xb5, 0x6e, 0x5c, 0xbc, 0x8e, 0x1d, 0x21, 0xbb, 0xd8, 0x67, 0xdd, 0x92, 0x72, 0x12, 0x05, 0x46,
+    0x81, 0xd7, 0x0e, 0xa7, 0x37, 0x13, 0x4c, 0xdf, 0xce, 0x93, 0xb6, 0xf8, 0x2a, 0xe2, 0x24, 0x23,
+    0x27, 0x4e, 0x58, 0xa0, 0x82, 0x1c, 0xc5, 0x50, 0x2e, 0x2d, 0x0a, 0xb4, 0x58, 0x5e, 0x94, 0xde,
+    0x69, 0x75, 0xbe, 0x5e, 0x0b, 0x4e, 0xfc, 0xe5, 0x1c, 0xd3, 0xe7, 0x0c, 0x25, 0xa1, 0xfb, 0xbb,
+    0xd6, 0x09, 0xd2, 0x73, 0xad, 0x5b, 0x0d, 0x59, 0x63, 0x1c, 0x53, 0x1f, 0x6a, 0x0a, 0x57, 0xb9,
+};
+/* 암호문 훔치기 확인용 (IEEE 1619의 부분 블록 벡터는 AES-128뿐이라 OpenSSL로 만든 값, 평문 = i*7+3) */
+static const uint8_t xts_cts_tweak31[16] = {
+    0x12, 0x34, 0x56, 0x78, 0x90, 0xab, 0xcd, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const uint8_t xts_cts_ct17[17] = {
+    0x08, 0x75, 0x3d, 0xc6, 0xe8, 0xcb, 0x50, 0xaf, 0x07, 0x6d, 0x4c, 0x72, 0x3d, 0x46, 0xc0, 0x20,
+    0x30
+};
+static const uint8_t xts_cts_ct31[31] = {
+    0x44, 0x6a, 0x16, 0x8f, 0x60, 0xe2, 0x6b, 0x56, 0x5a, 0x38, 0xbd, 0x17, 0xd1, 0x0e, 0x04, 0x99,
+    0x4d, 0x81, 0x24, 0x2d, 0x98, 0x4d, 0x29, 0x73, 0x07, 0xbd, 0xf5, 0x8f, 0xcb, 0x8b, 0x73
+};
+
+/**
+ * @brief XTS: IEEE 1619 벡터, 암호문 훔치기, 다중 스레드 섹터 처리, 인자 검사
+ * @return 실패한 항목 수
+ */
+static int run_xts_tests(void) {
+    uint8_t rk1[240], rk2[240];
+    uint8_t pt[512], buf[512], tweak[16] = {0};
+    int fails = 0;
+
+    KeyExpansion(rk1, xts_key1);
+    KeyExpansion(rk2, xts_key2);
+    for (int i = 0; i < 512; i++) pt[i] = (uint8_t)i;
+
+    /* 벡터 10: tweak을 직접 지정 */
+    tweak[0] = 0xff;
+    memcpy(buf, pt, 512);
+    AES256_XTS_Encrypt(buf, 512, rk1, rk2, tweak);
+    fails += check("IEEE 1619 XTS-AES-256 벡터 10 암호화", buf, xts_ct10, 512);
+    AES256_XTS_Decrypt(buf, 512, rk1, rk2, tweak);
+    fails += check("IEEE 1619 XTS-AES-256 벡터 10 복호화", buf, pt, 512);
+
+    /* 교차 폭 1/2/4에서도 같은 결과 */
+    int ok = 1;
+    for (int w = 1; w <= 4; w *= 2) {
+        AES256_SetInterleave(w);
+        memcpy(buf, pt, 512);
+        AES256_XTS_Encrypt(buf, 512, rk1, rk2, tweak);
+        if (memcmp(buf, xts_ct10, 512) != 0) ok = 0;
+        AES256_XTS_Decrypt(buf, 512, rk1, rk2, tweak);
+        if (memcmp(buf, pt, 512) != 0) ok = 0;
+    }
+    AES256_SetInterleave(8);
+    printf("  [%s] XTS 벡터 10 교차 폭 1/2/4\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    /* 벡터 14: 섹터 API (섹터 번호 0xffffffffff) */
+    memcpy(buf, pt, 512);
+    AES256_XTS_EncryptSectors(buf, 512, 1, rk1, rk2, 0xffffffffffULL, 1);
+    fails += check("IEEE 1619 XTS-AES-256 벡터 14 섹터 암호화", buf, xts_ct14, 512);
+    AES256_XTS_DecryptSectors(buf, 512, 1, rk1, rk2, 0xffffffffffULL, 1);
+    fails += check("IEEE 1619 XTS-AES-256 벡터 14 섹터 복호화", buf, pt, 512);
+
+    /* 암호문 훔치기 */
+    uint8_t cts[32];
+    for (int i = 0; i < 32; i++) cts[i] = (uint8_t)(i * 7 + 3);
+    memcpy(buf, cts, 17);
+    memset(tweak, 0, sizeof(tweak));
+    AES256_XTS_Encrypt(buf, 17, rk1, rk2, tweak);
+    fails += check("XTS 암호문 훔치기 17바이트", buf, xts_cts_ct17, 17);
+    memcpy(buf, cts, 31);
+    AES256_XTS_Encrypt(buf, 31, rk1, rk2, xts_cts_tweak31);
+    fails += check("XTS 암호문 훔치기 31바이트", buf, xts_cts_ct31, 31);
+    AES256_XTS_Decrypt(buf, 31, rk1, rk2, xts_cts_tweak31);
+    fails += check("XTS 암호문 훔치기 31바이트 복호화", buf, cts, 31);
+
+    /* 16~200바이트 모든 길이 왕복, 마지막 전체 블록 이전까지는 꼬리가 없는 경우와 같아야 함 */
+    ok = 1;
+    uint8_t full[208];
+    for (size_t len = 16; len <= 200 && ok; len++) {
+        for (size_t i = 0; i < len; i++) buf[i] = (uint8_t)(i * 13 + len);
+        memcpy(full, buf, len);
+        AES256_XTS_Encrypt(buf, len, rk1, rk2, xts_cts_tweak31);
+        size_t nfull = (len / 16) * 16;
+        AES256_XTS_Encrypt(full, nfull, rk1, rk2, xts_cts_tweak31);
+        if (len % 16 != 0 && memcmp(buf, full, nfull - 16) != 0) ok = 0;
+        if (len % 16 == 0 && memcmp(buf, full, len) != 0) ok = 0;
+        AES256_XTS_Decrypt(buf, len, rk1, rk2, xts_cts_tweak31);
+        for (size_t i = 0; i < len; i++) {
+            if (buf[i] != (uint8_t)(i * 13 + len)) ok = 0;
+        }
+    }
+    printf("  [%s] XTS 길이 16~200바이트 왕복 (암호문 훔치기 포함)\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    /* 섹터 37개 (4KB + 8바이트 꼬리)를 스레드 1/3/8개로 처리한 결과가 섹터별 단건 처리와 같아야 함 */
+    const size_t sector = 4096 + 8, nsec = 37;
+    uint8_t* data = (uint8_t*)malloc(sector * nsec);
+    uint8_t* ref = (uint8_t*)malloc(sector * nsec);
+    ok = (data != NULL && ref != NULL);
+    if (ok) {
+        for (size_t i = 0; i < sector * nsec; i++) ref[i] = (uint8_t)((i * 31) ^ (i >> 9));
+        memcpy(data, ref, sector * nsec);
+        for (size_t s = 0; s < nsec; s++) {
+            memset(tweak, 0, sizeof(tweak));
+            uint64_t no = 1000 + s;
+            for (int i = 0; i < 8; i++) tweak[i] = (uint8_t)(no >> (8 * i));
+            AES256_XTS_Encrypt(ref + s * sector, sector, rk1, rk2, tweak);
+        }
+        const int threads[] = {1, 3, 8};
+        for (int t = 0; t < 3 && ok; t++) {
+            uint8_t* work = (uint8_t*)malloc(sector * nsec);
+            if (work == NULL) {
+                ok = 0;
+                break;
+            }
+            memcpy(work, data, sector * nsec);
+            AES256_XTS_EncryptSectors(work, sector, nsec, rk1, rk2, 1000, threads[t]);
+            if (memcmp(work, ref, sector * nsec) != 0) ok = 0;
+            AES256_XTS_DecryptSectors(work, sector, nsec, rk1, rk2, 1000, threads[t]);
+            if (memcmp(work, data, sector * nsec) != 0) ok = 0;
+            free(work);
+        }
+    }
+    printf("  [%s] XTS 섹터 병렬 처리 (섹터 %zu개, 스레드 1/3/8)\n", ok ? "PASS" : "FAIL", nsec);
+    if (!ok) fails++;
+    free(data);
+    free(ref);
+
+    /* 같은 키, 16바이트 미만, 섹터 0개는 거부 */
+    ok = (AES256_XTS_Encrypt(buf, 64, rk1, rk1, tweak) == -1 && AES256_XTS_Encrypt(buf, 15, rk1, rk2, tweak) == -2 &&
+          AES256_XTS_EncryptSectors(buf, 512, 0, rk1, rk2, 0, 1) == -2);
+    printf("  [%s] XTS 잘못된 인자 거부 (같은 키, 짧은 길이)\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    secure_memzero(rk1, sizeof(rk1));
+    secure_memzero(rk2, sizeof(rk2));
+    return fails;
+}
+
+/* SP 800-38B AES-256 CMAC 예제 9~12 (키 = nist_key, 메시지 = nist_cbc_pt의 앞 0/16/40/64바이트) */
+static const size_t cmac_lens[4] = {0, 16, 40, 64};
+static const uint8_t cmac_tags[4][16] = {
+    {0x02, 0x89, 0x62, 0xf6, 0x1b, 0x7b, 0xf8, 0x9e, 0xfc, 0x6b, 0x55, 0x1f, 0x46, 0x67, 0xd9, 0x83},
+    {0x28, 0xa7, 0x02, 0x3f, 0x45, 0x2e, 0x8f, 0x82, 0xbd, 0x4b, 0xf2, 0x8d, 0x8c, 0x37, 0xc3, 0x5c},
+    {0xaa, 0xf3, 0xd8, 0xf1, 0xde, 0x56, 0x40, 0xc2, 0x32, 0xf5, 0xb1, 0x69, 0xb9, 0xc9, 0x11, 0xe6},
+    {0xe1, 0x99, 0x21, 0x90, 0x54, 0x9f, 0x6e, 0xd5, 0x69, 0x6a, 0x2c, 0x05, 0x6c, 0x31, 0x54, 0x10},
+};
+
+/**
+ * @brief CMAC 벡터, CTR + CMAC 한 패스 처리가 2패스(CTR 후 CMAC)와 같은지, 변조 감지
+ * @return 실패한 항목 수
+ */
+static int run_cmac_tests(void) {
+    uint8_t rk[240], rk_mac[240], mac_key[32];
+    uint8_t tag[16];
+    int fails = 0;
+
+    KeyExpansion(rk, nist_key);
+    for (int i = 0; i < 4; i++) {
+        char name[64];
+        AES256_CMAC(nist_cbc_pt, cmac_lens[i], rk, tag);
+        snprintf(name, sizeof(name), "SP 800-38B AES-256 CMAC (%zu바이트)", cmac_lens[i]);
+        fails += check(name, tag, cmac_tags[i], 16);
+    }
+
+    /* 0~300바이트와 큰 메시지(묶음 경계 여러 개)에서 한 패스 결과 = CTR + CMAC(iv || 암호문) */
+    for (int i = 0; i < 32; i++) mac_key[i] = (uint8_t)(nist_key[i] ^ 0xa5);
+    KeyExpansion(rk_mac, mac_key);
+
+    const size_t big = 70000;
+    uint8_t* pt = (uint8_t*)malloc(big);
+    uint8_t* buf = (uint8_t*)malloc(big);
+    uint8_t* two = (uint8_t*)malloc(big + 16);
+    int ok = (pt != NULL && buf != NULL && two != NULL);
+    for (size_t i = 0; ok && i < big; i++) pt[i] = (uint8_t)(i * 29 + (i >> 8));
+
+    for (size_t len = 0; ok && len <= big; len = (len < 300) ? len + 1 : big + 1) {
+        uint8_t tag2[16];
+        memcpy(buf, pt, len);
+        memcpy(two, nist_ctr_iv, 16);
+        memcpy(two + 16, pt, len);
+        AES256_CTR_CMAC_Encrypt(buf, len, rk, rk_mac, nist_ctr_iv, tag);
+        AES256_CTR_Crypt(two + 16, len, rk, nist_ctr_iv, 0);
+        AES256_CMAC(two, len + 16, rk_mac, tag2);
+        if (memcmp(buf, two + 16, len) != 0 || memcmp(tag, tag2, 16) != 0) ok = 0;
+        if (AES256_CTR_CMAC_Decrypt(buf, len, rk, rk_mac, nist_ctr_iv, tag) != 0 || memcmp(buf, pt, len) != 0) ok = 0;
+    }
+    printf("  [%s] CTR + CMAC 한 패스 = 2패스 (0~300, %zu바이트)\n", ok ? "PASS" : "FAIL", big);
+    if (!ok) fails++;
+
+    /* 첫 블록의 암호문 처리는 NIST CTR 벡터와 같아야 함 */
+    if (ok) {
+        memcpy(buf, nist_cbc_pt, 64);
+        AES256_CTR_CMAC_Encrypt(buf, 64, rk, rk_mac, nist_ctr_iv, tag);
+        fails += check("CTR + CMAC 암호문 = SP 800-38A F.5.5", buf, nist_ctr_ct, 64);
+    }
+
+    /* 암호문 1비트 변조 → -3, 평문 대신 0 */
+    if (ok) {
+        memcpy(buf, pt, 1000);
+        AES256_CTR_CMAC_Encrypt(buf, 1000, rk, rk_mac, nist_ctr_iv, tag);
+        buf[500] ^= 0x01;
+        int rc = AES256_CTR_CMAC_Decrypt(buf, 1000, rk, rk_mac, nist_ctr_iv, tag);
+        int zero = 1;
+        for (int i = 0; i < 1000; i++) {
+            if (buf[i] != 0) zero = 0;
+        }
+        ok = (rc == -3 && zero);
+        printf("  [%s] CTR + CMAC 변조 감지 후 버퍼 소거\n", ok ? "PASS" : "FAIL");
+        if (!ok) fails++;
+    }
+
+    ok = (AES256_CTR_CMAC_Encrypt(buf, 64, rk, rk, nist_ctr_iv, tag) == -1 &&
+          AES256_CTR_CMAC_Encrypt(buf, 64, rk, rk_mac, NULL, tag) == -1 && AES256_CMAC(NULL, 16, rk, tag) == -1);
+    printf("  [%s] CTR + CMAC 잘못된 인자 거부 (같은 키)\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    free(pt);
+    free(buf);
+    free(two);
+    secure_memzero(rk, sizeof(rk));
+    secure_memzero(rk_mac, sizeof(rk_mac));
+    return fails;
+}
+
+/* CTR-DRBG (AES-256, 유도 함수 없음) 기대값: OpenSSL EVP_RAND "CTR-DRBG"(use_df=0)로 생성
+ * - 개인화 문자열이 없는 경우는 길이 0으로 넘김 (NULL이면 OpenSSL이 기본 문자열을 넣음)
+ * - entropy1[i] = 3i + 1, entropy2[i] = 0xa0 + i, add[i] = 0x33 + i, pers[i] = 0x55 ^ i (각 48바이트)
+ * - Instantiate(entropy1, pers) → Generate 64 → Reseed(entropy2) → Generate 64
+ *   → Generate 37 (add 48바이트) → Generate 64 (add 앞 20바이트)
+ * - [0]: 개인화 문자열 없음, [1]: 있음 */
+static const uint8_t drbg_gen64[2][2][64] = {
+    {
+        {
+        0xb7, 0xf3, 0x21, 0xa9, 0x8e, 0x11, 0x0d, 0x12, 0x5d, 0x42, 0xeb, 0x0f, 0x11, 0x11, 0x26, 0x55,
+        0xfb, 0x45, 0x2f, 0x35, 0xce, 0xd5, 0xca, 0xb3, 0x8a, 0xbb, 0xdb, 0xf1, 0xff, 0x5c, 0x50, 0x98,
+        0x7e, 0x18, 0x30, 0xa5, 0x8f, 0x94, 0x15, 0x8e, 0xfa, 0xd8, 0x16, 0x07, 0x1a, 0xdf, 0xce, 0x15,
+        0x21, 0x28, 0x18, 0x85, 0xb0, 0x0e, 0xa3, 0x0f, 0x65, 0x78, 0x5d, 0x41, 0xf3, 0x55, 0xf7, 0x46,
+        },
+        {
+        0xb7, 0xfe, 0x37, 0x29, 0x8e, 0x50, 0x0d, 0xba, 0x88, 0xeb, 0xcc, 0xe9, 0xe1, 0x8b, 0x98, 0xc0,
+        0x81, 0xf8, 0xc2, 0x4e, 0x7a, 0xa6, 0xab, 0x6a, 0xd1, 0x61, 0x0e, 0x65, 0x8d, 0x6b, 0x04, 0xd2,
+        0x76, 0xa1, 0x0a, 0x9c, 0xc8, 0x81, 0x7b, 0xb8, 0x75, 0xc4, 0x0a, 0x32, 0x34, 0x9f, 0x32, 0x4e,
+        0x0a, 0x38, 0x09, 0xed, 0x9e, 0x69, 0x0a, 0x67, 0x36, 0x97, 0x97, 0x04, 0xbe, 0x57, 0x15, 0x1b,
+        },
+    },
+    {
+        {
+        0xcc, 0x57, 0x32, 0xa4, 0x9d, 0x7d, 0x05, 0xe0, 0x0e, 0x82, 0xd7, 0x7d, 0xe3, 0x74, 0x46, 0xc5,
+        0x24, 0x7e, 0x1c, 0x1c, 0x83, 0x78, 0x42, 0xf3, 0x45, 0x23, 0xc4, 0x8f, 0x59, 0xd5, 0x04, 0xa5,
+        0x24, 0xc1, 0xe8, 0x59, 0x61, 0xcd, 0x78, 0xbb, 0xad, 0x7f, 0x4d, 0x72, 0xad, 0x33, 0x5e, 0xfc,
+        0x11, 0x64, 0x49, 0xc9, 0x04, 0xe3, 0x54, 0x8a, 0xc6, 0xf5, 0xa1, 0x4f, 0x03, 0x24, 0x15, 0x10,
+        },
+        {
+        0x62, 0xca, 0xe0, 0x34, 0x96, 0x07, 0x21, 0x67, 0x73, 0x57, 0xd3, 0x8d, 0x32, 0xce, 0xc2, 0xe2,
+        0x69, 0x40, 0x11, 0xe3, 0xe6, 0x45, 0xaf, 0xa8, 0x77, 0x41, 0x77, 0x2d, 0xa5, 0x56, 0x12, 0x54,
+        0x01, 0xc2, 0x9a, 0xb0, 0x49, 0xc5, 0x64, 0x0e, 0xca, 0x00, 0x5f, 0xa3, 0x9f, 0xbe, 0x35, 0x7f,
+        0x4e, 0xba, 0x3f, 0xa8, 0xce, 0xd1, 0xb6, 0x9f, 0x41, 0x6d, 0x85, 0xa2, 0x7f, 0xbe, 0xc5, 0x65,
+        },
+    },
+};
+static const uint8_t drbg_gen37[2][37] = {
+    {
+        0xe3, 0x5d, 0x96, 0x83, 0x37, 0x28, 0x9d, 0xb6, 0x6b, 0xb9, 0xc2, 0x23, 0xc2, 0x8b, 0xd9, 0xde,
+        0xa1, 0xc8, 0x1e, 0x5d, 0xcf, 0x96, 0xae, 0xe8, 0x43, 0x5a, 0xaf, 0x12, 0x6d, 0x1e, 0xb9, 0xb4,
+        0xe7, 0x0f, 0x28, 0xa0, 0x49,
+    },
+    {
+        0xf5, 0xa0, 0x4c, 0xc8, 0x98, 0x8a, 0x49, 0xba, 0xe6, 0x3e, 0xf0, 0x29, 0xe3, 0x46, 0xb4, 0xee,
+        0xbb, 0xf8, 0x98, 0xf7, 0x8e, 0xb7, 0xc6, 0x18, 0xef, 0x71, 0x61, 0xe1, 0x28, 0xe9, 0x4b, 0xbe,
+        0xf6, 0x41, 0xdd, 0x27, 0xff,
+    },
+};
+static const uint8_t drbg_gen64_add20[2][64] = {
+    {
+        0xbd, 0xae, 0xdb, 0x88, 0xf4, 0xb3, 0x57, 0x7b, 0x20, 0x6a, 0x51, 0xae, 0xc0, 0xa6, 0xd0, 0x6f,
+        0x16, 0x75, 0xed, 0x3e, 0x56, 0xcc, 0xb9, 0xa4, 0x96, 0xc1, 0xed, 0x0d, 0x0e, 0x00, 0x85, 0xf3,
+        0x1f, 0x6b, 0xa3, 0x51, 0xb3, 0x20, 0x1e, 0x29, 0xcc, 0x4d, 0x2d, 0xac, 0xc5, 0x4c, 0xf9, 0x71,
+        0x72, 0x69, 0xdb, 0xad, 0x44, 0x4a, 0x8b, 0x4a, 0x72, 0x66, 0x54, 0xa8, 0x05, 0x2a, 0xbd, 0x6d,
+    },
+    {
+        0xb9, 0x80, 0x83, 0x11, 0x61, 0xb1, 0x06, 0x9e, 0x65, 0x1e, 0xa8, 0x98, 0xa3, 0xc8, 0x66, 0x37,
+        0x85, 0x3f, 0x7a, 0xd0, 0x5e, 0xf5, 0x20, 0xac, 0xef, 0xeb, 0x14, 0x8e, 0x82, 0x92, 0x57, 0xed,
+        0x30, 0x09, 0xd4, 0x97, 0x1b, 0x58, 0x0a, 0x31, 0x1a, 0x7b, 0x5d, 0xf3, 0x49, 0xf4, 0x77, 0xc4,
+        0x00, 0x84, 0x02, 0x51, 0x96, 0x4e, 0x91, 0x3f, 0x14, 0x2c, 0xbf, 0xa2, 0x1f, 0xf1, 0xa6, 0xa3,
+    },
+};
+
+static void* drbg_thread_fn(void* arg) {
+    AES256_RandomBytes((uint8_t*)arg, 32);
+    return NULL;
+}
+
+static int run_drbg_tests(void) {
+    uint8_t ent1[48], ent2[48], add[48], pers[48], out[64];
+    AES256_DRBG drbg;
+    int fails = 0;
+
+    for (int i = 0; i < 48; i++) {
+        ent1[i] = (uint8_t)(i * 3 + 1);
+        ent2[i] = (uint8_t)(0xa0 + i);
+        add[i] = (uint8_t)(0x33 + i);
+        pers[i] = (uint8_t)(0x55 ^ i);
+    }
+
+    for (int p = 0; p < 2; p++) {
+        const char* tag = p ? "개인화 있음" : "개인화 없음";
+        char name[96];
+        AES256_DRBG_Instantiate(&drbg, ent1, p ? pers : NULL, p ? 48 : 0);
+        AES256_DRBG_Generate(&drbg, out, 64, NULL, 0);
+        snprintf(name, sizeof(name), "CTR-DRBG Generate (%s)", tag);
+        fails += check(name, out, drbg_gen64[p][0], 64);
+        AES256_DRBG_Reseed(&drbg, ent2, NULL, 0);
+        AES256_DRBG_Generate(&drbg, out, 64, NULL, 0);
+        snprintf(name, sizeof(name), "CTR-DRBG Reseed 후 Generate (%s)", tag);
+        fails += check(name, out, drbg_gen64[p][1], 64);
+        AES256_DRBG_Generate(&drbg, out, 37, add, 48);
+        snprintf(name, sizeof(name), "CTR-DRBG 추가 입력 + 37바이트 (%s)", tag);
+        fails += check(name, out, drbg_gen37[p], 37);
+        AES256_DRBG_Generate(&drbg, out, 64, add, 20);
+        snprintf(name, sizeof(name), "CTR-DRBG 짧은 추가 입력 (%s)", tag);
+        fails += check(name, out, drbg_gen64_add20[p], 64);
+    }
+
+    /* 요청/추가 입력 길이 제한과 재시드 주기 */
+    int ok = (AES256_DRBG_Generate(&drbg, out, 0, NULL, 0) == 0 &&
+              AES256_DRBG_Generate(&drbg, NULL, 64 * 1024 + 1, NULL, 0) == -1 &&
+              AES256_DRBG_Generate(&drbg, out, 16, add, 49) == -2 &&
+              AES256_DRBG_Instantiate(&drbg, ent1, pers, 49) == -2);
+    drbg.reseed_counter = AES256_DRBG_RESEED_INTERVAL + 1;
+    ok = ok && AES256_DRBG_Generate(&drbg, out, 16, NULL, 0) == -3;
+    ok = ok && AES256_DRBG_Reseed(&drbg, ent2, NULL, 0) == 0 && AES256_DRBG_Generate(&drbg, out, 16, NULL, 0) == 0;
+    AES256_DRBG_Clear(&drbg);
+    ok = ok && AES256_DRBG_Generate(&drbg, out, 16, NULL, 0) == -3;
+    printf("  [%s] CTR-DRBG 길이 제한/재시드 주기 검사\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    /* 스레드별 생성기: 여러 Generate 요청에 걸친 긴 출력, IV끼리 중복 없음 */
+    const size_t nivs = 5000;
+    uint8_t* ivs = (uint8_t*)malloc(nivs * 16);
+    ok = (ivs != NULL && AES256_RandomIVs(ivs, nivs) == 0);
+    for (size_t i = 1; ok && i < nivs; i++) {
+        if (memcmp(ivs + (i - 1) * 16, ivs + i * 16, 16) == 0) ok = 0;
+    }
+    size_t ones = 0;
+    for (size_t i = 0; ok && i < nivs * 16; i++) ones += (size_t)__builtin_popcount(ivs[i]);
+    /* 640000비트 중 1의 비율이 50%에서 크게 벗어나지 않아야 함 (표준편차 약 400) */
+    ok = ok && ones > 320000 - 4000 && ones < 320000 + 4000;
+    printf("  [%s] RandomIVs %zu개 (64KB 요청 경계 포함)\n", ok ? "PASS" : "FAIL", nivs);
+    if (!ok) fails++;
+    free(ivs);
+
+    ok = (AES256_RandomBytes(NULL, 0) == 0 && AES256_RandomBytes(NULL, 1) == -1 && AES256_RandomReseed() == 0);
+    printf("  [%s] RandomBytes 인자 검사와 강제 재시드\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    /* 스레드마다 다른 출력 */
+    uint8_t a[32], b[32];
+    pthread_t th[2];
+    ok = (pthread_create(&th[0], NULL, drbg_thread_fn, a) == 0);
+    ok = (pthread_create(&th[1], NULL, drbg_thread_fn, b) == 0) && ok;
+    pthread_join(th[0], NULL);
+    pthread_join(th[1], NULL);
+    ok = ok && memcmp(a, b, 32) != 0;
+    printf("  [%s] 스레드별 생성기 출력이 서로 다름\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    /* fork 후 자식은 부모와 같은 출력을 내지 않아야 함 */
+    int fd[2];
+    ok = (pipe(fd) == 0);
+    if (ok) {
+        AES256_RandomBytes(a, 1);           /* fork 전에 부모 상태를 만들어 둠 */
+        pid_t pid = fork();
+        if (pid == 0) {
+            uint8_t c[32];
+            close(fd[0]);
+            int wr = (AES256_RandomBytes(c, 32) == 0 && write(fd[1], c, 32) == 32);
+            _exit(wr ? 0 : 1);
+        }
+        close(fd[1]);
+        int st = 0;
+        ok = (pid > 0 && read(fd[0], b, 32) == 32 && waitpid(pid, &st, 0) == pid && WIFEXITED(st) &&
+              WEXITSTATUS(st) == 0 && AES256_RandomBytes(a, 32) == 0 && memcmp(a, b, 32) != 0);
+        close(fd[0]);
+    }
+    printf("  [%s] fork 후 자식 프로세스 재시드\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    return fails;
+}
+
+/**
+ * @brief 자동 조정: 측정 결과 적용/캐시 저장, 캐시 적중, 다른 머신이나 깨진 캐시는 다시 측정
+ * @return 실패한 항목 수
+ */
+static int run_tune_tests(void) {
+    char path[] = "/tmp/ase256_tune_XXXXXX";
+    int fails = 0;
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        printf("  [FAIL] 임시 파일 준비 실패\n");
+        return 1;
+    }
+    close(fd);
+
+    AES256_TUNE t1, t2;
+    int rc = AES256_Autotune(path, AES256_TUNE_FORCE, &t1);
+    int ok = (rc == 0 && !t1.from_cache && AES256_GetImpl() == t1.impl && AES256_GetInterleave() == t1.interleave &&
+              AES256_GetThreads() == t1.threads && AES256_GetSplitSize() == t1.split_bytes &&
+              t1.impl != AES256_IMPL_TTABLE && t1.impl != AES256_IMPL_REF);
+    printf("  [%s] 측정 후 적용 (%s, 교차 %d, 스레드 %d, %.1f ms)\n", ok ? "PASS" : "FAIL",
+           AES256_ImplName(t1.impl), t1.interleave, t1.threads, t1.tune_ms);
+    if (!ok) fails++;
+
+    /* 설정을 바꿔 둔 뒤 캐시에서 다시 적용 */
+    AES256_SetInterleave(t1.interleave == 1 ? 2 : 1);
+    AES256_SetSplitSize(1024 * 1024);
+    rc = AES256_Autotune(path, 0, &t2);
+    ok = (rc == 0 && t2.from_cache && t2.impl == t1.impl && t2.interleave == t1.interleave &&
+          t2.threads == t1.threads && t2.split_bytes == t1.split_bytes &&
+          AES256_GetInterleave() == t1.interleave && AES256_GetSplitSize() == t1.split_bytes);
+    printf("  [%s] 캐시 적중 시 측정 없이 같은 설정 적용\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    /* CPU 식별 문자열이 다르거나, 후보 조건이 다르거나, 내용이 깨진 캐시는 무시하고 다시 측정 */
+    size_t len = 0;
+    uint8_t* text = read_whole_file(path, &len);
+    ok = (text != NULL);
+    static const char* bad[] = {"cpu other-machine|00000000\n", "tables 1\n", "interleave 3\n", "garbage\n"};
+    for (size_t i = 0; ok && i < sizeof(bad) / sizeof(bad[0]); i++) {
+        FILE* fp = fopen(path, "wb");
+        if (i < 3) {
+            /* 원래 내용에서 해당 키 줄만 바꿈 */
+            const char* key_end = strchr(bad[i], ' ');
+            size_t key_len = (size_t)(key_end - bad[i]) + 1;
+            const char* p = (const char*)text;
+            while (p < (const char*)text + len) {
+                const char* nl = memchr(p, '\n', (size_t)((const char*)text + len - p));
+                size_t line_len = nl ? (size_t)(nl - p) + 1 : (size_t)((const char*)text + len - p);
+                if (strncmp(p, bad[i], key_len) == 0) {
+                    fputs(bad[i], fp);
+                } else {
+                    fwrite(p, 1, line_len, fp);
+                }
+                p += line_len;
+            }
+        } else {
+            fputs(bad[i], fp);
+        }
+        fclose(fp);
+        ok = (AES256_Autotune(path, AES256_TUNE_NO_SAVE, &t2) == 0 && !t2.from_cache);
+    }
+    ok = ok && AES256_Autotune(path, 0, &t2) == 0 && !t2.from_cache && AES256_Autotune(path, 0, &t2) == 0 && t2.from_cache;
+    printf("  [%s] 다른 머신/조건이나 깨진 캐시는 다시 측정\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+    free(text);
+
+    ok = (AES256_Autotune(path, 0x100, NULL) == -1 && AES256_SetSplitSize(1024) == -1);
+    printf("  [%s] 자동 조정 잘못된 인자 거부\n", ok ? "PASS" : "FAIL");
+    if (!ok) fails++;
+
+    /* 다른 테스트가 기본 설정을 전제로 하므로 되돌림 */
+    AES256_SetImpl(AES256_IMPL_AUTO);
+    AES256_SetInterleave(8);
+    AES256_SetThreads(1);
+    AES256_SetSplitSize(256 * 1024);
+    unlink(path);
+    return fails;
+}
+
+int main() {
+    int fails = 0;
+
+#ifdef AES256_HAVE_BITSLICE
+    printf("\n=== 비트슬라이스 회로 검증 ===\n");
+    fails += run_bitslice_sbox_test();
+    fails += run_bitslice_key_schedule_test();
+#endif
+
+#if defined(AES256_HAVE_AESNI) && defined(AES256_HAVE_BITSLICE)
+    printf("\n=== 비트슬라이스 백엔드 GCM (PCLMULQDQ GHASH) ===\n");
+    fails += run_gcm_clmul_backend_test();
+#endif
+
+    printf("\n=== 청크 암호화 컨테이너 ===\n");
+    fails += run_file_tests();
+    fails += run_file_pipe_tests();
+
+    printf("\n=== 비동기 작업 서비스 ===\n");
+    fails += run_async_tests();
+
+    printf("\n=== 자동 조정 ===\n");
+    fails += run_tune_tests();
+
+    /* 백엔드별로 KAT 및 모드별 검증을 반복함 (성능 측정은 make bench) */
+    for (int impl = AES256_IMPL_AUTO + 1; impl < AES256_IMPL_COUNT; impl++) {
+        if (AES256_SetImpl((aes256_impl_t)impl) != 0) {
+            printf("\n=== 백엔드: %s (이 CPU에서 사용 불가, 건너뜀) ===\n", AES256_ImplName((aes256_impl_t)impl));
+            continue;
+        }
+
+        printf("\n=== 백엔드: %s ===\n", AES256_ImplName((aes256_impl_t)impl));
+        fails += run_known_answer_tests();
+        fails += run_parallel_cbc_tests();
+        fails += run_cbc_stream_tests();
+        fails += run_cbc_multi_tests();
+        fails += run_cbc_iov_tests();
+        fails += run_key_cache_tests();
+        fails += run_ctr_offset_tests();
+        fails += run_cmac_tests();
+        fails += run_drbg_tests();
+        fails += run_gcm_tests();
+        fails += run_xts_tests();
+    }
+    AES256_SetImpl(AES256_IMPL_AUTO);
 
-    return 0;
+    printf("\n최종 결과: %s (실패 %d건)\n", fails == 0 ? "성공" : "실패", fails);
+    return fails == 0 ? 0 : 1;
 }
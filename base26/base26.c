@@ -1,7 +1,23 @@
+// mmap/fcntl 사용을 위해 POSIX 선언 노출 (-std=c11)
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdbool.h>
 #include <limits.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <stdatomic.h>
+#include <threads.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 // 26진수 변환에 사용할 문자 배열 (0~9, A~P)
 static const char CHS[] = "0123456789ABCDEFGHIJKLMNOP";
@@ -47,7 +63,857 @@ bool todec(const char *str, long *num) {
     return true;
 }
 
-int main(void) {
+// ---------------------------------------------------------------------------
+// 고정 폭 필드 일괄 변환
+// - 필드를 16자 블록으로 보고 (짧으면 앞을 '0'으로 채움) 한 번에 범위 검사 후,
+//   두 자리씩(x26), 네 자리씩(x676) 곱셈-덧셈으로 26^4 단위 청크 4개를 만들어 합침
+// - 오버플로는 자릿수마다 나누지 않고 필드당 한 번 비교로 판정함
+// ---------------------------------------------------------------------------
+
+#define B26_P4  456976ULL                     // 26^4
+#define B26_P12 95428956661682176ULL          // 26^12
+// 최상위 청크(상위 4자리) 허용 한계: LONG_MAX / 26^12 = 96 (나머지는 B26_REM 이하이어야 함)
+#define B26_TOP 96ULL
+#define B26_REM ((unsigned long long)LONG_MAX - B26_TOP * B26_P12)
+
+#if !defined(__SSE2__)
+// 문자 -> 값 테이블 (유효하지 않은 문자는 0x80). 처음 쓸 때 채우면 여러 스레드가 동시에 쓸 수 있으므로
+// SSE2 경로처럼 실행 중 상태 없이 상수로 둠 ('0'~'9' = 0x30~0x39, 'A'~'P' = 0x41~0x50)
+static const unsigned char B26_VAL[256] = {
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+       0,    1,    2,    3,    4,    5,    6,    7,    8,    9, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80,   10,   11,   12,   13,   14,   15,   16,   17,   18,   19,   20,   21,   22,   23,   24,
+      25, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+};
+#endif
+
+// 16자를 검사하고 26^4 단위 청크 4개(앞쪽이 상위)로 변환. 유효하지 않은 문자가 있으면 false
+static inline bool b26_chunks16(const unsigned char *p, uint32_t c[4]) {
+#if defined(__SSE2__)
+    __m128i x = _mm_loadu_si128((const __m128i *)(const void *)p);
+    // 부호 없는 범위 비교: min(v, hi) == v 이면 v <= hi
+    __m128i d = _mm_sub_epi8(x, _mm_set1_epi8('0'));
+    __m128i a = _mm_sub_epi8(x, _mm_set1_epi8('A'));
+    __m128i isd = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+    __m128i isa = _mm_cmpeq_epi8(_mm_min_epu8(a, _mm_set1_epi8(15)), a);
+    if (_mm_movemask_epi8(_mm_or_si128(isd, isa)) != 0xFFFF) return false;
+
+    __m128i v = _mm_or_si128(_mm_and_si128(isd, d), _mm_and_si128(isa, _mm_add_epi8(a, _mm_set1_epi8(10))));
+    // 2자리: 짝수 바이트(상위 자리) * 26 + 홀수 바이트
+    __m128i hi = _mm_and_si128(v, _mm_set1_epi16(0xFF));
+    __m128i lo = _mm_srli_epi16(v, 8);
+    __m128i p2 = _mm_add_epi16(_mm_mullo_epi16(hi, _mm_set1_epi16(26)), lo);
+    // 4자리: 짝수 16비트 * 676 + 홀수 16비트
+    __m128i p4 = _mm_madd_epi16(p2, _mm_set1_epi32((1 << 16) | 676));
+    _mm_storeu_si128((__m128i *)(void *)c, p4);
+    return true;
+#else
+    unsigned bad = 0;
+    for (int k = 0; k < 4; k++) {
+        unsigned v0 = B26_VAL[p[4 * k]], v1 = B26_VAL[p[4 * k + 1]];
+        unsigned v2 = B26_VAL[p[4 * k + 2]], v3 = B26_VAL[p[4 * k + 3]];
+        bad |= v0 | v1 | v2 | v3;
+        c[k] = (v0 * 26 + v1) * 676 + (v2 * 26 + v3);
+    }
+    return (bad & 0x80) == 0;
+#endif
+}
+
+// 필드 앞부분(16자를 넘는 부분)이 모두 '0'인지 검사
+static inline bool b26_all_zero(const unsigned char *p, size_t n) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(const void *)(p + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_set1_epi8('0'))) != 0xFFFF) return false;
+    }
+#endif
+    unsigned diff = 0;
+    for (; i < n; i++) diff |= (unsigned)(p[i] ^ '0');
+    return diff == 0;
+}
+
+// 고정 폭 26진수 필드 배열을 한 번에 10진수로 변환하는 함수 (NUL 종단 불필요)
+// - 필드 i는 src + i * stride 위치의 width 바이트 (앞쪽 '0' 채움 허용, 공백/부호 불가)
+// - out[i]  : 변환 결과 (유효하지 않은 필드는 0)
+// - mask    : 필드 i가 유효하면 mask[i / 8]의 (i % 8)번 비트가 1 ((count + 7) / 8 바이트 필요)
+// - 반환값  : 유효한 필드 수 (인자 오류 시 0)
+size_t todec_batch(const char *src, size_t width, size_t stride, size_t count, long *out, unsigned char *mask) {
+    if (!src || !out || !mask || width == 0 || stride < width) return 0;
+    const unsigned char *base = (const unsigned char *)src;
+    unsigned char pad[16];
+    size_t nvalid = 0;
+    unsigned bits = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        const unsigned char *f = base + i * stride;
+        const unsigned char *blk;
+        bool ok = true;
+
+        if (width >= 16) {
+            ok = b26_all_zero(f, width - 16);
+            blk = f + width - 16;
+        } else {
+            // 16자보다 짧은 필드는 앞을 '0'으로 채워 오른쪽 정렬
+            memset(pad, '0', 16 - width);
+            memcpy(pad + 16 - width, f, width);
+            blk = pad;
+        }
+
+        uint32_t c[4];
+        ok = b26_chunks16(blk, c) && ok;
+
+        // 하위 12자리는 항상 26^12 미만이라 64비트에 들어가고, 상위 4자리 청크만 한계와 비교
+        unsigned long long low = ((unsigned long long)c[1] * B26_P4 + c[2]) * B26_P4 + c[3];
+        unsigned long long top = c[0];
+        ok = ok && (top < B26_TOP || (top == B26_TOP && low <= B26_REM));
+
+        out[i] = ok ? (long)(top * B26_P12 + low) : 0;
+        nvalid += ok;
+        bits |= (unsigned)ok << (i & 7);
+        if ((i & 7) == 7) {
+            mask[i >> 3] = (unsigned char)bits;
+            bits = 0;
+        }
+    }
+    if (count & 7) mask[count >> 3] = (unsigned char)bits;
+
+    return nvalid;
+}
+
+// ---------------------------------------------------------------------------
+// 나눗셈 없는 인코더
+// - 값을 26^4 단위 청크로 나누고 (역수 곱셈), 청크는 다시 676(26^2) 단위 두 쌍으로 나눠
+//   두 글자씩 쌍 테이블에서 복사함. 뒤에서부터 한 번만 쓰므로 자릿수를 미리 셀 필요가 없음
+// ---------------------------------------------------------------------------
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 b26_u128;
+#endif
+
+// "00" "01" ... "PP": 676개 두 글자 쌍 (쌍 값 v의 문자는 B26_PAIRS[2v], B26_PAIRS[2v+1])
+#define B26_ROW(h) h "0" h "1" h "2" h "3" h "4" h "5" h "6" h "7" h "8" h "9" h "A" h "B" h "C" \
+                   h "D" h "E" h "F" h "G" h "H" h "I" h "J" h "K" h "L" h "M" h "N" h "O" h "P"
+static const char B26_PAIRS[] =
+    B26_ROW("0") B26_ROW("1") B26_ROW("2") B26_ROW("3") B26_ROW("4") B26_ROW("5") B26_ROW("6")
+    B26_ROW("7") B26_ROW("8") B26_ROW("9") B26_ROW("A") B26_ROW("B") B26_ROW("C") B26_ROW("D")
+    B26_ROW("E") B26_ROW("F") B26_ROW("G") B26_ROW("H") B26_ROW("I") B26_ROW("J") B26_ROW("K")
+    B26_ROW("L") B26_ROW("M") B26_ROW("N") B26_ROW("O") B26_ROW("P");
+#undef B26_ROW
+
+// 26^0 .. 26^13 (26^14는 2^64를 넘음)
+static const uint64_t B26_POW[14] = {
+    1ULL, 26ULL, 676ULL, 17576ULL, 456976ULL, 11881376ULL, 308915776ULL, 8031810176ULL,
+    208827064576ULL, 5429503678976ULL, 141167095653376ULL, 3670344486987776ULL,
+    95428956661682176ULL, 2481152873203736576ULL};
+
+// n / 26^4: 26^4 = 16 * 28561 이므로 (n >> 4)에 28561의 역수(2^75 기준)를 곱해 상위 비트를 취함
+static inline uint64_t b26_div_p4(uint64_t n) {
+#if defined(__SIZEOF_INT128__)
+    return (uint64_t)(((b26_u128)(n >> 4) * 0x125B55F2E54C64DBULL) >> 75);
+#else
+    return n / B26_P4;
+#endif
+}
+
+// c / 676 (c < 26^4): 198547 / 2^27 역수 곱셈 (전 범위에서 정확함)
+static inline uint32_t b26_div_676(uint32_t c) {
+    return (uint32_t)(((uint64_t)c * 198547u) >> 27);
+}
+
+// n의 자릿수를 end 바로 앞에서부터 거꾸로 씀 (최소 1자리). 첫 글자 위치를 반환
+static inline char *b26_emit(uint64_t n, char *end) {
+    char *p = end;
+    while (n >= B26_P4) {
+        uint64_t q = b26_div_p4(n);
+        uint32_t c = (uint32_t)(n - q * B26_P4);
+        uint32_t hi = b26_div_676(c);
+        memcpy(p - 2, B26_PAIRS + 2 * (c - hi * 676), 2);
+        memcpy(p - 4, B26_PAIRS + 2 * hi, 2);
+        p -= 4;
+        n = q;
+    }
+    uint32_t c = (uint32_t)n;
+    if (c >= 676) {
+        uint32_t hi = b26_div_676(c);
+        memcpy(p - 2, B26_PAIRS + 2 * (c - hi * 676), 2);
+        p -= 2;
+        c = hi;
+    }
+    if (c >= 26) {
+        memcpy(p - 2, B26_PAIRS + 2 * c, 2);
+        p -= 2;
+    } else {
+        *--p = CHS[c];
+    }
+    return p;
+}
+
+// tmp[beg..end) 결과를 width 규칙에 맞춰 buf에 복사 (NUL 포함). 실패 시 0
+static size_t b26_finish(const char *beg, const char *end, size_t width, char *buf, size_t siz) {
+    size_t len = (size_t)(end - beg);
+    size_t out = width ? width : len;
+    if (len > out || out >= siz) return 0;
+    memset(buf, '0', out - len);
+    memcpy(buf + out - len, beg, len);
+    buf[out] = '\0';
+    return out;
+}
+
+// 부호 없는 64비트 값을 26진수 문자열로 변환 (하드웨어 나눗셈 없음)
+// - width가 0이면 필요한 자릿수만, 아니면 앞을 '0'으로 채운 width자리 (값이 더 길면 실패)
+// - 반환값: 쓴 글자 수 (NUL 제외), 버퍼 부족이나 폭 초과 시 0
+size_t dec26_u64(uint64_t num, size_t width, char *buf, size_t siz) {
+    if (!buf) return 0;
+    char tmp[16];
+    char *end = tmp + sizeof(tmp);
+    return b26_finish(b26_emit(num, end), end, width, buf, siz);
+}
+
+#if defined(__SIZEOF_INT128__)
+// 부호 없는 128비트 값을 26진수 문자열로 변환 (최대 28자리, 규칙은 dec26_u64와 같음)
+// - 2^64 이상이면 26^13 단위로 최대 두 번 나눈 뒤 (컴파일러의 128비트 상수 나눗셈),
+//   13자리씩 64비트 경로로 씀
+size_t dec26_u128(b26_u128 num, size_t width, char *buf, size_t siz) {
+    if (!buf) return 0;
+    if ((uint64_t)(num >> 64) == 0) return dec26_u64((uint64_t)num, width, buf, siz);
+
+    const uint64_t d = B26_POW[13];
+    char tmp[32];
+    char *end = tmp + sizeof(tmp);
+    char *p = end;
+    for (;;) {
+        b26_u128 q = num / d;
+        char *s = b26_emit((uint64_t)(num - q * d), p);
+        while (s > p - 13) *--s = '0';  // 하위 청크는 항상 13자리
+        p = s;
+        num = q;
+        if ((uint64_t)(num >> 64) == 0) break;
+    }
+    return b26_finish(b26_emit((uint64_t)num, p), end, width, buf, siz);
+}
+#endif
+
+// 64비트 값 배열을 고정 폭 26진수 필드로 일괄 변환 (todec_batch와 같은 배치, NUL 없음)
+// - nums[i]는 out + i * stride 위치에 '0'으로 채운 width자리로 씀 (1 <= width, width <= stride)
+// - 반환값: 앞에서부터 변환한 개수. width자리에 들어가지 않는 값을 만나면 거기서 멈춤
+size_t dec26_batch(const uint64_t *nums, size_t count, size_t width, char *out, size_t stride) {
+    if (!nums || !out || width == 0 || stride < width) return 0;
+    // 폭이 14자리 이상이면 모든 64비트 값이 들어감
+    uint64_t limit = width < 14 ? B26_POW[width] : 0;
+
+    for (size_t i = 0; i < count; i++) {
+        if (limit && nums[i] >= limit) return i;
+        char *end = out + i * stride + width;
+        char *p = b26_emit(nums[i], end);
+        memset(end - width, '0', (size_t)(p - (end - width)));
+    }
+    return count;
+}
+
+// ---------------------------------------------------------------------------
+// ID 발급기
+// - 공유 카운터에서 스레드(커서)마다 block개씩 원자적으로 예약하고, 블록 안에서는 직전 문자열을
+//   주행계처럼 한 글자씩 올려 다음 ID를 만듦 (블록 첫 값만 dec26_u64로 변환)
+// - path를 주면 카운터를 파일에 mmap하여 재시작 시 이어서 발급함. 카운터는 예약할 때 먼저 올라가므로
+//   프로세스가 죽어도 중복은 없고, 쓰지 못한 예약분만 건너뜀 (b26_cursor_release로 반납 가능).
+//   같은 파일을 여러 프로세스가 열어도 공유 메모리 원자 연산이므로 안전함
+// ---------------------------------------------------------------------------
+
+#define B26_SEQ_MAGIC 0x3130514553363242ULL  // "B26SEQ01"
+
+typedef struct {
+    uint64_t magic;
+    _Atomic uint64_t next;  // 다음에 예약할 블록의 첫 값
+} b26_seq_file;
+
+typedef struct {
+    _Atomic uint64_t *next;  // 공유 카운터 (local 또는 mmap 영역)
+    _Atomic uint64_t local;
+    uint64_t limit;          // 발급 가능한 값의 상한 (미포함), 0이면 제한 없음
+    uint64_t block;          // 한 번에 예약할 개수
+    size_t width;            // ID 폭 ('0' 채움), 0이면 필요한 자릿수만
+    b26_seq_file *map;
+    int fd;
+} b26_seq;
+
+typedef struct {
+    b26_seq *seq;
+    uint64_t cur, end;  // 예약한 블록 중 다음에 발급할 값과 끝 (미포함)
+    char str[16];       // 직전에 발급한 ID (NUL 종단)
+    size_t len;
+} b26_cursor;
+
+// 발급기 초기화: path가 NULL이면 메모리 카운터를 start부터, 아니면 파일 카운터를 사용
+// (새 파일이면 start부터, 기존 파일이면 저장된 값부터). width는 0 또는 1~13
+bool b26_seq_open(b26_seq *sq, const char *path, uint64_t start, uint64_t block, size_t width) {
+    if (!sq || block == 0 || width > 13) return false;
+    sq->limit = width ? B26_POW[width] : 0;
+    sq->block = block;
+    sq->width = width;
+    sq->map = NULL;
+    sq->fd = -1;
+    atomic_init(&sq->local, start);
+    sq->next = &sq->local;
+    if (!path) return true;
+
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) return false;
+    // 여러 프로세스가 동시에 새 파일을 초기화하지 않도록 초기화 동안만 잠금
+    struct flock lk = {.l_type = F_WRLCK, .l_whence = SEEK_SET};
+    struct stat st;
+    b26_seq_file *m = MAP_FAILED;
+    if (fcntl(fd, F_SETLKW, &lk) == 0 && fstat(fd, &st) == 0 &&
+        (st.st_size != 0 || ftruncate(fd, (off_t)sizeof(b26_seq_file)) == 0)) {
+        m = mmap(NULL, sizeof(b26_seq_file), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (m != MAP_FAILED && st.st_size == 0) {
+            atomic_init(&m->next, start);
+            m->magic = B26_SEQ_MAGIC;
+            msync(m, sizeof(*m), MS_SYNC);
+        } else if (m != MAP_FAILED && ((size_t)st.st_size < sizeof(*m) || m->magic != B26_SEQ_MAGIC)) {
+            munmap(m, sizeof(*m));
+            m = MAP_FAILED;
+        }
+    }
+    lk.l_type = F_UNLCK;
+    fcntl(fd, F_SETLK, &lk);
+    if (m == MAP_FAILED) {
+        close(fd);
+        return false;
+    }
+    sq->map = m;
+    sq->fd = fd;
+    sq->next = &m->next;
+    return true;
+}
+
+// 파일 카운터를 디스크에 반영 (프로세스 종료는 괜찮지만 OS 장애까지 견디려면 필요)
+bool b26_seq_sync(b26_seq *sq) {
+    return sq && (!sq->map || msync(sq->map, sizeof(*sq->map), MS_SYNC) == 0);
+}
+
+// 발급기 정리 (커서는 먼저 b26_cursor_release 할 것)
+void b26_seq_close(b26_seq *sq) {
+    if (!sq || !sq->map) return;
+    b26_seq_sync(sq);
+    munmap(sq->map, sizeof(*sq->map));
+    close(sq->fd);
+    sq->map = NULL;
+    sq->fd = -1;
+    sq->next = &sq->local;
+}
+
+void b26_cursor_init(b26_cursor *cur, b26_seq *sq) {
+    cur->seq = sq;
+    cur->cur = cur->end = 0;
+    cur->len = 0;
+}
+
+// 커서가 쓰지 않은 예약분을 반납. 그 뒤로 다른 예약이 없었을 때만 되돌릴 수 있음
+void b26_cursor_release(b26_cursor *cur) {
+    uint64_t expect = cur->end;
+    if (cur->cur < cur->end) atomic_compare_exchange_strong(cur->seq->next, &expect, cur->cur);
+    cur->cur = cur->end = 0;
+}
+
+// 주행계 증가: 끝 글자부터 올리고 'P'는 '0'으로 돌리며 자리올림. 폭을 넘으면 false
+static inline bool b26_increment(char *str, size_t *len, bool fixed) {
+    for (size_t i = *len; i-- > 0;) {
+        char c = str[i];
+        if (c != 'P') {
+            str[i] = (char)(c == '9' ? 'A' : c + 1);
+            return true;
+        }
+        str[i] = '0';
+    }
+    if (fixed) return false;
+    // 가변 폭: "PP" -> "100"
+    memmove(str + 1, str, *len + 1);
+    str[0] = '1';
+    (*len)++;
+    return true;
+}
+
+// 다음 ID를 buf에 씀 (id가 NULL이 아니면 숫자 값도 저장)
+// - 반환값: 글자 수 (NUL 제외), 상한 도달이나 버퍼 부족 시 0
+//   (버퍼 부족이면 ID를 소비하지 않으므로 더 큰 버퍼로 다시 호출하면 같은 ID를 받음)
+size_t b26_next(b26_cursor *cur, char *buf, size_t siz, uint64_t *id) {
+    if (!cur || !buf) return 0;
+    b26_seq *sq = cur->seq;
+
+    if (cur->cur < cur->end && cur->len) {
+        b26_increment(cur->str, &cur->len, sq->width != 0);
+    } else {
+        if (cur->cur >= cur->end) {
+            // 새 블록 예약: 상한이 있으면 넘지 않도록 잘라서 예약
+            uint64_t old = atomic_load_explicit(sq->next, memory_order_relaxed), nxt;
+            do {
+                if (sq->limit ? old >= sq->limit : old > UINT64_MAX - sq->block) return 0;
+                nxt = (sq->limit && sq->limit - old < sq->block) ? sq->limit : old + sq->block;
+            } while (!atomic_compare_exchange_weak_explicit(sq->next, &old, nxt, memory_order_relaxed,
+                                                            memory_order_relaxed));
+            cur->cur = old;
+            cur->end = nxt;
+        }
+        cur->len = dec26_u64(cur->cur, sq->width, cur->str, sizeof(cur->str));
+    }
+    if (cur->len >= siz) {
+        // str은 이미 cur->cur 값이 되었지만 cur->cur는 그대로이므로, 다음 호출이 다시 올리지 않고
+        // cur->cur에서 새로 변환하도록 str을 무효로 둠 (예약한 블록은 유지)
+        cur->len = 0;
+        return 0;
+    }
+
+    if (id) *id = cur->cur;
+    cur->cur++;
+    memcpy(buf, cur->str, cur->len + 1);
+    return cur->len;
+}
+
+// ---------------------------------------------------------------------------
+// 순서 보존 고정 폭 키
+// - CHS는 ASCII 순서('0'~'9' < 'A'~'P')와 자릿값 순서가 같으므로, 앞을 '0'으로 채운 같은 폭의 문자열은
+//   바이트 비교 결과가 곧 숫자 비교 결과임. 정렬/검색에서 long으로 되돌릴 필요가 없음
+// - 키 배열은 width바이트 키를 간격 없이 이어 붙인 형태 (NUL 없음, dec26_batch 출력과 같음)
+// ---------------------------------------------------------------------------
+
+#define KEY26_MAX_WIDTH 32
+
+// dec26 문자열(앞의 '0' 유무 무관)을 width자리 정규 키로 변환. 유효하지 않은 문자나 폭 초과 시 false
+bool key26(const char *str, size_t width, char *key) {
+    if (!str || !key || width == 0 || width > KEY26_MAX_WIDTH) return false;
+    size_t len = strlen(str);
+    // 앞쪽 '0'은 폭 계산에서 제외 (단, 모두 '0'이면 한 자리 남김)
+    while (len > 1 && *str == '0') {
+        str++;
+        len--;
+    }
+    if (len == 0 || len > width) return false;
+    for (size_t i = 0; i < len; i++) {
+        char c = str[i];
+        if (!((c >= '0' && c <= '9') || (c >= 'A' && c <= 'P'))) return false;
+    }
+    memset(key, '0', width - len);
+    memcpy(key + width - len, str, len);
+    return true;
+}
+
+// 두 키 비교 (memcmp와 같은 부호 규약). 16바이트씩 한 번에 비교하고 첫 차이 위치만 확인함
+int key26_cmp(const char *a, const char *b, size_t width) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 16 <= width; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(const void *)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i *)(const void *)(b + i));
+        unsigned ne = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) ^ 0xFFFFu;
+        if (ne) {
+            size_t k = i + (size_t)__builtin_ctz(ne);
+            return (unsigned char)a[k] < (unsigned char)b[k] ? -1 : 1;
+        }
+    }
+#endif
+    for (; i < width; i++) {
+        if (a[i] != b[i]) return (unsigned char)a[i] < (unsigned char)b[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+// 키 문자 -> 자릿값. '0'~'9', 'A'~'P'가 아니면 26 이상
+static inline unsigned key26_digit(char c) {
+    unsigned char u = (unsigned char)c;
+    if (u <= '9') return (unsigned)(u - '0');  // '0' 미만은 감싸서 큰 값이 됨
+    return u >= 'A' ? (unsigned)(u - 'A' + 10) : 26;
+}
+
+// 키 배열을 LSD 기수 정렬 (26버킷, 안정 정렬)
+// - 먼저 모든 자리의 빈도를 한 번에 세고, 모든 키가 같은 글자인 자리(앞쪽 '0' 등)는 건너뜀
+// - tmp는 count * width 바이트 작업 버퍼 (NULL이면 내부에서 할당). 할당 실패나 인자 오류 시 false
+// - 빈도를 셀 때 글자를 검사하여 정규 키가 아닌 바이트가 있으면 keys를 건드리지 않고 false
+bool key26_sort(char *keys, size_t count, size_t width, char *tmp) {
+    if (!keys || width == 0 || width > KEY26_MAX_WIDTH) return false;
+    if (count < 2) return true;
+
+    size_t hist[KEY26_MAX_WIDTH][26];
+    memset(hist, 0, sizeof(hist[0]) * width);
+    for (size_t i = 0; i < count; i++) {
+        const char *k = keys + i * width;
+        for (size_t d = 0; d < width; d++) {
+            unsigned v = key26_digit(k[d]);
+            if (v >= 26) return false;
+            hist[d][v]++;
+        }
+    }
+
+    char *buf = tmp ? tmp : malloc(count * width);
+    if (!buf) return false;
+    char *src = keys, *dst = buf;
+
+    for (size_t d = width; d-- > 0;) {
+        size_t off[26], sum = 0;
+        bool single = false;
+        for (unsigned v = 0; v < 26; v++) {
+            if (hist[d][v] == count) single = true;
+            off[v] = sum;
+            sum += hist[d][v];
+        }
+        if (single) continue;
+
+        for (size_t i = 0; i < count; i++) {
+            const char *k = src + i * width;
+            memcpy(dst + off[key26_digit(k[d])]++ * width, k, width);
+        }
+        char *t = src;
+        src = dst;
+        dst = t;
+    }
+    // 홀수 번 패스했으면 결과가 작업 버퍼에 있으므로 되돌려 복사
+    if (src != keys) memcpy(keys, src, count * width);
+    if (!tmp) free(buf);
+    return true;
+}
+
+// 정렬된 키 배열에서 key 이상인 첫 위치 (없으면 count). 범위 검색은 [lower(lo), lower(hi))
+size_t key26_search(const char *keys, size_t count, size_t width, const char *key) {
+    size_t lo = 0, hi = count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (key26_cmp(keys + mid * width, key, width) < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+// 기존 방식 비교용: 비교할 때마다 todec으로 해석 (NUL 종단 14바이트 문자열)
+static int cmp_todec(const void *a, const void *b) {
+    long x = 0, y = 0;
+    todec(a, &x);
+    todec(b, &y);
+    return (x > y) - (x < y);
+}
+
+// 데모용 발급 스레드: 문자열을 다시 해석해 숫자 값과 같은지 확인
+typedef struct {
+    b26_seq *seq;
+    size_t n;
+    uint64_t *ids;
+    size_t bad;
+} seq_args;
+
+static int seq_worker(void *arg) {
+    seq_args *a = arg;
+    b26_cursor cur;
+    char buf[16];
+    long v;
+    b26_cursor_init(&cur, a->seq);
+    for (size_t i = 0; i < a->n; i++) {
+        if (!b26_next(&cur, buf, sizeof(buf), &a->ids[i]) || !todec(buf, &v) || (uint64_t)v != a->ids[i]) a->bad++;
+    }
+    b26_cursor_release(&cur);
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// 파일 변환 CLI
+//   base26 enc [-t 스레드] [-w 폭] 입력 [출력]   10진수 -> 26진수 (한 줄에 값 하나)
+//   base26 dec [-t 스레드] 입력 [출력]           26진수 -> 10진수
+// - 입력을 mmap하고 줄 경계에서 스레드 수만큼 나눈 뒤, 스레드마다 자기 출력 버퍼에 변환하고
+//   끝나면 입력 순서대로 이어 씀 (출력을 생략하면 표준 출력)
+// - 잘못된 줄(빈 값 제외)은 출력에서 빈 줄로 남겨 줄 번호를 맞추고, 표준 오류로 보고함.
+//   정상 경로에서는 줄당 판정 결과만 누적하고, 위치 기록은 드문 경로로 분리함
+// - 값 범위는 부호 없는 64비트, CRLF 줄 끝 허용. 입력은 mmap 가능한 일반 파일이어야 함
+// ---------------------------------------------------------------------------
+
+#define CONV_MAX_REPORT 10  // 스레드당 기억할 잘못된 줄 위치 수
+
+typedef struct {
+    const char *beg, *end;  // 맡은 입력 구간 (줄 경계)
+    bool encode;
+    size_t width;
+    char *out;              // 출력 버퍼
+    size_t len, cap;
+    size_t lines;           // 처리한 줄 수
+    size_t nbad;            // 잘못된 줄 수
+    size_t bad[CONV_MAX_REPORT];  // 잘못된 줄의 구간 내 줄 번호 (0부터)
+    bool oom;
+} conv_job;
+
+// 10진수 줄 -> u64. 숫자 외 문자나 2^64 이상이면 false
+static inline bool conv_parse_dec(const char *s, size_t n, uint64_t *v) {
+    while (n > 1 && *s == '0') {
+        s++;
+        n--;
+    }
+    if (n == 0 || n > 20) return false;
+    uint64_t r = 0;
+    unsigned bad = 0;
+    for (size_t i = 0; i < n; i++) {
+        unsigned d = (unsigned)(unsigned char)s[i] - '0';
+        bad |= d > 9;
+        r = r * 10 + (d & 15);
+    }
+    // 20자리는 UINT64_MAX("18446744073709551615") 이하인지 문자열로 비교
+    if (n == 20 && memcmp(s, "18446744073709551615", 20) > 0) return false;
+    *v = r;
+    return !bad;
+}
+
+// 26진수 줄 -> u64. 유효하지 않은 문자나 2^64 이상이면 false
+static inline bool conv_parse_b26(const char *s, size_t n, uint64_t *v) {
+    while (n > 1 && *s == '0') {
+        s++;
+        n--;
+    }
+    if (n == 0 || n > 14) return false;
+    uint64_t r = 0;
+    unsigned bad = 0;
+    for (size_t i = 0; i < n; i++) {
+        unsigned c = (unsigned char)s[i];
+        unsigned d = c - '0', a = c - 'A';
+        bad |= d > 9 && a > 15;
+        r = r * 26 + (d <= 9 ? d : a + 10);
+    }
+    // 14자리: 최상위 자리 d에 대해 d * 26^13 + 나머지 <= UINT64_MAX (d <= 7, 7이면 나머지 제한)
+    if (n == 14) {
+        unsigned c = (unsigned char)s[0];
+        uint64_t top = c <= '9' ? c - '0' : c - 'A' + 10;
+        uint64_t rest = r - top * B26_POW[13];  // r이 넘쳤어도 모듈러 연산이므로 나머지는 정확함
+        if (top > 7 || (top == 7 && rest > UINT64_MAX - 7 * B26_POW[13])) return false;
+    }
+    *v = r;
+    return !bad;
+}
+
+// u64 -> 10진수, 뒤에서부터 씀. 첫 글자 위치 반환
+static inline char *conv_emit_dec(uint64_t v, char *end) {
+    static const char D2[] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                             "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                             "8081828384858687888990919293949596979899";
+    char *p = end;
+    while (v >= 100) {
+        uint64_t q = v / 100;
+        memcpy(p -= 2, D2 + 2 * (v - q * 100), 2);
+        v = q;
+    }
+    if (v >= 10) memcpy(p -= 2, D2 + 2 * v, 2);
+    else *--p = (char)('0' + v);
+    return p;
+}
+
+// 잘못된 줄 기록 (드문 경로)
+static void conv_mark_bad(conv_job *j) {
+    if (j->nbad < CONV_MAX_REPORT) j->bad[j->nbad] = j->lines;
+    j->nbad++;
+}
+
+static int conv_worker(void *arg) {
+    conv_job *j = arg;
+    const char *p = j->beg;
+    char tmp[32];
+
+    while (p < j->end) {
+        const char *nl = memchr(p, '\n', (size_t)(j->end - p));
+        const char *le = nl ? nl : j->end;
+        size_t n = (size_t)(le - p);
+        if (n && p[n - 1] == '\r') n--;
+
+        // 한 줄 출력은 최대 32바이트 (26진수 폭 13자리 이하 또는 10진수 20자리 + 개행)
+        if (j->cap - j->len < sizeof(tmp) + 1) {
+            size_t ncap = j->cap * 2 + 64;
+            char *nb = realloc(j->out, ncap);
+            if (!nb) {
+                j->oom = true;
+                return 0;
+            }
+            j->out = nb;
+            j->cap = ncap;
+        }
+
+        if (n) {
+            uint64_t v;
+            char *end = tmp + sizeof(tmp), *s = end;
+            bool ok;
+            if (j->encode) {
+                ok = conv_parse_dec(p, n, &v);
+                if (ok) {
+                    s = b26_emit(v, end);
+                    if (j->width) {
+                        ok = (size_t)(end - s) <= j->width;
+                        while ((size_t)(end - s) < j->width) *--s = '0';
+                    }
+                }
+            } else {
+                ok = conv_parse_b26(p, n, &v);
+                if (ok) s = conv_emit_dec(v, end);
+            }
+            if (ok) {
+                memcpy(j->out + j->len, s, (size_t)(end - s));
+                j->len += (size_t)(end - s);
+            } else {
+                conv_mark_bad(j);
+            }
+        }
+        j->out[j->len++] = '\n';
+        j->lines++;
+        p = le + 1;
+    }
+    return 0;
+}
+
+static void conv_usage(void) {
+    fprintf(stderr,
+            "사용법:\n"
+            "  base26                                   데모 실행\n"
+            "  base26 enc [-t 스레드] [-w 폭] 입력 [출력]  10진수 -> 26진수\n"
+            "  base26 dec [-t 스레드] 입력 [출력]          26진수 -> 10진수\n");
+}
+
+// enc/dec 명령 처리. 반환: 0 성공, 1 잘못된 줄 있음, 2 사용법/입출력 오류
+static int conv_main(int argc, char *argv[]) {
+    bool encode = strcmp(argv[1], "enc") == 0;
+    long nthr = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t width = 0;
+    const char *in = NULL, *outp = NULL;
+
+    for (int i = 2; i < argc; i++) {
+        if ((strcmp(argv[i], "-t") == 0 || strcmp(argv[i], "-w") == 0) && i + 1 < argc) {
+            char *e;
+            long v = strtol(argv[i + 1], &e, 10);
+            if (*e || v < (argv[i][1] == 't' ? 1 : 0) || v > (argv[i][1] == 't' ? 256 : 13)) {
+                conv_usage();
+                return 2;
+            }
+            if (argv[i][1] == 't') nthr = v;
+            else width = (size_t)v;
+            i++;
+        } else if (!in) {
+            in = argv[i];
+        } else if (!outp) {
+            outp = argv[i];
+        } else {
+            conv_usage();
+            return 2;
+        }
+    }
+    if (!in || (!encode && width)) {
+        conv_usage();
+        return 2;
+    }
+    if (nthr < 1) nthr = 1;
+
+    int fd = open(in, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        perror(in);
+        if (fd >= 0) close(fd);
+        return 2;
+    }
+    if (!S_ISREG(st.st_mode)) {
+        fprintf(stderr, "%s: 일반 파일만 지원합니다 (mmap)\n", in);
+        close(fd);
+        return 2;
+    }
+    size_t size = (size_t)st.st_size;
+    const char *data = NULL;
+    if (size) {
+        void *m = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (m == MAP_FAILED) {
+            perror(in);
+            close(fd);
+            return 2;
+        }
+        posix_madvise(m, size, POSIX_MADV_SEQUENTIAL);
+        data = m;
+    }
+    close(fd);
+
+    // 작은 입력은 스레드를 다 쓰지 않음 (구간당 최소 64KB)
+    size_t T = (size_t)nthr;
+    if (T > size / 65536 + 1) T = size / 65536 + 1;
+    conv_job *jobs = calloc(T, sizeof(*jobs));
+    thrd_t *th = calloc(T, sizeof(*th));
+    int rc = 2;
+    if (!jobs || !th) goto done;
+
+    // 구간 나누기: 균등 분할 위치에서 다음 개행 뒤로 밀어 줄 경계에 맞춤
+    const char *prev = data;
+    for (size_t i = 0; i < T; i++) {
+        const char *e = data + size * (i + 1) / T;
+        if (i + 1 < T && e > prev) {
+            const char *nl = memchr(e - 1, '\n', (size_t)(data + size - (e - 1)));
+            e = nl ? nl + 1 : data + size;
+        }
+        if (e < prev) e = prev;
+        if (i + 1 == T) e = data + size;
+        jobs[i] = (conv_job){.beg = prev, .end = e, .encode = encode, .width = width};
+        // 초기 버퍼: 입력 크기의 1.5배 (10진수 -> 26진수는 줄고, 반대는 최대 약 1.45배로 늘어남)
+        jobs[i].cap = (size_t)(e - prev) + (size_t)(e - prev) / 2 + 64;
+        jobs[i].out = malloc(jobs[i].cap);
+        if (!jobs[i].out) goto done;
+        prev = e;
+    }
+
+    size_t started = 0;
+    for (; started < T; started++) {
+        if (thrd_create(&th[started], conv_worker, &jobs[started]) != thrd_success) break;
+    }
+    // 스레드 생성에 실패한 구간은 현재 스레드에서 처리
+    for (size_t i = started; i < T; i++) conv_worker(&jobs[i]);
+    for (size_t i = 0; i < started; i++) thrd_join(th[i], NULL);
+
+    FILE *fo = outp ? fopen(outp, "wb") : stdout;
+    if (!fo) {
+        perror(outp);
+        goto done;
+    }
+    // 입력 순서대로 이어 쓰고, 잘못된 줄은 전체 줄 번호(1부터)로 보고
+    size_t base = 0, nbad = 0, shown = 0;
+    bool ok = true;
+    for (size_t i = 0; i < T; i++) {
+        ok = ok && !jobs[i].oom && fwrite(jobs[i].out, 1, jobs[i].len, fo) == jobs[i].len;
+        for (size_t k = 0; k < jobs[i].nbad && k < CONV_MAX_REPORT && shown < CONV_MAX_REPORT; k++, shown++) {
+            fprintf(stderr, "%zu번째 줄: 잘못된 값\n", base + jobs[i].bad[k] + 1);
+        }
+        nbad += jobs[i].nbad;
+        base += jobs[i].lines;
+    }
+    ok = (outp ? fclose(fo) : fflush(fo)) == 0 && ok;
+    if (!ok) {
+        fprintf(stderr, "출력 실패\n");
+        goto done;
+    }
+    if (nbad) fprintf(stderr, "잘못된 줄 %zu개 (전체 %zu줄)\n", nbad, base);
+    rc = nbad ? 1 : 0;
+
+done:
+    if (jobs) {
+        for (size_t i = 0; i < T; i++) free(jobs[i].out);
+    }
+    free(jobs);
+    free(th);
+    if (data) munmap((void *)(uintptr_t)data, size);
+    return rc;
+}
+
+static double now_sec(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// 데모: 변환/일괄 변환/ID 발급/정렬 결과와 처리량 출력
+static int demo(void) {
     long num1 = 123456789L, num2 = 0;
     char buf[32];
 
@@ -56,6 +922,151 @@ int main(void) {
     if (todec(buf, &num2))             printf("10진수 : %ld\n", num2);
 
     if (todec("PPPPP", &num2))          printf("10진수 : %ld\n", num2); 
-   
+
+    // 일괄 변환 테스트: 8자리 고정 폭 필드 (구분자 없이 연속 배치)
+    static const char cols[] = "0000000A" "00ABCDEF" "PPPPPPPP" "0000012G" "000000Z1" "00000000";
+    long vals[6];
+    unsigned char mask[1];
+    size_t nok = todec_batch(cols, 8, 8, 6, vals, mask);
+    printf("일괄 변환 : 유효 %zu/6, 마스크 0x%02X\n", nok, mask[0]);
+    for (size_t i = 0; i < 6; i++) {
+        if (mask[0] >> i & 1) printf("  %.8s -> %ld\n", cols + i * 8, vals[i]);
+        else                  printf("  %.8s -> 무효\n", cols + i * 8);
+    }
+
+    // 처리량 비교: 13자리 필드 100만 개 (todec은 NUL 종단 사본 필요)
+    enum { N = 1000000, W = 13 };
+    static char field[N * W];
+    static long r1[N], r2[N];
+    static unsigned char m[(N + 7) / 8];
+    unsigned long long seed = 88172645463325252ULL;
+    for (size_t i = 0; i < (size_t)N * W; i++) {
+        seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+        field[i] = CHS[seed % 26];
+    }
+    double t0 = now_sec();
+    char tmp[W + 1];
+    tmp[W] = '\0';
+    for (size_t i = 0; i < N; i++) {
+        memcpy(tmp, field + i * W, W);
+        if (!todec(tmp, &r1[i])) r1[i] = 0;
+    }
+    double t1 = now_sec();
+    size_t good = todec_batch(field, W, W, N, r2, m);
+    double t2 = now_sec();
+    printf("todec      : %.1f ns/필드\n", (t1 - t0) * 1e9 / N);
+    printf("todec_batch: %.1f ns/필드 (유효 %zu, 결과 %s)\n", (t2 - t1) * 1e9 / N, good,
+           memcmp(r1, r2, sizeof(r1)) == 0 ? "일치" : "불일치");
+
+    // 나눗셈 없는 인코더: 경계값과 128비트, 고정 폭
+    char w[40];
+    if (dec26_u64(UINT64_MAX, 0, w, sizeof(w)))  printf("UINT64_MAX : %s\n", w);
+    if (dec26_u64(744, 6, w, sizeof(w)))         printf("폭 6      : %s\n", w);
+#if defined(__SIZEOF_INT128__)
+    if (dec26_u128(~(b26_u128)0, 0, w, sizeof(w))) printf("UINT128_MAX: %s\n", w);
+#endif
+
+    // 처리량 비교: 위 결과 100만 개를 다시 13자리로 인코딩
+    static uint64_t u[N];
+    static char e1[N * 14], e2[N * W];
+    for (size_t i = 0; i < N; i++) u[i] = (uint64_t)r2[i];
+    t0 = now_sec();
+    for (size_t i = 0; i < N; i++) dec26(r2[i], e1 + i * 14, 14);
+    t1 = now_sec();
+    size_t nenc = dec26_batch(u, N, W, e2, W);
+    t2 = now_sec();
+    bool same = true;
+    for (size_t i = 0; i < N && same; i++) {
+        size_t len = strlen(e1 + i * 14);
+        same = memcmp(e1 + i * 14, e2 + i * W + W - len, len) == 0;
+    }
+    printf("dec26      : %.1f ns/값\n", (t1 - t0) * 1e9 / N);
+    printf("dec26_batch: %.1f ns/값 (변환 %zu, 결과 %s)\n", (t2 - t1) * 1e9 / N, nenc, same ? "일치" : "불일치");
+
+    // ID 발급기: 4개 스레드가 공유 카운터에서 8자리 ID 25만 개씩 발급
+    enum { T = 4, PER = 250000 };
+    static b26_seq seq;
+    b26_seq_open(&seq, NULL, 0, 1024, 8);
+    seq_args args[T];
+    thrd_t th[T];
+    t0 = now_sec();
+    for (int i = 0; i < T; i++) {
+        args[i] = (seq_args){.seq = &seq, .n = PER, .ids = u + (size_t)i * PER};
+        thrd_create(&th[i], seq_worker, &args[i]);
+    }
+    size_t bad = 0;
+    for (int i = 0; i < T; i++) {
+        thrd_join(th[i], NULL);
+        bad += args[i].bad;
+    }
+    t1 = now_sec();
+    // 발급된 값이 0..T*PER-1을 정확히 한 번씩 덮는지 확인 (블록을 다 썼으므로 빈틈 없음)
+    static unsigned char seen[T * PER];
+    memset(seen, 0, sizeof(seen));
+    for (size_t i = 0; i < (size_t)T * PER; i++) {
+        if (u[i] >= (uint64_t)T * PER || seen[u[i]]++) bad++;
+    }
+    printf("b26_next   : %.1f ns/ID (%d스레드, todec 검증 포함, 중복/누락/불일치 %zu)\n", (t1 - t0) * 1e9 / (T * PER), T, bad);
+
+    // 파일 카운터: 닫았다 다시 열면 이어서 발급
+    const char *path = "/tmp/base26_seq.dat";
+    remove(path);
+    b26_cursor cur;
+    char id1[16], id2[16];
+    if (b26_seq_open(&seq, path, 676, 100, 0)) {
+        b26_cursor_init(&cur, &seq);
+        b26_next(&cur, id1, sizeof(id1), NULL);
+        b26_next(&cur, id1, sizeof(id1), NULL);
+        b26_cursor_release(&cur);
+        b26_seq_close(&seq);
+    }
+    if (b26_seq_open(&seq, path, 0, 100, 0)) {
+        b26_cursor_init(&cur, &seq);
+        b26_next(&cur, id2, sizeof(id2), NULL);
+        b26_cursor_release(&cur);
+        b26_seq_close(&seq);
+        printf("재시작     : %s 다음 %s\n", id1, id2);
+    }
+    remove(path);
+
+    // 정렬: 앞의 13자리 난수 필드 20만 개 (e2, dec26_batch 출력)를 키로 사용
+    enum { S = 200000 };
+    static char keys[S * W], strs[S][14];
+    memcpy(keys, e2, sizeof(keys));
+    for (size_t i = 0; i < S; i++) dec26(r2[i], strs[i], sizeof(strs[i]));
+    t0 = now_sec();
+    qsort(strs, S, sizeof(strs[0]), cmp_todec);
+    t1 = now_sec();
+    bool sorted = key26_sort(keys, S, W, NULL);
+    t2 = now_sec();
+    char k[W];
+    for (size_t i = 0; i < S && sorted; i++) {
+        sorted = key26(strs[i], W, k) && memcmp(k, keys + i * W, W) == 0;
+    }
+    printf("qsort+todec: %.1f ms\n", (t1 - t0) * 1e3);
+    printf("key26_sort : %.1f ms (결과 %s)\n", (t2 - t1) * 1e3, sorted ? "일치" : "불일치");
+
+    // 범위 검색: [26^12, 2 * 26^12) 안의 키 개수 (변환 없이 이진 검색)
+    const long rlo = (long)B26_POW[12], rhi = 2 * rlo;
+    char lo[W], hi[W];
+    dec26_u64((uint64_t)rlo, W, w, sizeof(w));
+    memcpy(lo, w, W);
+    dec26_u64((uint64_t)rhi, W, w, sizeof(w));
+    memcpy(hi, w, W);
+    size_t n_in = key26_search(keys, S, W, hi) - key26_search(keys, S, W, lo), n_ref = 0;
+    for (size_t i = 0; i < S; i++) {
+        long v;
+        todec(strs[i], &v);
+        n_ref += v >= rlo && v < rhi;
+    }
+    printf("범위 검색  : %zu개 (직접 센 값 %zu)\n", n_in, n_ref);
+
     return 0;
-}
\ No newline at end of file
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) return demo();
+    if (strcmp(argv[1], "enc") == 0 || strcmp(argv[1], "dec") == 0) return conv_main(argc, argv);
+    conv_usage();
+    return 2;
+}
@@ -18,6 +18,10 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stddef.h>
+
+/* 고정 소수점 금액 자료형 (util과 공유) */
+#include "../util/amount.h"
 
 /* --- 설정값 (매크로) --- */
 
@@ -128,192 +132,279 @@ static void remove_trailing_spaces(char text[]) {
  * [함수] format_amount
  * [설명] "12345" 같은 숫자 문자열을 "12,345" 처럼 바꿉니다.
  * [과정] 
- * 1. 실릿수(double)로 변환 후 소수점 2자리 문자열로 만듭니다.
+ * 1. 문자열을 고정 소수점 금액(amt_t: 금액 x 100 정수)으로 직접 읽습니다. (소수 셋째 자리에서 반올림)
  * 2. 소수점이 .00 이면 정수형으로 취급하여 소수부를 버립니다.
- * 3. 정수 부분을 뒤에서부터 한 글자씩 채우면서 3글자마다 쉼표(,)를 넣습니다.
+ * 3. 정수 부분에 3글자마다 쉼표(,)를 넣습니다. (음수는 '-'를 앞에 붙임)
+ * 실수(double)를 거치지 않으므로 큰 금액도 자릿수가 틀어지지 않습니다.
+ * 범위를 넘는 금액은 잘못 찍히지 않도록 '*'로 채웁니다.
  */
 static AmountString format_amount(const char amount_src[]) {
     AmountString result;
-    result.text[0] = '\0';
-
-    /* 1. 숫자로 변환 (입력이 없으면 "0"으로 처리) */
-    double numeric_value = atof(amount_src ? amount_src : "0");
-    char formatted_temp[MAX_AMOUNT_LEN];
-    snprintf(formatted_temp, sizeof(formatted_temp), "%.2f", numeric_value);
-
-    int temp_len = (int)strlen(formatted_temp);
-    int dot_position = -1;
+    amt_t value;
 
-    /* 소수점(.) 위치 찾기 */
-    for (int i = 0; i < temp_len; i++) {
-        if (formatted_temp[i] == '.') {
-            dot_position = i;
-            break;
-        }
+    /* 1. 숫자로 변환 (입력이 없거나 숫자가 아니면 0) */
+    if (amt_parse(amount_src, MAX_AMOUNT_LEN, &value) < 0) {
+        memset(result.text, '*', MAX_AMOUNT_LEN - 1);
+        result.text[MAX_AMOUNT_LEN - 1] = '\0';
+        return result;
     }
 
-    /* 2. 소수점이 .00 으로 끝나면 제거 로직 */
-    if (dot_position >= 0 && formatted_temp[dot_position + 1] == '0' && 
-        formatted_temp[dot_position + 2] == '0' && formatted_temp[dot_position + 3] == '\0') {
-        formatted_temp[dot_position] = '\0';
-        temp_len = dot_position;
-        dot_position = -1;
+    /* 2~3. 쉼표와 .00 생략 규칙을 적용하여 문자열로 */
+    if (amt_format(value, AMT_FMT_COMMA | AMT_FMT_TRIM00, result.text, MAX_AMOUNT_LEN) < 0) {
+        result.text[0] = '\0';
     }
+    return result;
+}
 
-    int integer_part_len = (dot_position >= 0) ? dot_position : temp_len;
-    int suffix_len = (dot_position >= 0) ? (temp_len - dot_position) : 0; 
-    int comma_count = (integer_part_len > 0) ? ((integer_part_len - 1) / 3) : 0;
-
-    /* 최종적으로 만들어질 문자열의 길이 계산 */
-    int final_len = integer_part_len + comma_count + suffix_len;
-    if (final_len >= MAX_AMOUNT_LEN) final_len = MAX_AMOUNT_LEN - 1;
-    
-    result.text[final_len] = '\0';
-
-    /* 3. 뒤에서부터 채우기 (우측 정렬 효과) */
-    int dest_index = final_len - 1;
+/* --- 레이아웃 엔진 --- */
 
-    /* A. 소수부 먼저 복사 (있을 경우) */
-    if (dot_position >= 0 && suffix_len > 0) {
-        for (int i = suffix_len - 1; i >= 0; i--) {
-            result.text[dest_index--] = formatted_temp[dot_position + i];
-        }
-    }
+/*
+ * [설명] 출력 양식(레이아웃)을 코드가 아닌 "표"로 정의합니다.
+ * - 각 필드의 위치(offset), 폭(width), 정렬, 포맷 함수, 원본 데이터 위치를 한 줄씩 적습니다.
+ * - load_layout()이 처음 한 번 겹침/범위 초과 같은 실수를 검사하고, 제어 문자 + 공백으로 된
+ *   템플릿 라인을 미리 만들어 둡니다.
+ * - format_line()은 템플릿을 복사한 뒤 필드마다 포맷 결과를 정해진 자리에 한 번만 씁니다.
+ *   (필드마다 남은 공간 계산이나 공백 채우기를 반복하지 않음)
+ * - 다른 출력 양식도 표만 새로 만들면 같은 엔진으로 찍을 수 있습니다.
+ */
 
-    /* B. 정수부 복사하면서 쉼표 넣기 */
-    int source_index = integer_part_len - 1;
-    int digit_counter = 0;
-    while (source_index >= 0 && dest_index >= 0) {
-        result.text[dest_index--] = formatted_temp[source_index--];
-        digit_counter++;
-
-        /* 3자리마다 쉼표 삽입 (단, 맨 앞자리일 때는 넣지 않음) */
-        if (digit_counter == 3 && source_index >= 0 && dest_index >= 0) {
-            result.text[dest_index--] = ',';
-            digit_counter = 0;
-        }
-    }
+/* 레이아웃이 가질 수 있는 최대 라인 길이와 필드당 포맷 결과 최대 길이 */
+#define LAYOUT_MAX_LINE 256
+#define FIELD_TEXT_MAX MAX_AMOUNT_LEN
 
-    return result;
-}
+typedef enum {
+    ALIGN_LEFT,  /* 좌측 정렬: 넘치면 오른쪽을 자름 */
+    ALIGN_RIGHT  /* 우측 정렬: 넘치면 왼쪽을 자름 */
+} FieldAlign;
 
 /*
- * [함수] append_text_field
- * [설명] 고정 폭 버퍼에 텍스트를 "좌측 정렬"로 추가합니다.
- * [반환] 데이터가 추가된 후의 다음 인덱스(offset)
+ * 포맷 함수: 원본 문자열(최대 source_max 바이트)을 out에 만들고 길이를 반환합니다.
+ * out은 FIELD_TEXT_MAX 바이트 크기이며 널 문자로 끝낼 필요는 없습니다.
  */
-static int append_text_field(char buffer[], int offset, const char source[], int field_width) {
-    if (offset >= LINE_SIZE || field_width <= 0) return offset;
-
-    /* 쓸 수 있는 공간 확인 */
-    int remaining_space = LINE_SIZE - offset;
-    int write_width = (field_width < remaining_space) ? field_width : remaining_space;
+typedef int (*FieldFormatter)(const char source[], int source_max, char out[]);
 
-    /* 원본 데이터 길이 확인 */
-    int source_len = get_safe_length(source, CONTENT_MAX_LEN);
-    int copy_len = (source_len < write_width) ? source_len : write_width;
+/* 필드 하나의 정의 */
+typedef struct {
+    const char *name;        /* 필드 이름 (오류 메시지용) */
+    int offset;              /* 라인 안에서 시작 위치 */
+    int width;               /* 폭 (바이트) */
+    FieldAlign align;
+    FieldFormatter format;
+    size_t source_offset;    /* 레코드 구조체 안에서 원본 문자열 위치 (offsetof) */
+    int source_max;          /* 원본 문자열 최대 길이 (sizeof 멤버) */
+} FieldSpec;
+
+/* 출력 양식 하나의 정의 */
+typedef struct {
+    const char *name;
+    int line_size;                    /* 라인 전체 길이 */
+    const unsigned char *control;     /* 라인 앞에 붙는 제어 문자 (없으면 NULL) */
+    int control_len;
+    const FieldSpec *fields;
+    int field_count;
+    /* 아래는 load_layout()이 채움 */
+    int loaded;
+    char template_line[LAYOUT_MAX_LINE];
+} LineLayout;
+
+/* 레코드 구조체의 멤버를 표에 적기 위한 도우미 */
+#define FIELD_SOURCE(type, member) offsetof(type, member), (int)sizeof(((type *)0)->member)
 
-    /* 1. 필드 전체를 먼저 공백으로 채움 (초기화) */
-    for (int i = 0; i < write_width; i++) {
-        buffer[offset + i] = ' ';
+/*
+ * [함수] format_text
+ * [설명] 텍스트를 그대로 사용합니다.
+ */
+static int format_text(const char source[], int source_max, char out[]) {
+    int length = get_safe_length(source, source_max < FIELD_TEXT_MAX ? source_max : FIELD_TEXT_MAX);
+    for (int i = 0; i < length; i++) {
+        out[i] = source[i];
     }
+    return length;
+}
 
-    /* 2. 앞에서부터(좌측 정렬) 데이터 복사 */
-    for (int i = 0; i < copy_len; i++) {
-        buffer[offset + i] = source[i];
+/*
+ * [함수] format_money
+ * [설명] 금액에 천 단위 쉼표를 넣습니다. (format_amount 사용)
+ */
+static int format_money(const char source[], int source_max, char out[]) {
+    char bounded[MAX_AMOUNT_LEN];
+    copy_safely(bounded, (int)sizeof(bounded), source, source_max);
+
+    AmountString formatted = format_amount(bounded);
+    int length = (int)strlen(formatted.text);
+    for (int i = 0; i < length; i++) {
+        out[i] = formatted.text[i];
     }
-
-    DBG_PRINTF("[TEXT] 위치: %3d, 폭: %2d, 데이터: \"%s\"\n", offset, write_width, source ? source : "");
-
-    return offset + write_width;
+    return length;
 }
 
 /*
- * [함수] append_amount_field
- * [설명] 고정 폭 버퍼에 금액을 "우측 정렬"로 추가합니다.
+ * [함수] load_layout
+ * [설명] 레이아웃 표를 검사하고 템플릿 라인을 만듭니다. 프로그램 시작 시 한 번만 호출합니다.
+ * [검사] 라인 길이, 제어 문자 길이, 필드 폭/범위 초과, 필드끼리 또는 제어 문자와의 겹침, 포맷 함수 누락
+ * [반환] 0: 성공, -1: 레이아웃 오류 (원인을 stderr에 출력)
  */
-static int append_amount_field(char buffer[], int offset, const char source[], int field_width) {
-    if (offset >= LINE_SIZE || field_width <= 0) return offset;
-
-    int remaining_space = LINE_SIZE - offset;
-    int write_width = (field_width < remaining_space) ? field_width : remaining_space;
-
-    /* 금액 포맷팅 (쉼표 넣기) */
-    AmountString formatted = format_amount(source);
-    int amount_len = (int)strlen(formatted.text);
+static int load_layout(LineLayout *layout) {
+    if (layout == NULL) return -1;
+    layout->loaded = 0;
+
+    if (layout->line_size <= 0 || layout->line_size > LAYOUT_MAX_LINE) {
+        fprintf(stderr, "[%s] 라인 길이 %d가 허용 범위(1~%d)를 벗어났습니다\n",
+                layout->name, layout->line_size, LAYOUT_MAX_LINE);
+        return -1;
+    }
+    if (layout->control_len < 0 || layout->control_len > layout->line_size ||
+        (layout->control_len > 0 && layout->control == NULL)) {
+        fprintf(stderr, "[%s] 제어 문자 길이 %d가 잘못되었습니다\n", layout->name, layout->control_len);
+        return -1;
+    }
+    if (layout->field_count < 0 || (layout->field_count > 0 && layout->fields == NULL)) {
+        fprintf(stderr, "[%s] 필드 목록이 잘못되었습니다\n", layout->name);
+        return -1;
+    }
 
-    /* 1. 필드 전체 공백 채움 */
-    for (int i = 0; i < write_width; i++) {
-        buffer[offset + i] = ' ';
+    /* 바이트마다 어느 필드가 차지했는지 기록하여 겹침 검사 (-1: 빈 자리, -2: 제어 문자) */
+    int owner[LAYOUT_MAX_LINE];
+    for (int i = 0; i < layout->line_size; i++) {
+        owner[i] = (i < layout->control_len) ? -2 : -1;
     }
 
-    /* 2. 우측 정렬 배치 */
-    if (amount_len > 0) {
-        if (amount_len >= write_width) {
-            /* 데이터가 필드보다 길면 오른쪽 부분을 잘라서 넣음 */
-            int start_from = amount_len - write_width;
-            for (int i = 0; i < write_width; i++) {
-                buffer[offset + i] = formatted.text[start_from + i];
-            }
-        } else {
-            /* 데이터가 필드보다 짧으면 오른쪽 끝에 붙임 */
-            int start_at = write_width - amount_len;
-            for (int i = 0; i < amount_len; i++) {
-                buffer[offset + start_at + i] = formatted.text[i];
+    for (int f = 0; f < layout->field_count; f++) {
+        const FieldSpec *spec = &layout->fields[f];
+        const char *name = spec->name ? spec->name : "(이름 없음)";
+
+        if (spec->width <= 0 || spec->offset < 0 || spec->offset + spec->width > layout->line_size) {
+            fprintf(stderr, "[%s] 필드 '%s' (위치 %d, 폭 %d)가 라인 길이 %d를 벗어났습니다\n",
+                    layout->name, name, spec->offset, spec->width, layout->line_size);
+            return -1;
+        }
+        if (spec->format == NULL || (spec->align != ALIGN_LEFT && spec->align != ALIGN_RIGHT) ||
+            spec->source_max <= 0) {
+            fprintf(stderr, "[%s] 필드 '%s'의 정렬/포맷 함수/원본 정의가 잘못되었습니다\n", layout->name, name);
+            return -1;
+        }
+        for (int i = spec->offset; i < spec->offset + spec->width; i++) {
+            if (owner[i] != -1) {
+                const char *other = (owner[i] == -2) ? "제어 문자"
+                                  : (layout->fields[owner[i]].name ? layout->fields[owner[i]].name : "(이름 없음)");
+                fprintf(stderr, "[%s] 필드 '%s'가 위치 %d에서 '%s'와 겹칩니다\n", layout->name, name, i, other);
+                return -1;
             }
+            owner[i] = f;
         }
     }
 
-    DBG_PRINTF("[MONY] 위치: %3d, 폭: %2d, 원본: \"%s\", 결과: \"%s\"\n", 
-               offset, write_width, source ? source : "0", formatted.text);
+    /* 템플릿: 제어 문자 + 나머지는 공백 */
+    memset(layout->template_line, ' ', (size_t)layout->line_size);
+    for (int i = 0; i < layout->control_len; i++) {
+        layout->template_line[i] = (char)layout->control[i];
+    }
 
-    return offset + write_width;
+    layout->loaded = 1;
+    return 0;
 }
 
 /*
- * [함수] append_raw_bytes
- * [설명] 제어 문자 같은 특수한 바이트 데이터를 그대로 추가합니다.
+ * [함수] format_line
+ * [설명] 레코드 하나를 레이아웃에 맞춰 line_size 바이트 라인으로 만듭니다. (널 문자 없음)
+ * [반환] 0: 성공, -1: 검사를 통과하지 않은 레이아웃
  */
-static int append_raw_bytes(char buffer[], int offset, const unsigned char bytes[], int length) {
-    if (buffer == NULL || bytes == NULL || offset >= LINE_SIZE || length <= 0) return offset;
-
-    int remaining = LINE_SIZE - offset;
-    int write_len = (length < remaining) ? length : remaining;
+static int format_line(const LineLayout *layout, const void *record, char output_line[]) {
+    if (layout == NULL || !layout->loaded || record == NULL || output_line == NULL) return -1;
+
+    /* 1. 템플릿 복사 (제어 문자 + 공백) */
+    memcpy(output_line, layout->template_line, (size_t)layout->line_size);
+
+    /* 2. 필드마다 포맷 결과를 정해진 자리에 씀 (검사는 load_layout에서 끝났으므로 범위 계산 없음) */
+    const char *record_bytes = (const char *)record;
+    for (int f = 0; f < layout->field_count; f++) {
+        const FieldSpec *spec = &layout->fields[f];
+        char text[FIELD_TEXT_MAX];
+        int length = spec->format(record_bytes + spec->source_offset, spec->source_max, text);
+
+        int skip = 0;  /* 포맷 결과에서 건너뛸 앞부분 (우측 정렬이 넘칠 때) */
+        int start = 0; /* 필드 안에서 쓰기 시작할 위치 */
+        if (length > spec->width) {
+            if (spec->align == ALIGN_RIGHT) skip = length - spec->width;
+            length = spec->width;
+        } else if (spec->align == ALIGN_RIGHT) {
+            start = spec->width - length;
+        }
+        memcpy(output_line + spec->offset + start, text + skip, (size_t)length);
 
-    for (int i = 0; i < write_len; i++) {
-        buffer[offset + i] = (char)bytes[i];
+        DBG_PRINTF("[%s] 위치: %3d, 폭: %2d, 결과: \"%.*s\"\n",
+                   spec->name, spec->offset, spec->width, length, text + skip);
     }
-    return offset + write_len;
+    return 0;
 }
 
+/* --- 통장 레이아웃 (120바이트) --- */
+
+static const unsigned char BANKBOOK_CONTROL[] = {0xff, 0x00, 0x01, 0x00};
+
+static const FieldSpec BANKBOOK_FIELDS[] = {
+    /* 이름      위치  폭  정렬         포맷          원본 */
+    {"거래일자",    4, 10, ALIGN_LEFT,  format_text,  FIELD_SOURCE(BankbookRecord, trDt)},
+    {"거래내용",   14, 20, ALIGN_LEFT,  format_text,  FIELD_SOURCE(BankbookRecord, content)},
+    {"출금금액",   34, 15, ALIGN_RIGHT, format_money, FIELD_SOURCE(BankbookRecord, outAmt)},
+    {"입금금액",   49, 15, ALIGN_RIGHT, format_money, FIELD_SOURCE(BankbookRecord, inAmt)},
+    {"현재잔액",   64, 20, ALIGN_RIGHT, format_money, FIELD_SOURCE(BankbookRecord, balance)},
+    /* 84~119: 예비 공간 (템플릿의 공백) */
+};
+
+static LineLayout BANKBOOK_LAYOUT = {
+    "통장", LINE_SIZE, BANKBOOK_CONTROL, (int)sizeof(BANKBOOK_CONTROL),
+    BANKBOOK_FIELDS, (int)(sizeof(BANKBOOK_FIELDS) / sizeof(BANKBOOK_FIELDS[0])), 0, {0}
+};
+
+/* --- 거래 명세 레이아웃 (80바이트, 제어 문자 없음): 같은 엔진으로 다른 양식을 찍는 예 --- */
+
+static const FieldSpec STATEMENT_FIELDS[] = {
+    {"잔액",      0, 18, ALIGN_RIGHT, format_money, FIELD_SOURCE(BankbookRecord, balance)},
+    {"거래일자", 20,  8, ALIGN_LEFT,  format_text,  FIELD_SOURCE(BankbookRecord, trDt)},
+    {"거래내용", 30, 20, ALIGN_LEFT,  format_text,  FIELD_SOURCE(BankbookRecord, content)},
+    {"입금금액", 52, 13, ALIGN_RIGHT, format_money, FIELD_SOURCE(BankbookRecord, inAmt)},
+    {"출금금액", 67, 13, ALIGN_RIGHT, format_money, FIELD_SOURCE(BankbookRecord, outAmt)},
+};
+
+static LineLayout STATEMENT_LAYOUT = {
+    "거래명세", 80, NULL, 0,
+    STATEMENT_FIELDS, (int)(sizeof(STATEMENT_FIELDS) / sizeof(STATEMENT_FIELDS[0])), 0, {0}
+};
+
 /* --- 메인 처리 흐름 --- */
 
 /*
  * [함수] make_bankbook_line
  * [설명] 레코드를 받아 120바이트 고정 폭의 통장 출력용 라인 한 줄을 완성합니다.
+ *        (BANKBOOK_LAYOUT은 main에서 load_layout으로 미리 검사해 둡니다)
+ * [반환] 0: 성공, -1: 레이아웃이 로드되지 않음 (이때 라인은 공백으로 채움)
+ */
+static int make_bankbook_line(BankbookRecord record, char output_line[]) {
+    if (format_line(&BANKBOOK_LAYOUT, &record, output_line) != 0) {
+        memset(output_line, ' ', LINE_SIZE);
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * [함수] print_masked_line
+ * [설명] 라인을 화면에 출력합니다. 제어 문자만 '.'으로 바꾸고 끝의 공백은 지웁니다. (한글 UTF-8은 유지)
  */
-static void make_bankbook_line(BankbookRecord record, char output_line[]) {
-    char temp_line[LINE_SIZE + 1];
-    
-    /* 1. 라인 초기화 (전체 공백) */
-    memset(temp_line, ' ', LINE_SIZE);
-    temp_line[LINE_SIZE] = '\0';
-
-    int current_offset = 0;
-
-    /* 2. 제어 문자 추가 (4바이트) */
-    static const unsigned char ctrl_code[] = {0xff, 0x00, 0x01, 0x00};
-    current_offset = append_raw_bytes(temp_line, current_offset, ctrl_code, (int)sizeof(ctrl_code));
-
-    /* 3. 각 필드 추가 (레이아웃 정의) */
-    current_offset = append_text_field(temp_line, current_offset, record.trDt, 10);      /* 날짜 */
-    current_offset = append_text_field(temp_line, current_offset, record.content, 20);   /* 내용 */
-    current_offset = append_amount_field(temp_line, current_offset, record.outAmt, 15);  /* 출금 */
-    current_offset = append_amount_field(temp_line, current_offset, record.inAmt, 15);   /* 입금 */
-    current_offset = append_amount_field(temp_line, current_offset, record.balance, 20); /* 잔액 */
-
-    /* 최종 결과 복사 */
-    memcpy(output_line, temp_line, LINE_SIZE);
+static void print_masked_line(int number, const char line[], int line_size) {
+    char printable[LAYOUT_MAX_LINE + 1];
+    memcpy(printable, line, (size_t)line_size);
+    printable[line_size] = '\0';
+
+    for (int k = 0; k < line_size; k++) {
+        unsigned char c = (unsigned char)printable[k];
+        /* 0x00~0x1F(제어문자), 0x7F(DEL), 0xFF 등만 마스킹 */
+        if (c < 32 || c == 127 || c == 255) printable[k] = '.';
+    }
+
+    remove_trailing_spaces(printable);
+    printf("[%02d] %s\n", number, printable);
 }
 
 int main(void) {
@@ -324,6 +415,11 @@ int main(void) {
         {"20260513", "카드결제", "45678.9", "0", "12330864.31"}
     };
 
+    /* 레이아웃은 시작할 때 한 번만 검사 (잘못된 표는 여기서 바로 드러남) */
+    if (load_layout(&BANKBOOK_LAYOUT) != 0 || load_layout(&STATEMENT_LAYOUT) != 0) {
+        return 1;
+    }
+
     /* 2. 레거시 출력 버퍼 초기화 */
     PRT_BNBK_MSG msg_buffer;
     memset(msg_buffer.BnbkData, ' ', sizeof(msg_buffer.BnbkData));
@@ -333,8 +429,11 @@ int main(void) {
     /* 3. 각 레코드를 통장 라인으로 변환 */
     for (int i = 0; i < 3; i++) {
         char finished_line[LINE_SIZE + 1];
-        make_bankbook_line(records[i], finished_line);
-        
+        if (make_bankbook_line(records[i], finished_line) != 0) {
+            fprintf(stderr, "[%s] %d번째 레코드를 만들지 못했습니다\n", BANKBOOK_LAYOUT.name, i + 1);
+            return 1;
+        }
+
         /* 생성된 120바이트를 버퍼의 i번째 줄에 저장 */
         memcpy(msg_buffer.BnbkData[i], finished_line, LINE_SIZE);
     }
@@ -343,21 +442,30 @@ int main(void) {
     printf("\n--- 최종 출력 결과 (120바이트 고정 폭) ---\n");
     printf("========================================================================================================================\n");
     for (int i = 0; i < 3; i++) {
-        char printable[LINE_SIZE + 1];
-        memcpy(printable, msg_buffer.BnbkData[i], LINE_SIZE);
-        printable[LINE_SIZE] = '\0';
-
-        /* 제어 문자만 '.'으로 바꿔서 출력 (한글 UTF-8은 유지) */
-        for (int k = 0; k < LINE_SIZE; k++) {
-            unsigned char c = (unsigned char)printable[k];
-            /* 0x00~0x1F(제어문자), 0x7F(DEL), 0xFF 등만 마스킹 */
-            if (c < 32 || c == 127 || c == 255) printable[k] = '.'; 
-        }
-
-        remove_trailing_spaces(printable);
-        printf("[%02d] %s\n", i + 1, printable);
+        print_masked_line(i + 1, msg_buffer.BnbkData[i], LINE_SIZE);
     }
     printf("========================================================================================================================\n");
 
+    /* 5. 같은 레코드를 다른 양식(거래 명세, 80바이트)으로 출력 */
+    printf("\n--- 거래 명세 (80바이트 고정 폭) ---\n");
+    for (int i = 0; i < 3; i++) {
+        char statement_line[80];
+        if (format_line(&STATEMENT_LAYOUT, &records[i], statement_line) != 0) {
+            fprintf(stderr, "[%s] %d번째 레코드를 만들지 못했습니다\n", STATEMENT_LAYOUT.name, i + 1);
+            return 1;
+        }
+        print_masked_line(i + 1, statement_line, STATEMENT_LAYOUT.line_size);
+    }
+
+    /* 6. 잘못된 레이아웃은 로드 시점에 거부됨 (입금금액이 출금금액과 겹치는 예) */
+    static const FieldSpec BROKEN_FIELDS[] = {
+        {"출금금액", 34, 15, ALIGN_RIGHT, format_money, FIELD_SOURCE(BankbookRecord, outAmt)},
+        {"입금금액", 45, 15, ALIGN_RIGHT, format_money, FIELD_SOURCE(BankbookRecord, inAmt)},
+    };
+    LineLayout broken = {"잘못된 예", LINE_SIZE, NULL, 0, BROKEN_FIELDS, 2, 0, {0}};
+    printf("\n--- 잘못된 레이아웃 검사 ---\n");
+    fflush(stdout);
+    if (load_layout(&broken) != 0) printf("로드 거부됨 (정상)\n");
+
     return 0;
 }
@@ -0,0 +1,203 @@
+#ifndef AMOUNT_H
+#define AMOUNT_H
+
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * 금액 고정 소수점 자료형
+ * - 금액 × 100 (소수 2자리, 전 단위)을 int64로 보관하므로 ±92,233,720,368,547,758.07까지 정확함
+ *   (double은 2^53 이상에서 자릿수가 틀어짐)
+ * - 문자열을 숫자로 직접 읽고 쓰며 atof/strtod/sprintf를 거치지 않음
+ * - 반올림은 사사오입(0.5는 0에서 먼 쪽)으로 통일
+ */
+typedef int64_t amt_t;
+
+#define AMT_SCALE 100
+
+/* amt_format 옵션 */
+#define AMT_FMT_COMMA   0x01 /* 정수부에 천 단위 쉼표 */
+#define AMT_FMT_TRIM00  0x02 /* 소수부가 .00이면 생략 */
+#define AMT_FMT_INTEGER 0x04 /* 원 단위로 반올림하여 소수부 없이 출력 */
+
+/* amt_format 결과 최대 길이 ("-92,233,720,368,547,758.07" 26자 + 널) */
+#define AMT_FMT_MAX_LEN 32
+
+/**
+ * @brief 금액 문자열을 고정 소수점 값으로 변환 (strtod처럼 앞부분만 읽음)
+ * @param src      읽기 전용 문자열 (널 문자 또는 len에서 멈춤)
+ * @param len      최대로 읽을 길이
+ * @param out      [Out] 금액 × 100. 숫자가 없거나 범위를 넘으면 0
+ * @return int     읽은 글자 수 (앞 공백 포함), 숫자가 없으면 0, 범위 초과면 -1
+ * @details 형식: [공백][+|-]정수부[.소수부]. 소수 셋째 자리에서 반올림하고 그 뒤는 읽기만 함.
+ *          지수 표기(1e3)나 16진수는 지원하지 않으며 'e' 앞에서 멈춤.
+ */
+static inline int amt_parse(const char *src, int len, amt_t *out)
+{
+    uint64_t int_part = 0;
+    int frac = 0;
+    int round_up = 0;
+    int digits = 0;
+    int negative = 0;
+    int idx = 0;
+
+    *out = 0;
+    if (src == NULL || len <= 0)
+    {
+        return 0;
+    }
+
+    while (idx < len && (src[idx] == ' ' || (src[idx] >= '\t' && src[idx] <= '\r')))
+    {
+        idx++;
+    }
+    if (idx < len && (src[idx] == '+' || src[idx] == '-'))
+    {
+        negative = (src[idx] == '-');
+        idx++;
+    }
+
+    /* 정수부: 100을 곱해도 int64를 넘지 않는 범위까지만 허용 */
+    for (; idx < len && src[idx] >= '0' && src[idx] <= '9'; idx++, digits++)
+    {
+        int_part = int_part * 10 + (uint64_t)(src[idx] - '0');
+        if (int_part > (uint64_t)INT64_MAX / AMT_SCALE)
+        {
+            return -1;
+        }
+    }
+
+    /* 소수부: 두 자리는 값으로, 셋째 자리는 반올림 판단, 나머지는 건너뜀 */
+    if (idx < len && src[idx] == '.')
+    {
+        int frac_digits = 0;
+        for (idx++; idx < len && src[idx] >= '0' && src[idx] <= '9'; idx++, frac_digits++)
+        {
+            int d = src[idx] - '0';
+            if (frac_digits < 2)
+            {
+                frac = frac * 10 + d;
+            }
+            else if (frac_digits == 2)
+            {
+                round_up = (d >= 5);
+            }
+        }
+        if (frac_digits == 1)
+        {
+            frac *= 10;
+        }
+        digits += frac_digits;
+    }
+
+    if (digits == 0)
+    {
+        return 0;
+    }
+
+    uint64_t mag = int_part * AMT_SCALE + (uint64_t)frac + (uint64_t)round_up;
+    if (mag > (uint64_t)INT64_MAX)
+    {
+        return -1;
+    }
+    *out = negative ? -(amt_t)mag : (amt_t)mag;
+    return idx;
+}
+
+/**
+ * @brief 금액을 원 단위 정수로 반올림 (사사오입)
+ * @param value    금액 × 100
+ * @return amt_t   원 단위 정수 (×100 아님)
+ */
+static inline amt_t amt_round_units(amt_t value)
+{
+    amt_t units = value / AMT_SCALE;
+    amt_t rem = value % AMT_SCALE;
+
+    if (rem >= AMT_SCALE / 2)
+    {
+        units++;
+    }
+    else if (rem <= -AMT_SCALE / 2)
+    {
+        units--;
+    }
+    return units;
+}
+
+/**
+ * @brief 금액을 문자열로 변환 (부호, 천 단위 쉼표, 소수부 규칙 적용)
+ * @param value    금액 × 100
+ * @param flags    AMT_FMT_* 조합
+ * @param out      [Out] 결과 문자열 (널 종료)
+ * @param out_size out 버퍼 크기 (AMT_FMT_MAX_LEN이면 항상 충분)
+ * @return int     결과 길이, 버퍼가 부족하면 -1
+ * @details 음수는 '-'를 붙이며, 반올림 결과가 0이면 부호를 붙이지 않음.
+ */
+static inline int amt_format(amt_t value, int flags, char *out, int out_size)
+{
+    char tmp[AMT_FMT_MAX_LEN];
+    int pos = (int)sizeof(tmp);
+    uint64_t mag;
+    uint64_t int_part;
+
+    if (out == NULL || out_size <= 0)
+    {
+        return -1;
+    }
+
+    if (flags & AMT_FMT_INTEGER)
+    {
+        value = amt_round_units(value);
+    }
+    mag = (value < 0) ? (uint64_t)0 - (uint64_t)value : (uint64_t)value;
+
+    if (flags & AMT_FMT_INTEGER)
+    {
+        int_part = mag;
+    }
+    else
+    {
+        int frac = (int)(mag % AMT_SCALE);
+        int_part = mag / AMT_SCALE;
+        if (!((flags & AMT_FMT_TRIM00) && frac == 0))
+        {
+            tmp[--pos] = (char)('0' + frac % 10);
+            tmp[--pos] = (char)('0' + frac / 10);
+            tmp[--pos] = '.';
+        }
+    }
+
+    /* 정수부를 뒤에서부터 채우며 3자리마다 쉼표 */
+    int group = 0;
+    do
+    {
+        if (group == 3)
+        {
+            if (flags & AMT_FMT_COMMA)
+            {
+                tmp[--pos] = ',';
+            }
+            group = 0;
+        }
+        tmp[--pos] = (char)('0' + int_part % 10);
+        int_part /= 10;
+        group++;
+    } while (int_part != 0);
+
+    if (value < 0)
+    {
+        tmp[--pos] = '-';
+    }
+
+    int length = (int)sizeof(tmp) - pos;
+    if (length >= out_size)
+    {
+        return -1;
+    }
+    memcpy(out, tmp + pos, (size_t)length);
+    out[length] = '\0';
+    return length;
+}
+
+#endif // AMOUNT_H
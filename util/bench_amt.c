@@ -0,0 +1,334 @@
+/*
+ * bench_amt.c
+ * - 금액 포맷 함수의 기존 구현(double 경유)과 amt_t 고정 소수점 구현의 속도/정확도 비교
+ * - 기존 구현은 비교를 위해 이 파일에만 그대로 남겨 둠 (legacy_*)
+ *
+ * 빌드/실행: make bench
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <time.h>
+#include "util.h"
+
+/* bnbk/bbnk.c의 금액 포맷 결과 버퍼 */
+#define MAX_AMOUNT_LEN 64
+
+typedef struct {
+    char text[MAX_AMOUNT_LEN];
+} LegacyAmount;
+
+typedef LegacyAmount AmountString;
+
+/* --- 기존 구현 (util.h cdcd_mk_double / cdcd_make_amt, bnbk format_amount) --- */
+
+/**
+ * @brief 숫자 형식의 문자열을 안전하게 double(실수)로 변환
+ * @param src      읽기 전용 문자열 포인터
+ * @param len      변환을 요청할 길이
+ * @return double  변환된 정밀 실수 값
+ */
+static inline double legacy_mk_double(const char *src, int len)
+{
+    char buf[MAX_DIGIT + 1] = {0};
+    int cp_len;
+
+    // 버퍼 오버플로우 방어
+    cp_len = (len > MAX_DIGIT) ? MAX_DIGIT : len;
+
+    memcpy(buf, src, cp_len);
+
+    return strtod(buf, NULL);
+}
+
+
+/**
+ * @brief 금액 문자열을 우측 정렬 및 천단위 콤마 형식으로 가공
+ * @param amt_buf  [In/Out] 금액 문자열 버퍼
+ * @param out_len  [In]     출력할 최종 고정 길이
+ * @param edt_chr  [In]     양수일 때 금액 맨 앞에 채워줄 문자 (예: ' ', '+')
+ * @return int       변환 완료된 최종 문자열 길이 (out_len 반환)
+ */
+static inline int legacy_make_amt(char *amt_buf, int out_len, char edt_chr)
+{
+    char fmt[16] = {0x00,};
+    char tmp[32] = {0x00,};
+    char buf[32] = {0x00,};
+
+    double val;
+    int src_pos;
+    int dst_pos;
+    int comma;
+
+    if (out_len >= (int)sizeof(buf))
+    {
+        memset(buf, '*', sizeof(buf) - 1);
+        buf[sizeof(buf) - 1] = 0x00;
+    }
+    else
+    {
+        // 내부 안전 변환 함수 호출
+        val = legacy_mk_double(amt_buf, 15);
+
+        // 포맷 및 임시 문자열 생성
+        sprintf(fmt, "%%%d.0lf", out_len);
+        sprintf(tmp, fmt, val);
+
+        // 위치 인덱스 및 콤마 카운터 초기화 (모두 10자 이하 단어로 구성)
+        src_pos = (int)strlen(tmp) - 1;
+        dst_pos = (int)strlen(tmp) - 1;
+        comma = 0;
+
+        while (src_pos >= 0)
+        {
+            if (tmp[src_pos] == ' ')
+            {
+                break;
+            }
+
+            if (tmp[src_pos] == '-')
+            {
+                buf[dst_pos--] = tmp[src_pos--];
+            }
+            else
+            {
+                if (comma != 0 && (comma % 3) == 0)
+                {
+                    buf[dst_pos--] = ',';
+                }
+                buf[dst_pos--] = tmp[src_pos--];
+                comma++;
+            }
+        }
+
+        if (buf[dst_pos + 1] != '-')
+        {
+            buf[dst_pos--] = edt_chr;
+        }
+
+        while (dst_pos >= 0)
+        {
+            buf[dst_pos--] = ' ';
+        }
+
+        buf[out_len] = 0x00;
+    }
+
+    strcpy(amt_buf, buf);
+
+    return out_len;
+}
+
+
+/*
+ * [함수] legacy_format_amount
+ * [설명] "12345" 같은 숫자 문자열을 "12,345" 처럼 바꿉니다.
+ * [과정] 
+ * 1. 실릿수(double)로 변환 후 소수점 2자리 문자열로 만듭니다.
+ * 2. 소수점이 .00 이면 정수형으로 취급하여 소수부를 버립니다.
+ * 3. 정수 부분을 뒤에서부터 한 글자씩 채우면서 3글자마다 쉼표(,)를 넣습니다.
+ */
+static LegacyAmount legacy_format_amount(const char amount_src[]) {
+    LegacyAmount result;
+    result.text[0] = '\0';
+
+    /* 1. 숫자로 변환 (입력이 없으면 "0"으로 처리) */
+    double numeric_value = atof(amount_src ? amount_src : "0");
+    char formatted_temp[MAX_AMOUNT_LEN];
+    snprintf(formatted_temp, sizeof(formatted_temp), "%.2f", numeric_value);
+
+    int temp_len = (int)strlen(formatted_temp);
+    int dot_position = -1;
+
+    /* 소수점(.) 위치 찾기 */
+    for (int i = 0; i < temp_len; i++) {
+        if (formatted_temp[i] == '.') {
+            dot_position = i;
+            break;
+        }
+    }
+
+    /* 2. 소수점이 .00 으로 끝나면 제거 로직 */
+    if (dot_position >= 0 && formatted_temp[dot_position + 1] == '0' && 
+        formatted_temp[dot_position + 2] == '0' && formatted_temp[dot_position + 3] == '\0') {
+        formatted_temp[dot_position] = '\0';
+        temp_len = dot_position;
+        dot_position = -1;
+    }
+
+    int integer_part_len = (dot_position >= 0) ? dot_position : temp_len;
+    int suffix_len = (dot_position >= 0) ? (temp_len - dot_position) : 0; 
+    int comma_count = (integer_part_len > 0) ? ((integer_part_len - 1) / 3) : 0;
+
+    /* 최종적으로 만들어질 문자열의 길이 계산 */
+    int final_len = integer_part_len + comma_count + suffix_len;
+    if (final_len >= MAX_AMOUNT_LEN) final_len = MAX_AMOUNT_LEN - 1;
+    
+    result.text[final_len] = '\0';
+
+    /* 3. 뒤에서부터 채우기 (우측 정렬 효과) */
+    int dest_index = final_len - 1;
+
+    /* A. 소수부 먼저 복사 (있을 경우) */
+    if (dot_position >= 0 && suffix_len > 0) {
+        for (int i = suffix_len - 1; i >= 0; i--) {
+            result.text[dest_index--] = formatted_temp[dot_position + i];
+        }
+    }
+
+    /* B. 정수부 복사하면서 쉼표 넣기 */
+    int source_index = integer_part_len - 1;
+    int digit_counter = 0;
+    while (source_index >= 0 && dest_index >= 0) {
+        result.text[dest_index--] = formatted_temp[source_index--];
+        digit_counter++;
+
+        /* 3자리마다 쉼표 삽입 (단, 맨 앞자리일 때는 넣지 않음) */
+        if (digit_counter == 3 && source_index >= 0 && dest_index >= 0) {
+            result.text[dest_index--] = ',';
+            digit_counter = 0;
+        }
+    }
+
+    return result;
+}
+
+
+/* --- 새 구현 (bnbk/bbnk.c format_amount와 같음) --- */
+
+static AmountString format_amount(const char amount_src[])
+{
+    AmountString result;
+    amt_t value;
+
+    if (amt_parse(amount_src, MAX_AMOUNT_LEN, &value) < 0)
+    {
+        memset(result.text, '*', MAX_AMOUNT_LEN - 1);
+        result.text[MAX_AMOUNT_LEN - 1] = '\0';
+        return result;
+    }
+    if (amt_format(value, AMT_FMT_COMMA | AMT_FMT_TRIM00, result.text, MAX_AMOUNT_LEN) < 0)
+    {
+        result.text[0] = '\0';
+    }
+    return result;
+}
+
+/* --- 측정 --- */
+
+#define N_INPUT 1000000
+
+static char inputs[N_INPUT][24];
+
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static unsigned long long rng_state = 88172645463325252ULL;
+
+static unsigned long long rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+int main(void)
+{
+    volatile unsigned sink = 0;
+    double t0, t1, t2;
+    int diff;
+
+    /* 입력: 1~12자리 금액, 절반은 소수 2자리
+     * - cdcd_make_amt는 앞 15바이트만 읽으므로 15바이트 이내로 생성
+     * - .50은 제외: 기존 %.0lf는 짝수 쪽 반올림, amt_t는 사사오입이라 결과가 다름 */
+    for (int i = 0; i < N_INPUT; i++)
+    {
+        unsigned long long digits = 1 + rng() % 12;
+        unsigned long long val = rng();
+        unsigned long long mod = 1;
+        for (unsigned long long k = 0; k < digits; k++)
+        {
+            mod *= 10;
+        }
+        val %= mod;
+        if (i % 2)
+        {
+            int cents = (int)(rng() % 100);
+            if (cents == 50)
+            {
+                cents = 51;
+            }
+            snprintf(inputs[i], sizeof(inputs[i]), "%llu.%02d", val, cents);
+        }
+        else
+        {
+            snprintf(inputs[i], sizeof(inputs[i]), "%llu", val);
+        }
+    }
+
+    printf("=== format_amount (천 단위 쉼표, .00 생략) %d건 ===\n", N_INPUT);
+    t0 = now_sec();
+    for (int i = 0; i < N_INPUT; i++)
+    {
+        sink += (unsigned char)legacy_format_amount(inputs[i]).text[0];
+    }
+    t1 = now_sec();
+    for (int i = 0; i < N_INPUT; i++)
+    {
+        sink += (unsigned char)format_amount(inputs[i]).text[0];
+    }
+    t2 = now_sec();
+    diff = 0;
+    for (int i = 0; i < N_INPUT; i++)
+    {
+        diff += strcmp(legacy_format_amount(inputs[i]).text, format_amount(inputs[i]).text) != 0;
+    }
+    printf("  기존(atof/snprintf) : %6.1f ns/건\n", (t1 - t0) * 1e9 / N_INPUT);
+    printf("  amt_t              : %6.1f ns/건 (결과 불일치 %d건)\n\n", (t2 - t1) * 1e9 / N_INPUT, diff);
+
+    printf("=== cdcd_make_amt (20자리 우측 정렬, '+') %d건 ===\n", N_INPUT);
+    char buf[32];
+    char ref[32];
+    t0 = now_sec();
+    for (int i = 0; i < N_INPUT; i++)
+    {
+        strcpy(buf, inputs[i]);
+        legacy_make_amt(buf, 20, '+');
+        sink += (unsigned char)buf[19];
+    }
+    t1 = now_sec();
+    for (int i = 0; i < N_INPUT; i++)
+    {
+        strcpy(buf, inputs[i]);
+        cdcd_make_amt(buf, 20, '+');
+        sink += (unsigned char)buf[19];
+    }
+    t2 = now_sec();
+    diff = 0;
+    for (int i = 0; i < N_INPUT; i++)
+    {
+        strcpy(ref, inputs[i]);
+        legacy_make_amt(ref, 20, '+');
+        strcpy(buf, inputs[i]);
+        cdcd_make_amt(buf, 20, '+');
+        diff += strcmp(ref, buf) != 0;
+    }
+    printf("  기존(strtod/sprintf): %6.1f ns/건\n", (t1 - t0) * 1e9 / N_INPUT);
+    printf("  amt_t              : %6.1f ns/건 (결과 불일치 %d건)\n\n", (t2 - t1) * 1e9 / N_INPUT, diff);
+
+    /* 2^53(약 9.0e15)을 넘는 금액: double은 끝자리가 틀어짐 */
+    static const char *big[] = {"90071992547409.93", "9007199254740993", "12345678901234567.89"};
+    printf("=== 2^53 이상 금액 ===\n");
+    for (int i = 0; i < 3; i++)
+    {
+        printf("  %-22s 기존: %-28s amt_t: %s\n", big[i], legacy_format_amount(big[i]).text,
+               format_amount(big[i]).text);
+    }
+
+    return (int)(sink & 0);
+}
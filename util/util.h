@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include "amount.h"
 
 #define MAX_SIZE 10
 #define MAX_DIGIT 20
@@ -99,77 +100,58 @@ static inline int cdcd_lspace_zero_amt_trim(char *buf, int len)
 
 /**
  * @brief 금액 문자열을 우측 정렬 및 천단위 콤마 형식으로 가공
- * @param amt_buf  [In/Out] 금액 문자열 버퍼
+ * @param amt_buf  [In/Out] 금액 문자열 버퍼 (앞 15바이트를 읽음, out_len + 1 바이트 이상)
  * @param out_len  [In]     출력할 최종 고정 길이
  * @param edt_chr  [In]     양수일 때 금액 맨 앞에 채워줄 문자 (예: ' ', '+')
  * @return int       변환 완료된 최종 문자열 길이 (out_len 반환)
+ * @details 원 단위로 사사오입하며, 부호/콤마 포함 금액이 out_len에 들어가지 않으면
+ *          잘린 금액 대신 전체를 '*'로 채움. (amt_t 고정 소수점 사용, 2^53 이상도 정확)
  */
 static inline int cdcd_make_amt(char *amt_buf, int out_len, char edt_chr)
 {
-    char fmt[16] = {0x00,};
-    char tmp[32] = {0x00,};
-    char buf[32] = {0x00,};
+    char num[AMT_FMT_MAX_LEN];
+    amt_t val;
+    int num_len;
+    int need;
 
-    double val;
-    int src_pos;
-    int dst_pos;
-    int comma;
-
-    if (out_len >= (int)sizeof(buf))
+    if (out_len >= 32)
     {
-        memset(buf, '*', sizeof(buf) - 1);
-        buf[sizeof(buf) - 1] = 0x00;
+        memset(amt_buf, '*', 31);
+        amt_buf[31] = 0x00;
+        return out_len;
     }
-    else
+    if (out_len <= 0)
     {
-        // 내부 안전 변환 함수 호출
-        val = cdcd_mk_double(amt_buf, 15);
-
-        // 포맷 및 임시 문자열 생성
-        sprintf(fmt, "%%%d.0lf", out_len);
-        sprintf(tmp, fmt, val);
+        amt_buf[0] = 0x00;
+        return 0;
+    }
 
-        // 위치 인덱스 및 콤마 카운터 초기화 (모두 10자 이하 단어로 구성)
-        src_pos = (int)strlen(tmp) - 1;
-        dst_pos = (int)strlen(tmp) - 1;
-        comma = 0;
+    // 앞 15바이트를 직접 파싱 (숫자가 없으면 0)
+    if (amt_parse(amt_buf, 15, &val) < 0)
+    {
+        val = 0;
+    }
+    num_len = amt_format(val, AMT_FMT_COMMA | AMT_FMT_INTEGER, num, (int)sizeof(num));
 
-        while (src_pos >= 0)
-        {
-            if (tmp[src_pos] == ' ')
-            {
-                break;
-            }
-
-            if (tmp[src_pos] == '-')
-            {
-                buf[dst_pos--] = tmp[src_pos--];
-            }
-            else
-            {
-                if (comma != 0 && (comma % 3) == 0)
-                {
-                    buf[dst_pos--] = ',';
-                }
-                buf[dst_pos--] = tmp[src_pos--];
-                comma++;
-            }
-        }
+    // 양수 앞 편집 문자는 공백이 아닐 때만 자리를 차지함
+    need = (num_len < 0) ? out_len + 1 : num_len + ((num[0] != '-' && edt_chr != ' ') ? 1 : 0);
 
-        if (buf[dst_pos + 1] != '-')
-        {
-            buf[dst_pos--] = edt_chr;
-        }
+    if (need > out_len)
+    {
+        memset(amt_buf, '*', out_len);
+    }
+    else
+    {
+        int start = out_len - num_len;
 
-        while (dst_pos >= 0)
+        memset(amt_buf, ' ', start);
+        if (num[0] != '-' && start > 0)
         {
-            buf[dst_pos--] = ' ';
+            amt_buf[start - 1] = edt_chr;
         }
-
-        buf[out_len] = 0x00;
+        memcpy(amt_buf + start, num, num_len);
     }
-
-    strcpy(amt_buf, buf);
+    amt_buf[out_len] = 0x00;
 
     return out_len;
 }